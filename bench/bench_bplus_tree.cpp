@@ -0,0 +1,225 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_bplus_tree/bplus_tree.h"
+
+namespace {
+
+// i-й по порядку ключ: шаг 8 со случайным сдвигом, чтобы между ключами
+// были промахи, а ключ по номеру вычислялся без таблицы. Ключи и
+// значения 32-битные: и вектор для построения, и дерево на 10^8 ключей
+// помещаются в память вместе (около 0.8 и 0.9 ГБ)
+uint32_t key_at(uint64_t index) {
+    uint64_t mixed = index * 0x9E3779B97F4A7C15ull;
+    return static_cast<uint32_t>(index * 8 + (mixed >> 61));
+}
+
+using TBench32Tree = TBPlusTree<uint32_t, uint32_t>;
+
+// деревья по размеру строятся один раз; держится только последнее,
+// чтобы большие деревья не занимали память в остальных бенчмарках
+template <class Tree>
+const Tree& cached_tree(size_t count) {
+    static std::unique_ptr<Tree> tree;
+    static size_t built = 0;
+    if (tree == nullptr || built != count) {
+        tree.reset();
+        std::vector<std::pair<uint32_t, uint32_t>> items;
+        items.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            items.emplace_back(key_at(i), static_cast<uint32_t>(i));
+        }
+        tree.reset(new Tree());
+        tree->assign_sorted(items);
+        built = count;
+    }
+    return *tree;
+}
+
+const std::map<uint32_t, uint32_t>& cached_map(size_t count) {
+    static std::unique_ptr<std::map<uint32_t, uint32_t>> map;
+    static size_t built = 0;
+    if (map == nullptr || built != count) {
+        map.reset(new std::map<uint32_t, uint32_t>());
+        for (size_t i = 0; i < count; i++) {
+            map->emplace_hint(map->end(), key_at(i),
+                              static_cast<uint32_t>(i));
+        }
+        built = count;
+    }
+    return *map;
+}
+
+// поиск в узле: 31 64-битный ключ, arg(0) - SimdLevel
+void bm_node_search(TBenchState& state) {
+    SimdLevel level = static_cast<SimdLevel>(state.arg(0));
+    const size_t kKeys = TBPlusTree<uint64_t, uint64_t>::kInnerCapacity;
+    std::vector<uint64_t> keys(kKeys);
+    for (size_t i = 0; i < kKeys; i++) {
+        keys[i] = key_at(i);
+    }
+    std::mt19937 gen(1);
+    std::vector<uint64_t> queries(1024);
+    for (uint64_t& query : queries) {
+        query = gen() % (kKeys * 8);
+    }
+    while (state.keep_running()) {
+        size_t sum = 0;
+        for (uint64_t query : queries) {
+            sum += bplus_detail::count_less(keys.data(), kKeys, query, level);
+        }
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * queries.size());
+}
+BENCHMARK(bm_node_search)->arg(0)->arg(1)->arg(2);
+
+// поиск существующих ключей в структуре из arg(0) элементов; запросы
+// случайны, поэтому на больших размерах каждый уровень - промах кэша
+const size_t kLookups = 1 << 16;
+
+template <class Find>
+void lookup_random(TBenchState& state, size_t count, Find find) {
+    std::mt19937_64 gen(5);
+    std::vector<uint32_t> queries(kLookups);
+    for (uint32_t& query : queries) {
+        query = key_at(gen() % count);
+    }
+    while (state.keep_running()) {
+        uint64_t sum = 0;
+        for (uint32_t query : queries) {
+            sum += find(query);
+        }
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * kLookups);
+}
+
+template <size_t NodeBytes>
+void bm_bplus_lookup(TBenchState& state) {
+    using TTree = TBPlusTree<uint32_t, uint32_t, NodeBytes>;
+    size_t count = static_cast<size_t>(state.arg(0));
+    const TTree& tree = cached_tree<TTree>(count);
+    lookup_random(state, count,
+                  [&tree](uint32_t key) { return tree.find(key).value(); });
+    state.set_counter("height", static_cast<double>(tree.height()));
+}
+
+// std::map на 10^8 ключей занял бы ~4.8 ГБ, поэтому его ряд до 10^7
+void bm_bplus_lookup_512(TBenchState& state) {
+    bm_bplus_lookup<512>(state);
+}
+BENCHMARK(bm_bplus_lookup_512)->range(1000000, 100000000, 10);
+
+void bm_std_map32_lookup(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    const std::map<uint32_t, uint32_t>& map = cached_map(count);
+    lookup_random(state, count,
+                  [&map](uint32_t key) { return map.find(key)->second; });
+}
+BENCHMARK(bm_std_map32_lookup)->range(1000000, 10000000, 10);
+
+// размер узла: меньше строк кэша на узел - больше уровней
+void bm_bplus_lookup_256(TBenchState& state) {
+    bm_bplus_lookup<256>(state);
+}
+BENCHMARK(bm_bplus_lookup_256)->arg(10000000);
+
+void bm_bplus_lookup_1024(TBenchState& state) {
+    bm_bplus_lookup<1024>(state);
+}
+BENCHMARK(bm_bplus_lookup_1024)->arg(10000000);
+
+// обход диапазона из ~kScanLength ключей со случайного начала: листья
+// по списку против перехода к следующему узлу std::map
+const size_t kScans = 1 << 10;
+const uint32_t kScanLength = 1000;
+
+void bm_bplus_scan(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    const TBench32Tree& tree = cached_tree<TBench32Tree>(count);
+    std::mt19937_64 gen(9);
+    uint64_t visited = 0;
+    while (state.keep_running()) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < kScans; i++) {
+            uint32_t from = key_at(gen() % (count - kScanLength));
+            visited += tree.scan(from, from + kScanLength * 8,
+                                 [&sum](uint32_t, uint32_t value) {
+                                     sum += value;
+                                 });
+        }
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(static_cast<int64_t>(visited));
+}
+BENCHMARK(bm_bplus_scan)->range(1000000, 100000000, 10);
+
+void bm_std_map32_scan(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    const std::map<uint32_t, uint32_t>& map = cached_map(count);
+    std::mt19937_64 gen(9);
+    uint64_t visited = 0;
+    while (state.keep_running()) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < kScans; i++) {
+            uint32_t from = key_at(gen() % (count - kScanLength));
+            uint32_t to = from + kScanLength * 8;
+            for (auto it = map.lower_bound(from);
+                 it != map.end() && it->first < to; ++it) {
+                sum += it->second;
+                visited++;
+            }
+        }
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(static_cast<int64_t>(visited));
+}
+BENCHMARK(bm_std_map32_scan)->range(1000000, 10000000, 10);
+
+// вставка случайных ключей по одному в пустую структуру
+std::vector<uint32_t> shuffled_keys(size_t count) {
+    std::vector<uint32_t> keys(count);
+    for (size_t i = 0; i < count; i++) {
+        keys[i] = key_at(i);
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(3));
+    return keys;
+}
+
+void bm_bplus_insert(TBenchState& state) {
+    std::vector<uint32_t> keys =
+        shuffled_keys(static_cast<size_t>(state.arg(0)));
+    while (state.keep_running()) {
+        TBench32Tree tree;
+        for (uint32_t key : keys) {
+            tree.insert(key, key);
+        }
+        do_not_optimize(tree.size());
+    }
+    state.set_items_processed(state.iterations() * keys.size());
+}
+BENCHMARK(bm_bplus_insert)->arg(1000000);
+
+void bm_std_map32_insert(TBenchState& state) {
+    std::vector<uint32_t> keys =
+        shuffled_keys(static_cast<size_t>(state.arg(0)));
+    while (state.keep_running()) {
+        std::map<uint32_t, uint32_t> map;
+        for (uint32_t key : keys) {
+            map.emplace(key, key);
+        }
+        do_not_optimize(map.size());
+    }
+    state.set_items_processed(state.iterations() * keys.size());
+}
+BENCHMARK(bm_std_map32_insert)->arg(1000000);
+
+}  // namespace
@@ -0,0 +1,184 @@
+// Copyright 2024 Marina Usova
+
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_easy_example/divider.h"
+#include "../lib_easy_example/division_inline.h"
+#include "../lib_easy_example/easy_example.h"
+
+namespace {
+
+const size_t kCount = 4096;
+
+// распределения делителей (аргумент бенчмарка)
+enum Distribution {
+    kSmall = 0,         // равномерно в [1, 16]
+    kWide = 1,          // равномерно в [1, INT_MAX]
+    kPowersOfTwo = 2,   // 2^k, k в [0, 30]
+    kConstant = 3,      // один и тот же делитель
+    kHalfZero = 4       // половина делителей равна нулю
+};
+
+const char* distribution_name(int64_t distribution) {
+    switch (distribution) {
+    case kSmall:
+        return "small";
+    case kWide:
+        return "wide";
+    case kPowersOfTwo:
+        return "powers_of_two";
+    case kConstant:
+        return "constant";
+    default:
+        return "half_zero";
+    }
+}
+
+std::vector<int> make_numerators() {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> value(INT_MIN, INT_MAX);
+    std::vector<int> numerators(kCount);
+    for (int& numerator : numerators) {
+        numerator = value(gen);
+    }
+    return numerators;
+}
+
+std::vector<int> make_divisors(int64_t distribution) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> small(1, 16);
+    std::uniform_int_distribution<int> wide(1, INT_MAX);
+    std::uniform_int_distribution<int> power(0, 30);
+    std::bernoulli_distribution is_zero(0.5);
+    std::vector<int> divisors(kCount);
+    for (int& divisor : divisors) {
+        switch (distribution) {
+        case kSmall:
+            divisor = small(gen);
+            break;
+        case kWide:
+            divisor = wide(gen);
+            break;
+        case kPowersOfTwo:
+            divisor = 1 << power(gen);
+            break;
+        case kConstant:
+            divisor = 641;
+            break;
+        default:
+            divisor = is_zero(gen) ? 0 : small(gen);
+        }
+    }
+    return divisors;
+}
+
+void bm_division(TBenchState& state) {
+    std::vector<int> a = make_numerators();
+    std::vector<int> b = make_divisors(state.arg(0));
+    while (state.keep_running()) {
+        for (size_t i = 0; i < kCount; i++) {
+            try {
+                do_not_optimize(division(a[i], b[i]));
+            } catch (const std::invalid_argument&) {
+                do_not_optimize(i);
+            }
+        }
+    }
+    state.set_items_processed(state.iterations() * kCount);
+    state.set_label(distribution_name(state.arg(0)));
+}
+BENCHMARK(bm_division)->dense_range(kSmall, kHalfZero);
+
+void bm_try_division(TBenchState& state) {
+    std::vector<int> a = make_numerators();
+    std::vector<int> b = make_divisors(state.arg(0));
+    while (state.keep_running()) {
+        for (size_t i = 0; i < kCount; i++) {
+            do_not_optimize(try_division(a[i], b[i]).value_or(0.0f));
+        }
+    }
+    state.set_items_processed(state.iterations() * kCount);
+    state.set_label(distribution_name(state.arg(0)));
+}
+BENCHMARK(bm_try_division)->dense_range(kSmall, kHalfZero);
+
+void bm_inline_division(TBenchState& state) {
+    std::vector<int> a = make_numerators();
+    std::vector<int> b = make_divisors(state.arg(0));
+    while (state.keep_running()) {
+        for (size_t i = 0; i < kCount; i++) {
+            try {
+                do_not_optimize(inline_division(a[i], b[i]));
+            } catch (const std::invalid_argument&) {
+                do_not_optimize(i);
+            }
+        }
+    }
+    state.set_items_processed(state.iterations() * kCount);
+    state.set_label(distribution_name(state.arg(0)));
+}
+BENCHMARK(bm_inline_division)->dense_range(kSmall, kHalfZero);
+
+// аргументы: распределение делителей, набор инструкций (SimdLevel)
+void bm_division_batch(TBenchState& state) {
+    std::vector<int> a = make_numerators();
+    std::vector<int> b = make_divisors(state.arg(0));
+    std::vector<float> result(kCount);
+    std::vector<uint8_t> zero_mask(kCount);
+    SimdLevel level = static_cast<SimdLevel>(state.arg(1));
+    while (state.keep_running()) {
+        do_not_optimize(division_batch(a.data(), b.data(), result.data(),
+                                       kCount, zero_mask.data(), level));
+        clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * kCount);
+    state.set_label(distribution_name(state.arg(0)));
+}
+BENCHMARK(bm_division_batch)
+    ->args({ kWide, static_cast<int64_t>(SimdLevel::kScalar) })
+    ->args({ kWide, static_cast<int64_t>(SimdLevel::kSse41) })
+    ->args({ kWide, static_cast<int64_t>(SimdLevel::kAvx2) })
+    ->args({ kHalfZero, static_cast<int64_t>(SimdLevel::kAvx2) });
+
+void bm_hardware_quotient(TBenchState& state) {
+    std::vector<int> a = make_numerators();
+    volatile int divisor_source = 641;  // делитель неизвестен компилятору
+    int divisor = divisor_source;
+    while (state.keep_running()) {
+        for (size_t i = 0; i < kCount; i++) {
+            do_not_optimize(a[i] / divisor);
+        }
+    }
+    state.set_items_processed(state.iterations() * kCount);
+}
+BENCHMARK(bm_hardware_quotient);
+
+void bm_divider_quotient(TBenchState& state) {
+    std::vector<int> a = make_numerators();
+    Divider divider(641);
+    while (state.keep_running()) {
+        for (size_t i = 0; i < kCount; i++) {
+            do_not_optimize(divider.quotient(a[i]));
+        }
+    }
+    state.set_items_processed(state.iterations() * kCount);
+}
+BENCHMARK(bm_divider_quotient);
+
+void bm_divider_divide(TBenchState& state) {
+    std::vector<int> a = make_numerators();
+    Divider divider(641);
+    while (state.keep_running()) {
+        for (size_t i = 0; i < kCount; i++) {
+            do_not_optimize(divider.divide(a[i]));
+        }
+    }
+    state.set_items_processed(state.iterations() * kCount);
+}
+BENCHMARK(bm_divider_divide);
+
+}  // namespace
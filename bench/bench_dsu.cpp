@@ -0,0 +1,109 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_dsu/concurrent_dsu.h"
+#include "../lib_dsu/dsu.h"
+#include "../lib_dsu/rollback_dsu.h"
+#include "../lib_parallel/thread_pool.h"
+
+namespace {
+
+// случайный граф: arg(0) вершин и вдвое больше рёбер - почти все
+// вершины попадают в одну гигантскую компоненту
+std::vector<TDsuEdge> random_edges(size_t vertices) {
+    std::mt19937 gen(41);
+    std::vector<TDsuEdge> edges(vertices * 2);
+    for (TDsuEdge& edge : edges) {
+        edge.a = static_cast<uint32_t>(gen() % vertices);
+        edge.b = static_cast<uint32_t>(gen() % vertices);
+    }
+    return edges;
+}
+
+template <PathMode Mode>
+void sequential_unite(TBenchState& state) {
+    size_t vertices = static_cast<size_t>(state.arg(0));
+    std::vector<TDsuEdge> edges = random_edges(vertices);
+    TDisjointSets<Mode> dsu(vertices);
+    while (state.keep_running()) {
+        dsu.reset();
+        for (const TDsuEdge& edge : edges) {
+            dsu.unite(edge.a, edge.b);
+        }
+        do_not_optimize(dsu.set_count());
+    }
+    state.set_items_processed(state.iterations() * edges.size());
+}
+
+void bm_dsu_no_compression(TBenchState& state) {
+    sequential_unite<PathMode::kNone>(state);
+}
+BENCHMARK(bm_dsu_no_compression)->range(1 << 16, 1 << 22, 64);
+
+void bm_dsu_path_halving(TBenchState& state) {
+    sequential_unite<PathMode::kHalving>(state);
+}
+BENCHMARK(bm_dsu_path_halving)->range(1 << 16, 1 << 22, 64);
+
+void bm_dsu_path_compression(TBenchState& state) {
+    sequential_unite<PathMode::kCompression>(state);
+}
+BENCHMARK(bm_dsu_path_compression)->range(1 << 16, 1 << 22, 64);
+
+// объединение всех рёбер и откат к пустому разбиению
+void bm_rollback_dsu(TBenchState& state) {
+    size_t vertices = static_cast<size_t>(state.arg(0));
+    std::vector<TDsuEdge> edges = random_edges(vertices);
+    TRollbackDsu dsu(vertices);
+    while (state.keep_running()) {
+        for (const TDsuEdge& edge : edges) {
+            dsu.unite(edge.a, edge.b);
+        }
+        do_not_optimize(dsu.set_count());
+        dsu.rollback(0);
+    }
+    state.set_items_processed(state.iterations() * edges.size());
+}
+BENCHMARK(bm_rollback_dsu)->range(1 << 16, 1 << 22, 64);
+
+// рёбер в секунду в зависимости от числа потоков, аргумент - число
+// потоков; граф из 2^22 вершин не помещается в кэш
+const size_t kConcurrentVertices = 1 << 22;
+
+const std::vector<TDsuEdge>& concurrent_edges() {
+    static const std::vector<TDsuEdge> edges =
+        random_edges(kConcurrentVertices);
+    return edges;
+}
+
+void bm_concurrent_dsu(TBenchState& state) {
+    const std::vector<TDsuEdge>& edges = concurrent_edges();
+    TThreadPool pool(static_cast<size_t>(state.arg(0)));
+    while (state.keep_running()) {
+        TConcurrentDsu dsu(kConcurrentVertices);
+        parallel_unite(&pool, &dsu, edges.data(), edges.size());
+        do_not_optimize(dsu.find(0));
+    }
+    state.set_items_processed(state.iterations() * edges.size());
+}
+BENCHMARK(bm_concurrent_dsu)->apply(thread_counts);
+
+// однопоточный эталон для того же графа
+void bm_concurrent_dsu_baseline(TBenchState& state) {
+    const std::vector<TDsuEdge>& edges = concurrent_edges();
+    TDisjointSets<> dsu(kConcurrentVertices);
+    while (state.keep_running()) {
+        dsu.reset();
+        for (const TDsuEdge& edge : edges) {
+            dsu.unite(edge.a, edge.b);
+        }
+        do_not_optimize(dsu.set_count());
+    }
+    state.set_items_processed(state.iterations() * edges.size());
+}
+BENCHMARK(bm_concurrent_dsu_baseline);
+
+}  // namespace
@@ -0,0 +1,95 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_expression/expression.h"
+
+namespace {
+
+const size_t kRows = 1 << 16;
+
+// представительные формулы: от одной операции до длинной цепочки с
+// делением и константами, которые сворачиваются при компиляции
+const char* const kFormulas[] = {
+    "price * qty",
+    "price * qty * (1 + tax / 100)",
+    "(revenue - cost) / revenue",
+    "(price - discount) * qty / (1 + 2 * 0.5) + shipping * 1.2 - fee",
+};
+
+const std::vector<std::string> kColumns = {
+    "price", "qty", "tax", "revenue", "cost", "discount", "shipping", "fee"
+};
+
+struct TTable {
+    std::vector<std::vector<double>> data;
+    std::vector<const double*> columns;
+};
+
+const TTable& table() {
+    static const TTable instance = [] {
+        TTable result;
+        std::mt19937 gen(11);
+        std::uniform_real_distribution<double> value(1.0, 100.0);
+        for (size_t c = 0; c < kColumns.size(); c++) {
+            std::vector<double> column(kRows);
+            for (double& item : column) {
+                item = value(gen);
+            }
+            result.data.push_back(column);
+        }
+        for (const std::vector<double>& column : result.data) {
+            result.columns.push_back(column.data());
+        }
+        return result;
+    }();
+    return instance;
+}
+
+void bm_expression_batch(TBenchState& state) {
+    TCompiledExpression expression = compile_expression(
+        kFormulas[state.arg(0)], kColumns);
+    std::vector<double> result(kRows);
+    while (state.keep_running()) {
+        do_not_optimize(expression.evaluate_batch(
+            table().columns.data(), kRows, result.data()));
+        clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * kRows);
+    state.set_label(kFormulas[state.arg(0)]);
+}
+BENCHMARK(bm_expression_batch)->arg(0)->arg(1)->arg(2)->arg(3);
+
+// та же формула, но команда выбирается для каждой строки
+void bm_expression_row_by_row(TBenchState& state) {
+    TCompiledExpression expression = compile_expression(
+        kFormulas[state.arg(0)], kColumns);
+    std::vector<double> result(kRows);
+    std::vector<double> row(kColumns.size());
+    while (state.keep_running()) {
+        for (size_t i = 0; i < kRows; i++) {
+            for (size_t c = 0; c < kColumns.size(); c++) {
+                row[c] = table().columns[c][i];
+            }
+            result[i] = expression.try_evaluate(row.data()).value_or(0.0);
+        }
+        clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * kRows);
+    state.set_label(kFormulas[state.arg(0)]);
+}
+BENCHMARK(bm_expression_row_by_row)->arg(0)->arg(1)->arg(2)->arg(3);
+
+// разбор и компиляция формулы
+void bm_expression_compile(TBenchState& state) {
+    while (state.keep_running()) {
+        do_not_optimize(compile_expression(kFormulas[3], kColumns));
+    }
+    state.set_items_processed(state.iterations());
+}
+BENCHMARK(bm_expression_compile);
+
+}  // namespace
@@ -0,0 +1,104 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_hash_table/hash_map.h"
+
+namespace {
+
+// ёмкость таблицы THashMap во всех замерах; аргумент бенчмарка -
+// загрузка в тысячных долях (500 .. 875)
+const size_t kCapacity = 1 << 20;
+const size_t kQueries = 1 << 16;
+
+struct TLookupData {
+    std::vector<uint64_t> keys;
+    std::vector<uint64_t> hits;
+    std::vector<uint64_t> misses;
+};
+
+TLookupData make_data(int64_t load_permille) {
+    TLookupData data;
+    size_t count = kCapacity * static_cast<size_t>(load_permille) / 1000;
+    std::mt19937_64 gen(5);
+    for (size_t i = 0; i < count; i++) {
+        data.keys.push_back(gen() | 1);   // нечётные - присутствуют
+    }
+    std::uniform_int_distribution<size_t> index(0, count - 1);
+    for (size_t i = 0; i < kQueries; i++) {
+        data.hits.push_back(data.keys[index(gen)]);
+        data.misses.push_back(gen() & ~1ULL);  // чётные - отсутствуют
+    }
+    return data;
+}
+
+void add_load_factors(TBenchmark* benchmark) {
+    benchmark->arg(500)->arg(625)->arg(750)->arg(875);
+}
+
+template <class Map>
+void lookup(TBenchState& state, bool hit) {
+    TLookupData data = make_data(state.arg(0));
+    Map map;
+    map.reserve(data.keys.size());
+    for (uint64_t key : data.keys) {
+        map[key] = key;
+    }
+    const std::vector<uint64_t>& queries = hit ? data.hits : data.misses;
+    while (state.keep_running()) {
+        size_t found = 0;
+        for (uint64_t key : queries) {
+            found += map.count(key);
+        }
+        do_not_optimize(found);
+    }
+    state.set_items_processed(state.iterations() * kQueries);
+}
+
+void bm_hash_map_hit(TBenchState& state) {
+    lookup<THashMap<uint64_t, uint64_t>>(state, true);
+}
+BENCHMARK(bm_hash_map_hit)->apply(add_load_factors);
+
+void bm_hash_map_miss(TBenchState& state) {
+    lookup<THashMap<uint64_t, uint64_t>>(state, false);
+}
+BENCHMARK(bm_hash_map_miss)->apply(add_load_factors);
+
+void bm_unordered_map_hit(TBenchState& state) {
+    lookup<std::unordered_map<uint64_t, uint64_t>>(state, true);
+}
+BENCHMARK(bm_unordered_map_hit)->apply(add_load_factors);
+
+void bm_unordered_map_miss(TBenchState& state) {
+    lookup<std::unordered_map<uint64_t, uint64_t>>(state, false);
+}
+BENCHMARK(bm_unordered_map_miss)->apply(add_load_factors);
+
+template <class Map>
+void insert_all(TBenchState& state) {
+    TLookupData data = make_data(state.arg(0));
+    while (state.keep_running()) {
+        Map map;
+        for (uint64_t key : data.keys) {
+            map[key] = key;
+        }
+        do_not_optimize(map.size());
+    }
+    state.set_items_processed(state.iterations() * data.keys.size());
+}
+
+void bm_hash_map_insert(TBenchState& state) {
+    insert_all<THashMap<uint64_t, uint64_t>>(state);
+}
+BENCHMARK(bm_hash_map_insert)->arg(875);
+
+void bm_unordered_map_insert(TBenchState& state) {
+    insert_all<std::unordered_map<uint64_t, uint64_t>>(state);
+}
+BENCHMARK(bm_unordered_map_insert)->arg(875);
+
+}  // namespace
@@ -0,0 +1,238 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_heap/d_ary_heap.h"
+#include "../lib_heap/indexed_heap.h"
+#include "../lib_heap/pairing_heap.h"
+
+namespace {
+
+// модель «hold»: куча из arg(0) ключей, каждая операция снимает минимум
+// и кладёт его обратно с случайным приращением - размер не меняется, а
+// обращения расходятся по всему дереву, как в симуляции событий.
+// Ключи 64-битные: растущие на каждой операции 32-битные ключи со
+// временем переполнились бы, и модель перестала бы быть монотонной
+const size_t kHoldOperations = 1 << 20;
+
+void add_heap_sizes(TBenchmark* benchmark) {
+    benchmark->arg(1000000)->arg(10000000)->arg(100000000);
+}
+
+std::vector<uint64_t> random_keys(size_t count) {
+    std::mt19937 gen(29);
+    std::vector<uint64_t> keys(count);
+    for (uint64_t& key : keys) {
+        key = gen() >> 4;
+    }
+    return keys;
+}
+
+std::vector<uint32_t> random_increments() {
+    std::mt19937 gen(31);
+    std::vector<uint32_t> increments(kHoldOperations);
+    for (uint32_t& increment : increments) {
+        increment = gen() >> 8;
+    }
+    return increments;
+}
+
+template <size_t Arity>
+void d_ary_hold(TBenchState& state) {
+    std::vector<uint32_t> increments = random_increments();
+    TDaryHeap<uint64_t, Arity> heap(
+        random_keys(static_cast<size_t>(state.arg(0))));
+    while (state.keep_running()) {
+        for (uint32_t increment : increments) {
+            heap.replace_top(heap.top() + increment);
+        }
+        do_not_optimize(heap.top());
+    }
+    state.set_items_processed(state.iterations() * kHoldOperations);
+}
+
+void bm_d_ary_heap_hold_2(TBenchState& state) { d_ary_hold<2>(state); }
+BENCHMARK(bm_d_ary_heap_hold_2)->apply(add_heap_sizes);
+
+void bm_d_ary_heap_hold_4(TBenchState& state) { d_ary_hold<4>(state); }
+BENCHMARK(bm_d_ary_heap_hold_4)->apply(add_heap_sizes);
+
+void bm_d_ary_heap_hold_8(TBenchState& state) { d_ary_hold<8>(state); }
+BENCHMARK(bm_d_ary_heap_hold_8)->apply(add_heap_sizes);
+
+void bm_d_ary_heap_hold_16(TBenchState& state) { d_ary_hold<16>(state); }
+BENCHMARK(bm_d_ary_heap_hold_16)->apply(add_heap_sizes);
+
+void bm_priority_queue_hold(TBenchState& state) {
+    std::vector<uint32_t> increments = random_increments();
+    std::vector<uint64_t> keys = random_keys(static_cast<size_t>(state.arg(0)));
+    std::priority_queue<uint64_t, std::vector<uint64_t>,
+                        std::greater<uint64_t>>
+        heap(std::greater<uint64_t>(), std::move(keys));
+    while (state.keep_running()) {
+        for (uint32_t increment : increments) {
+            uint64_t top = heap.top();
+            heap.pop();
+            heap.push(top + increment);
+        }
+        do_not_optimize(heap.top());
+    }
+    state.set_items_processed(state.iterations() * kHoldOperations);
+}
+BENCHMARK(bm_priority_queue_hold)->apply(add_heap_sizes);
+
+// Дейкстра на случайном графе из arg(0) вершин со средней степенью 8
+struct TGraph {
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> targets;
+    std::vector<uint32_t> weights;
+};
+
+TGraph random_graph(size_t vertices) {
+    const size_t kDegree = 8;
+    std::mt19937 gen(37);
+    TGraph graph;
+    graph.offsets.push_back(0);
+    for (size_t v = 0; v < vertices; v++) {
+        for (size_t e = 0; e < kDegree; e++) {
+            graph.targets.push_back(static_cast<uint32_t>(gen() % vertices));
+            graph.weights.push_back(1 + gen() % 1000);
+        }
+        graph.offsets.push_back(static_cast<uint32_t>(graph.targets.size()));
+    }
+    return graph;
+}
+
+const uint64_t kInfinity = std::numeric_limits<uint64_t>::max();
+
+template <size_t Arity>
+void dijkstra_indexed(TBenchState& state) {
+    TGraph graph = random_graph(static_cast<size_t>(state.arg(0)));
+    size_t vertices = graph.offsets.size() - 1;
+    size_t peak = 0;
+    while (state.keep_running()) {
+        std::vector<uint64_t> distance(vertices, kInfinity);
+        TIndexedHeap<uint64_t, Arity> heap(vertices);
+        distance[0] = 0;
+        heap.push(0, 0);
+        while (!heap.empty()) {
+            uint64_t d = heap.top();
+            uint32_t v = heap.take();
+            for (uint32_t e = graph.offsets[v]; e < graph.offsets[v + 1];
+                 e++) {
+                uint32_t u = graph.targets[e];
+                uint64_t candidate = d + graph.weights[e];
+                if (candidate < distance[u]) {
+                    distance[u] = candidate;
+                    heap.push_or_decrease(u, candidate);
+                }
+            }
+            peak = std::max(peak, heap.size());
+        }
+        do_not_optimize(distance.back());
+    }
+    state.set_items_processed(state.iterations() * graph.targets.size());
+    state.set_counter("peak_heap_size", static_cast<double>(peak));
+}
+
+void bm_dijkstra_indexed_heap_2(TBenchState& state) {
+    dijkstra_indexed<2>(state);
+}
+BENCHMARK(bm_dijkstra_indexed_heap_2)->arg(1 << 16)->arg(1 << 20);
+
+void bm_dijkstra_indexed_heap_4(TBenchState& state) {
+    dijkstra_indexed<4>(state);
+}
+BENCHMARK(bm_dijkstra_indexed_heap_4)->arg(1 << 16)->arg(1 << 20);
+
+void bm_dijkstra_indexed_heap_8(TBenchState& state) {
+    dijkstra_indexed<8>(state);
+}
+BENCHMARK(bm_dijkstra_indexed_heap_8)->arg(1 << 16)->arg(1 << 20);
+
+// std::priority_queue без decrease-key: при каждом улучшении в очередь
+// кладётся дубликат, устаревшие записи пропускаются при снятии
+void bm_dijkstra_priority_queue(TBenchState& state) {
+    TGraph graph = random_graph(static_cast<size_t>(state.arg(0)));
+    size_t vertices = graph.offsets.size() - 1;
+    size_t peak = 0;
+    using TItem = std::pair<uint64_t, uint32_t>;
+    while (state.keep_running()) {
+        std::vector<uint64_t> distance(vertices, kInfinity);
+        std::priority_queue<TItem, std::vector<TItem>, std::greater<TItem>>
+            heap;
+        distance[0] = 0;
+        heap.push({ 0, 0 });
+        while (!heap.empty()) {
+            TItem item = heap.top();
+            heap.pop();
+            uint32_t v = item.second;
+            if (item.first != distance[v]) {
+                continue;
+            }
+            for (uint32_t e = graph.offsets[v]; e < graph.offsets[v + 1];
+                 e++) {
+                uint32_t u = graph.targets[e];
+                uint64_t candidate = item.first + graph.weights[e];
+                if (candidate < distance[u]) {
+                    distance[u] = candidate;
+                    heap.push({ candidate, u });
+                }
+            }
+            peak = std::max(peak, heap.size());
+        }
+        do_not_optimize(distance.back());
+    }
+    state.set_items_processed(state.iterations() * graph.targets.size());
+    state.set_counter("peak_heap_size", static_cast<double>(peak));
+}
+BENCHMARK(bm_dijkstra_priority_queue)->arg(1 << 16)->arg(1 << 20);
+
+void bm_dijkstra_pairing_heap(TBenchState& state) {
+    TGraph graph = random_graph(static_cast<size_t>(state.arg(0)));
+    size_t vertices = graph.offsets.size() - 1;
+    size_t peak = 0;
+    using TItem = std::pair<uint64_t, uint32_t>;
+    using THeap = TPairingHeap<TItem>;
+    while (state.keep_running()) {
+        std::vector<uint64_t> distance(vertices, kInfinity);
+        std::vector<THeap::THandle> handles(vertices);
+        std::vector<bool> queued(vertices, false);
+        THeap heap;
+        distance[0] = 0;
+        handles[0] = heap.push({ 0, 0 });
+        queued[0] = true;
+        while (!heap.empty()) {
+            TItem item = heap.take();
+            uint32_t v = item.second;
+            queued[v] = false;
+            for (uint32_t e = graph.offsets[v]; e < graph.offsets[v + 1];
+                 e++) {
+                uint32_t u = graph.targets[e];
+                uint64_t candidate = item.first + graph.weights[e];
+                if (candidate < distance[u]) {
+                    distance[u] = candidate;
+                    if (queued[u]) {
+                        heap.decrease_key(handles[u], { candidate, u });
+                    } else {
+                        handles[u] = heap.push({ candidate, u });
+                        queued[u] = true;
+                    }
+                }
+            }
+            peak = std::max(peak, heap.size());
+        }
+        do_not_optimize(distance.back());
+    }
+    state.set_items_processed(state.iterations() * graph.targets.size());
+    state.set_counter("peak_heap_size", static_cast<double>(peak));
+}
+BENCHMARK(bm_dijkstra_pairing_heap)->arg(1 << 16)->arg(1 << 20);
+
+}  // namespace
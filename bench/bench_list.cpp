@@ -0,0 +1,168 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_list/intrusive_list.h"
+#include "../lib_list/pool_list.h"
+
+namespace {
+
+const size_t kTouches = 1 << 16;
+
+std::vector<uint32_t> random_indices(size_t count, size_t limit) {
+    std::mt19937 gen(17);
+    std::uniform_int_distribution<uint32_t> index(
+        0, static_cast<uint32_t>(limit - 1));
+    std::vector<uint32_t> result(count);
+    for (uint32_t& value : result) {
+        value = index(gen);
+    }
+    return result;
+}
+
+struct TEntry : TListHook<> {
+    uint64_t key = 0;
+    uint64_t payload[3] = {};
+};
+
+// LRU: обращение к записи переносит её в начало списка, аргумент -
+// число записей
+void bm_intrusive_list_lru_touch(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    std::vector<TEntry> entries(count);
+    TIntrusiveList<TEntry> lru;
+    for (TEntry& entry : entries) {
+        lru.push_back(entry);
+    }
+    std::vector<uint32_t> touches = random_indices(kTouches, count);
+    while (state.keep_running()) {
+        for (uint32_t index : touches) {
+            lru.splice(lru.begin(), lru, lru.iterator_to(entries[index]));
+        }
+        do_not_optimize(lru.back().key);
+    }
+    state.set_items_processed(state.iterations() * kTouches);
+}
+BENCHMARK(bm_intrusive_list_lru_touch)->range(1 << 10, 1 << 20, 32);
+
+template <class List>
+void lru_touch(TBenchState& state, List lru) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    std::vector<typename List::iterator> positions;
+    for (size_t i = 0; i < count; i++) {
+        lru.push_back(i);
+        positions.push_back(std::prev(lru.end()));
+    }
+    std::vector<uint32_t> touches = random_indices(kTouches, count);
+    while (state.keep_running()) {
+        for (uint32_t index : touches) {
+            lru.splice(lru.begin(), lru, positions[index]);
+        }
+        do_not_optimize(lru.back());
+    }
+    state.set_items_processed(state.iterations() * kTouches);
+}
+
+void bm_pool_list_lru_touch(TBenchState& state) {
+    lru_touch(state, TPoolList<uint64_t>());
+}
+BENCHMARK(bm_pool_list_lru_touch)->range(1 << 10, 1 << 20, 32);
+
+void bm_std_list_lru_touch(TBenchState& state) {
+    lru_touch(state, std::list<uint64_t>());
+}
+BENCHMARK(bm_std_list_lru_touch)->range(1 << 10, 1 << 20, 32);
+
+// очередь задач планировщика: постановка в конец и снятие из начала,
+// аргумент - число задач в очереди
+template <class List>
+void push_pop(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    List list;
+    for (size_t i = 0; i < count; i++) {
+        list.push_back(i);
+    }
+    while (state.keep_running()) {
+        for (size_t i = 0; i < kTouches; i++) {
+            uint64_t value = list.front();
+            list.pop_front();
+            list.push_back(value + 1);
+        }
+        do_not_optimize(list.back());
+    }
+    state.set_items_processed(state.iterations() * kTouches);
+}
+
+void bm_pool_list_push_pop(TBenchState& state) {
+    push_pop<TPoolList<uint64_t>>(state);
+}
+BENCHMARK(bm_pool_list_push_pop)->arg(1 << 10)->arg(1 << 20);
+
+void bm_std_list_push_pop(TBenchState& state) {
+    push_pop<std::list<uint64_t>>(state);
+}
+BENCHMARK(bm_std_list_push_pop)->arg(1 << 10)->arg(1 << 20);
+
+// полный проход по списку, узлы которого создавались вперемешку с
+// другими выделениями памяти (как в долго работающей программе)
+template <class List>
+void traverse(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    List list;
+    std::vector<std::unique_ptr<uint64_t[]>> noise;
+    std::mt19937 gen(4);
+    for (size_t i = 0; i < count; i++) {
+        list.push_back(i);
+        noise.emplace_back(new uint64_t[1 + gen() % 8]);
+    }
+    noise.clear();
+    while (state.keep_running()) {
+        uint64_t sum = 0;
+        for (uint64_t value : list) {
+            sum += value;
+        }
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+
+void bm_pool_list_traverse(TBenchState& state) {
+    traverse<TPoolList<uint64_t>>(state);
+}
+BENCHMARK(bm_pool_list_traverse)->range(1 << 10, 1 << 20, 32);
+
+void bm_std_list_traverse(TBenchState& state) {
+    traverse<std::list<uint64_t>>(state);
+}
+BENCHMARK(bm_std_list_traverse)->range(1 << 10, 1 << 20, 32);
+
+template <class List>
+void sort_list(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    std::vector<uint32_t> keys = random_indices(count, count);
+    while (state.keep_running()) {
+        List list;
+        for (uint32_t key : keys) {
+            list.push_back(key);
+        }
+        list.sort();
+        do_not_optimize(list.front());
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+
+void bm_pool_list_sort(TBenchState& state) {
+    sort_list<TPoolList<uint32_t>>(state);
+}
+BENCHMARK(bm_pool_list_sort)->arg(1 << 16)->arg(1 << 20);
+
+void bm_std_list_sort(TBenchState& state) {
+    sort_list<std::list<uint32_t>>(state);
+}
+BENCHMARK(bm_std_list_sort)->arg(1 << 16)->arg(1 << 20);
+
+}  // namespace
@@ -0,0 +1,11 @@
+// Copyright 2024 Marina Usova
+
+#include "../bench/benchmark.h"
+
+int main(int argc, char** argv) {
+    TBenchOptions options;
+    if (!parse_bench_options(argc, argv, &options)) {
+        return 1;
+    }
+    return run_benchmarks(options);
+}
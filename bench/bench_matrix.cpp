@@ -0,0 +1,88 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <random>
+#include "../bench/benchmark.h"
+#include "../lib_matrix/matrix.h"
+#include "../lib_matrix/triangular_matrix.h"
+
+namespace {
+
+template <class T>
+TMatrix<T> random_matrix(size_t n) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<T> value(-1, 1);
+    TMatrix<T> result(n, n);
+    for (size_t i = 0; i < result.size(); i++) {
+        result.data()[i] = value(gen);
+    }
+    return result;
+}
+
+// 2n^3 операций с плавающей точкой на умножение n x n; GFLOP/s
+// попадают в отчёт как элементы в секунду, делённые на 1e9
+template <class T>
+void square_gemm(TBenchState& state, GemmKernel kernel) {
+    size_t n = static_cast<size_t>(state.arg(0));
+    TMatrix<T> a = random_matrix<T>(n);
+    TMatrix<T> b = random_matrix<T>(n);
+    TMatrix<T> c(n, n);
+    while (state.keep_running()) {
+        gemm(n, n, n, a.data(), n, b.data(), n, c.data(), n, kernel);
+        clobber_memory();
+    }
+    double flops = 2.0 * n * n * n;
+    state.set_items_processed(
+        static_cast<int64_t>(flops * state.iterations()));
+    state.set_counter("gflops", flops * state.iterations() /
+                                state.elapsed_ns());
+}
+
+void bm_gemm_float_avx2(TBenchState& state) {
+    square_gemm<float>(state, GemmKernel::kAvx2Fma);
+}
+BENCHMARK(bm_gemm_float_avx2)->range(64, 2048);
+
+void bm_gemm_float_scalar(TBenchState& state) {
+    square_gemm<float>(state, GemmKernel::kScalar);
+}
+BENCHMARK(bm_gemm_float_scalar)->range(64, 2048);
+
+void bm_gemm_double_avx2(TBenchState& state) {
+    square_gemm<double>(state, GemmKernel::kAvx2Fma);
+}
+BENCHMARK(bm_gemm_double_avx2)->range(64, 2048);
+
+// тройной цикл i-k-j без блоков, для сравнения
+void bm_multiply_naive_float(TBenchState& state) {
+    size_t n = static_cast<size_t>(state.arg(0));
+    TMatrix<float> a = random_matrix<float>(n);
+    TMatrix<float> b = random_matrix<float>(n);
+    while (state.keep_running()) {
+        do_not_optimize(multiply_naive(a, b));
+    }
+    double flops = 2.0 * n * n * n;
+    state.set_items_processed(
+        static_cast<int64_t>(flops * state.iterations()));
+    state.set_counter("gflops", flops * state.iterations() /
+                                state.elapsed_ns());
+}
+BENCHMARK(bm_multiply_naive_float)->range(64, 1024);
+
+// треугольная матрица на плотную: вдвое меньше операций, чем у gemm
+void bm_triangular_multiply_double(TBenchState& state) {
+    size_t n = static_cast<size_t>(state.arg(0));
+    TUpperTriangularMatrix<double> a(random_matrix<double>(n));
+    TMatrix<double> b = random_matrix<double>(n);
+    while (state.keep_running()) {
+        do_not_optimize(multiply(a, b));
+    }
+    double flops = 1.0 * n * (n + 1) * n;
+    state.set_items_processed(
+        static_cast<int64_t>(flops * state.iterations()));
+    state.set_counter("gflops", flops * state.iterations() /
+                                state.elapsed_ns());
+}
+BENCHMARK(bm_triangular_multiply_double)->range(64, 1024);
+
+}  // namespace
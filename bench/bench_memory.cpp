@@ -0,0 +1,99 @@
+// Copyright 2024 Marina Usova
+
+#include <list>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_memory/arena.h"
+#include "../lib_memory/pool.h"
+
+namespace {
+
+// небольшая структура, каких много создаётся при обработке запроса
+struct TNode {
+    int64_t key;
+    double value;
+    TNode* next;
+};
+
+// выделить много объектов, затем освободить все разом
+void bm_new_delete_many(TBenchState& state) {
+    const int64_t count = state.arg(0);
+    std::vector<TNode*> nodes(count);
+    while (state.keep_running()) {
+        for (int64_t i = 0; i < count; i++) {
+            nodes[i] = new TNode{ i, 0.5, nullptr };
+        }
+        do_not_optimize(nodes.data());
+        for (int64_t i = 0; i < count; i++) {
+            delete nodes[i];
+        }
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_new_delete_many)->range(64, 65536, 32);
+
+void bm_arena_many(TBenchState& state) {
+    const int64_t count = state.arg(0);
+    std::vector<TNode*> nodes(count);
+    TArena arena;
+    while (state.keep_running()) {
+        for (int64_t i = 0; i < count; i++) {
+            nodes[i] = arena.create<TNode>(TNode{ i, 0.5, nullptr });
+        }
+        do_not_optimize(nodes.data());
+        arena.reset();
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_arena_many)->range(64, 65536, 32);
+
+void bm_pool_many(TBenchState& state) {
+    const int64_t count = state.arg(0);
+    std::vector<TNode*> nodes(count);
+    TObjectPool<TNode> pool;
+    while (state.keep_running()) {
+        for (int64_t i = 0; i < count; i++) {
+            nodes[i] = pool.create(TNode{ i, 0.5, nullptr });
+        }
+        do_not_optimize(nodes.data());
+        for (int64_t i = 0; i < count; i++) {
+            pool.destroy(nodes[i]);
+        }
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_pool_many)->range(64, 65536, 32);
+
+// контейнер стандартной библиотеки с аллокатором по умолчанию и с ареной
+void bm_std_list_default_allocator(TBenchState& state) {
+    const int64_t count = state.arg(0);
+    while (state.keep_running()) {
+        std::list<int64_t> list;
+        for (int64_t i = 0; i < count; i++) {
+            list.push_back(i);
+        }
+        do_not_optimize(list.back());
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_std_list_default_allocator)->arg(4096);
+
+void bm_std_list_arena_allocator(TBenchState& state) {
+    const int64_t count = state.arg(0);
+    TArena arena;
+    while (state.keep_running()) {
+        {
+            TArenaAllocator<int64_t> allocator(&arena);
+            std::list<int64_t, TArenaAllocator<int64_t>> list(allocator);
+            for (int64_t i = 0; i < count; i++) {
+                list.push_back(i);
+            }
+            do_not_optimize(list.back());
+        }
+        arena.reset();
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_std_list_arena_allocator)->arg(4096);
+
+}  // namespace
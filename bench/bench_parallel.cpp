@@ -0,0 +1,66 @@
+// Copyright 2024 Marina Usova
+
+#include <cmath>
+#include <cstdint>
+#include <thread>  // NOLINT [build/c++11]
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_parallel/parallel_division.h"
+#include "../lib_parallel/thread_pool.h"
+
+namespace {
+
+void bm_parallel_division_scaling(TBenchState& state) {
+    const size_t count = 1 << 24;
+    std::vector<int> a(count), b(count);
+    for (size_t i = 0; i < count; i++) {
+        a[i] = static_cast<int>(i);
+        b[i] = static_cast<int>(i % 1000) + 1;
+    }
+    std::vector<float> result(count);
+    TThreadPool pool(static_cast<size_t>(state.arg(0)));
+    while (state.keep_running()) {
+        do_not_optimize(parallel_division(&pool, a.data(), b.data(),
+                                          result.data(), count));
+        clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * count);
+    state.set_bytes_processed(state.iterations() * count * 12);
+}
+BENCHMARK(bm_parallel_division_scaling)->apply(thread_counts);
+
+// вычислительно тяжёлое тело: масштабирование без упора в память
+void bm_parallel_reduce_scaling(TBenchState& state) {
+    const size_t count = 1 << 22;
+    TThreadPool pool(static_cast<size_t>(state.arg(0)));
+    while (state.keep_running()) {
+        double sum = pool.parallel_reduce(
+            0, count, 4096, 0.0,
+            [](size_t lo, size_t hi) {
+                double partial = 0;
+                for (size_t i = lo; i < hi; i++) {
+                    partial += std::sqrt(static_cast<double>(i));
+                }
+                return partial;
+            },
+            [](double left, double right) { return left + right; });
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_parallel_reduce_scaling)->apply(thread_counts);
+
+// накладные расходы планировщика на мелких кусках
+void bm_parallel_for_overhead(TBenchState& state) {
+    TThreadPool pool(static_cast<size_t>(state.arg(0)));
+    while (state.keep_running()) {
+        pool.parallel_for(0, 1 << 16, 64, [](size_t lo, size_t hi) {
+            do_not_optimize(lo + hi);
+        });
+    }
+    state.set_items_processed(state.iterations() * (1 << 16) / 64);
+    state.set_label("tasks");
+}
+BENCHMARK(bm_parallel_for_overhead)->apply(thread_counts);
+
+}  // namespace
@@ -0,0 +1,93 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_polynomial/polynomial.h"
+
+namespace {
+
+std::vector<TModInt> random_coefficients(size_t size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::vector<TModInt> result(size);
+    for (TModInt& value : result) {
+        value = TModInt(gen());
+    }
+    return result;
+}
+
+// Сравнение алгоритмов умножения на одинаковых длинах: по точкам
+// пересечения выбраны kKaratsubaThreshold и kTransformThreshold
+// в polynomial_multiply.h
+void multiply_with(TBenchState& state, MultiplyAlgorithm algorithm) {
+    size_t n = static_cast<size_t>(state.arg(0));
+    std::vector<TModInt> a = random_coefficients(n, 1);
+    std::vector<TModInt> b = random_coefficients(n, 2);
+    while (state.keep_running()) {
+        do_not_optimize(multiply_coefficients(a, b, algorithm));
+    }
+    state.set_items_processed(state.iterations() * n);
+}
+
+void bm_polynomial_multiply_schoolbook(TBenchState& state) {
+    multiply_with(state, MultiplyAlgorithm::kSchoolbook);
+}
+BENCHMARK(bm_polynomial_multiply_schoolbook)->range(8, 8192);
+
+void bm_polynomial_multiply_karatsuba(TBenchState& state) {
+    multiply_with(state, MultiplyAlgorithm::kKaratsuba);
+}
+BENCHMARK(bm_polynomial_multiply_karatsuba)->range(8, 32768);
+
+void bm_polynomial_multiply_ntt(TBenchState& state) {
+    multiply_with(state, MultiplyAlgorithm::kTransform);
+}
+BENCHMARK(bm_polynomial_multiply_ntt)->range(8, 1 << 17);
+
+void bm_polynomial_multiply_auto(TBenchState& state) {
+    multiply_with(state, MultiplyAlgorithm::kAuto);
+}
+BENCHMARK(bm_polynomial_multiply_auto)->range(8, 1 << 17);
+
+void bm_polynomial_multiply_fft_double(TBenchState& state) {
+    size_t n = static_cast<size_t>(state.arg(0));
+    std::vector<double> a(n, 1.5);
+    std::vector<double> b(n, -0.5);
+    while (state.keep_running()) {
+        do_not_optimize(
+            multiply_coefficients(a, b, MultiplyAlgorithm::kTransform));
+    }
+    state.set_items_processed(state.iterations() * n);
+}
+BENCHMARK(bm_polynomial_multiply_fft_double)->range(64, 1 << 17, 8);
+
+// вычисление многочлена степени n - 1 в 4096 точках: по одной точке
+// против пачек по 8 независимых цепочек Горнера
+void bm_polynomial_evaluate_single(TBenchState& state) {
+    size_t n = static_cast<size_t>(state.arg(0));
+    TPolynomial<double> p(std::vector<double>(n, 0.999));
+    std::vector<double> points(4096, 0.5);
+    while (state.keep_running()) {
+        double sum = 0;
+        for (double x : points) {
+            sum += p.evaluate(x);
+        }
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * n * points.size());
+}
+BENCHMARK(bm_polynomial_evaluate_single)->arg(16)->arg(256);
+
+void bm_polynomial_evaluate_batch(TBenchState& state) {
+    size_t n = static_cast<size_t>(state.arg(0));
+    TPolynomial<double> p(std::vector<double>(n, 0.999));
+    std::vector<double> points(4096, 0.5);
+    while (state.keep_running()) {
+        do_not_optimize(p.evaluate(points));
+    }
+    state.set_items_processed(state.iterations() * n * points.size());
+}
+BENCHMARK(bm_polynomial_evaluate_batch)->arg(16)->arg(256);
+
+}  // namespace
@@ -0,0 +1,98 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <deque>
+#include <queue>
+#include "../bench/benchmark.h"
+#include "../lib_deque/chunked_deque.h"
+#include "../lib_queue/queue.h"
+
+namespace {
+
+// TChunkedDeque с интерфейсом очереди, чтобы мерить его тем же кодом
+template <class T>
+class TChunkedQueue {
+ public:
+    void push(const T& value) { deque_.push_back(value); }
+    void pop() { deque_.pop_front(); }
+    const T& front() const { return deque_.front(); }
+    bool empty() const { return deque_.empty(); }
+    size_t size() const { return deque_.size(); }
+
+ private:
+    TChunkedDeque<T> deque_;
+};
+
+// аргумент - число элементов, которое ставится в очередь и снимается
+template <class Queue>
+void push_pop(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    while (state.keep_running()) {
+        Queue queue;
+        for (size_t i = 0; i < count; i++) {
+            queue.push(i);
+        }
+        uint64_t sum = 0;
+        while (!queue.empty()) {
+            sum += queue.front();
+            queue.pop();
+        }
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+
+void bm_queue_push_pop(TBenchState& state) {
+    push_pop<TQueue<uint64_t>>(state);
+}
+BENCHMARK(bm_queue_push_pop)->range(1 << 10, 1 << 22, 16);
+
+void bm_chunked_queue_push_pop(TBenchState& state) {
+    push_pop<TChunkedQueue<uint64_t>>(state);
+}
+BENCHMARK(bm_chunked_queue_push_pop)->range(1 << 10, 1 << 22, 16);
+
+void bm_std_queue_push_pop(TBenchState& state) {
+    push_pop<std::queue<uint64_t>>(state);
+}
+BENCHMARK(bm_std_queue_push_pop)->range(1 << 10, 1 << 22, 16);
+
+// фронт обхода в ширину: очередь постоянного размера arg(0), на каждый
+// снятый элемент ставится новый - голова и хвост непрерывно сдвигаются
+template <class Queue>
+void sliding(TBenchState& state) {
+    const size_t kSteps = 1 << 20;
+    size_t width = static_cast<size_t>(state.arg(0));
+    Queue queue;
+    for (size_t i = 0; i < width; i++) {
+        queue.push(i);
+    }
+    while (state.keep_running()) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < kSteps; i++) {
+            uint64_t value = queue.front();
+            queue.pop();
+            sum += value;
+            queue.push(value + 1);
+        }
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * kSteps);
+}
+
+void bm_queue_sliding(TBenchState& state) {
+    sliding<TQueue<uint64_t>>(state);
+}
+BENCHMARK(bm_queue_sliding)->range(1 << 6, 1 << 18, 16);
+
+void bm_chunked_queue_sliding(TBenchState& state) {
+    sliding<TChunkedQueue<uint64_t>>(state);
+}
+BENCHMARK(bm_chunked_queue_sliding)->range(1 << 6, 1 << 18, 16);
+
+void bm_std_queue_sliding(TBenchState& state) {
+    sliding<std::queue<uint64_t>>(state);
+}
+BENCHMARK(bm_std_queue_sliding)->range(1 << 6, 1 << 18, 16);
+
+}  // namespace
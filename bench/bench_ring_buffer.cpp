@@ -0,0 +1,87 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <mutex>  // NOLINT [build/c++11]
+#include <queue>
+#include <thread>  // NOLINT [build/c++11]
+#include "../bench/benchmark.h"
+#include "../lib_ring_buffer/ring_buffer.h"
+
+namespace {
+
+const uint64_t kItems = 1 << 20;
+
+// прежняя схема: std::queue под мьютексом
+void bm_mutex_queue_throughput(TBenchState& state) {
+    while (state.keep_running()) {
+        std::queue<uint64_t> queue;
+        std::mutex mutex;
+        std::thread producer([&queue, &mutex]() {
+            for (uint64_t i = 0; i < kItems; i++) {
+                std::lock_guard<std::mutex> lock(mutex);
+                queue.push(i);
+            }
+        });
+        uint64_t received = 0;
+        uint64_t sum = 0;
+        while (received < kItems) {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (queue.empty()) {
+                lock.unlock();
+                std::this_thread::yield();
+                continue;
+            }
+            sum += queue.front();
+            queue.pop();
+            received++;
+        }
+        producer.join();
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * kItems);
+}
+BENCHMARK(bm_mutex_queue_throughput);
+
+// аргумент - размер пакета (1 - поштучные try_push/try_pop)
+void bm_spsc_ring_buffer_throughput(TBenchState& state) {
+    const size_t batch = static_cast<size_t>(state.arg(0));
+    TSpscRingBuffer<uint64_t> queue(4096);
+    while (state.keep_running()) {
+        std::thread producer([&queue, batch]() {
+            uint64_t items[256];
+            for (uint64_t next = 0; next < kItems; next += batch) {
+                for (size_t i = 0; i < batch; i++) {
+                    items[i] = next + i;
+                }
+                size_t pushed = 0;
+                while (pushed < batch) {
+                    size_t done = queue.push_batch(items + pushed,
+                                                   batch - pushed);
+                    if (done == 0) {
+                        std::this_thread::yield();
+                    }
+                    pushed += done;
+                }
+            }
+        });
+        uint64_t items[256];
+        uint64_t received = 0;
+        uint64_t sum = 0;
+        while (received < kItems) {
+            size_t popped = queue.pop_batch(items, batch);
+            if (popped == 0) {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < popped; i++) {
+                sum += items[i];
+            }
+            received += popped;
+        }
+        producer.join();
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * kItems);
+}
+BENCHMARK(bm_spsc_ring_buffer_throughput)->arg(1)->arg(16)->arg(256);
+
+}  // namespace
@@ -0,0 +1,132 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_search/eytzinger.h"
+#include "../lib_search/search.h"
+
+namespace {
+
+// i-й ключ массива: шаг 8 со случайным сдвигом - ключи почти
+// равномерны (удобно интерполяции), между ними есть промахи
+uint32_t search_key_at(uint64_t index) {
+    uint64_t mixed = index * 0x9E3779B97F4A7C15ull;
+    return static_cast<uint32_t>(index * 8 + (mixed >> 61));
+}
+
+// размеры массива 32-битных ключей от 4 КБ (L1) до 128 МБ (далеко за
+// последним уровнем кэша)
+void add_sizes(TBenchmark* benchmark) {
+    for (int64_t count = 1 << 10; count <= (1 << 26); count *= 8) {
+        benchmark->arg(count);
+    }
+}
+
+// массивы по размеру строятся один раз; держится только последний
+const std::vector<uint32_t>& cached_values(size_t count) {
+    static std::vector<uint32_t> values;
+    if (values.size() != count) {
+        values.clear();
+        values.shrink_to_fit();
+        values.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            values[i] = search_key_at(i);
+        }
+    }
+    return values;
+}
+
+const TEytzingerArray<uint32_t>& cached_layout(size_t count) {
+    static std::unique_ptr<TEytzingerArray<uint32_t>> layout;
+    if (layout == nullptr || layout->size() != count) {
+        layout.reset();
+        const std::vector<uint32_t>& values = cached_values(count);
+        layout.reset(new TEytzingerArray<uint32_t>(values.data(), count));
+    }
+    return *layout;
+}
+
+// случайные запросы по всему диапазону ключей
+std::vector<uint32_t> make_queries(size_t count) {
+    std::mt19937 gen(1);
+    std::vector<uint32_t> queries(4096);
+    for (uint32_t& query : queries) {
+        query = static_cast<uint32_t>(gen() % (count * 8));
+    }
+    return queries;
+}
+
+template <class Search>
+void search_loop(TBenchState& state, Search search) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    std::vector<uint32_t> queries = make_queries(count);
+    while (state.keep_running()) {
+        size_t sum = 0;
+        for (uint32_t query : queries) {
+            sum += search(query);
+        }
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * queries.size());
+    state.set_counter("array_kb", static_cast<double>(count * 4 / 1024));
+}
+
+void bm_search_std_lower_bound(TBenchState& state) {
+    const std::vector<uint32_t>& values =
+        cached_values(static_cast<size_t>(state.arg(0)));
+    search_loop(state, [&values](uint32_t key) {
+        return static_cast<size_t>(
+            std::lower_bound(values.begin(), values.end(), key) -
+            values.begin());
+    });
+}
+BENCHMARK(bm_search_std_lower_bound)->apply(add_sizes);
+
+void bm_search_branchless(TBenchState& state) {
+    const std::vector<uint32_t>& values =
+        cached_values(static_cast<size_t>(state.arg(0)));
+    search_loop(state, [&values](uint32_t key) {
+        return branchless_lower_bound(values.data(), values.size(), key);
+    });
+}
+BENCHMARK(bm_search_branchless)->apply(add_sizes);
+
+void bm_search_eytzinger(TBenchState& state) {
+    const TEytzingerArray<uint32_t>& layout =
+        cached_layout(static_cast<size_t>(state.arg(0)));
+    search_loop(state, [&layout](uint32_t key) {
+        return layout.lower_bound(key);
+    });
+}
+BENCHMARK(bm_search_eytzinger)->apply(add_sizes);
+
+void bm_search_interpolation(TBenchState& state) {
+    const std::vector<uint32_t>& values =
+        cached_values(static_cast<size_t>(state.arg(0)));
+    search_loop(state, [&values](uint32_t key) {
+        return interpolation_search(values.data(), values.size(), key);
+    });
+}
+BENCHMARK(bm_search_interpolation)->apply(add_sizes);
+
+// все запросы одним вызовом: группы по kSearchBatch идут вместе
+void bm_search_batch(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    const std::vector<uint32_t>& values = cached_values(count);
+    std::vector<uint32_t> queries = make_queries(count);
+    std::vector<size_t> results(queries.size());
+    while (state.keep_running()) {
+        batch_lower_bound(values.data(), values.size(), queries.data(),
+                          queries.size(), results.data());
+        clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * queries.size());
+    state.set_counter("array_kb", static_cast<double>(count * 4 / 1024));
+}
+BENCHMARK(bm_search_batch)->apply(add_sizes);
+
+}  // namespace
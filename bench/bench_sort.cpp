@@ -0,0 +1,138 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_parallel/thread_pool.h"
+#include "../lib_sort/parallel_sort.h"
+#include "../lib_sort/pdq_sort.h"
+#include "../lib_sort/radix_sort.h"
+
+namespace {
+
+// распределение входа - второй аргумент бенчмарков сетки
+enum class Distribution {
+    kRandom, kSorted, kReversed, kFewUnique, kSmallRange
+};
+
+std::vector<uint64_t> make_input(size_t count, Distribution distribution) {
+    std::mt19937_64 gen(1);
+    std::vector<uint64_t> values(count);
+    for (size_t i = 0; i < count; i++) {
+        switch (distribution) {
+        case Distribution::kRandom:
+            values[i] = gen();
+            break;
+        case Distribution::kSorted:
+            values[i] = i;
+            break;
+        case Distribution::kReversed:
+            values[i] = count - i;
+            break;
+        case Distribution::kFewUnique:
+            values[i] = gen() % 16;
+            break;
+        case Distribution::kSmallRange:
+            // два младших байта: radix_sort пропускает остальные шесть
+            values[i] = gen() % 65536;
+            break;
+        }
+    }
+    return values;
+}
+
+// размеры 2^10, 2^16, 2^22 (последний не помещается в L2) на все
+// распределения
+void add_grid(TBenchmark* benchmark) {
+    for (int64_t count : { 1 << 10, 1 << 16, 1 << 22 }) {
+        for (int64_t distribution = 0; distribution < 5; distribution++) {
+            benchmark->args({ count, distribution });
+        }
+    }
+}
+
+// сортировка копии входа; копирование не измеряется
+template <class Sort>
+void sort_grid(TBenchState& state, Sort sort) {
+    std::vector<uint64_t> input =
+        make_input(static_cast<size_t>(state.arg(0)),
+                   static_cast<Distribution>(state.arg(1)));
+    std::vector<uint64_t> values(input.size());
+    while (state.keep_running()) {
+        state.pause_timing();
+        std::copy(input.begin(), input.end(), values.begin());
+        state.resume_timing();
+        sort(values.data(), values.size());
+        clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * input.size());
+}
+
+void bm_std_sort(TBenchState& state) {
+    sort_grid(state, [](uint64_t* data, size_t count) {
+        std::sort(data, data + count);
+    });
+}
+BENCHMARK(bm_std_sort)->apply(add_grid);
+
+void bm_pdq_sort(TBenchState& state) {
+    sort_grid(state, [](uint64_t* data, size_t count) {
+        pdq_sort(data, count);
+    });
+}
+BENCHMARK(bm_pdq_sort)->apply(add_grid);
+
+void bm_radix_sort(TBenchState& state) {
+    sort_grid(state, [](uint64_t* data, size_t count) {
+        radix_sort(data, count);
+    });
+}
+BENCHMARK(bm_radix_sort)->apply(add_grid);
+
+// масштабируемость по числу потоков (третий аргумент) на той же сетке
+// размеров и распределений; один поток - pdq_sort и std::stable_sort
+// соответственно
+void add_parallel_grid(TBenchmark* benchmark) {
+    for (int64_t count : { 1 << 10, 1 << 16, 1 << 22 }) {
+        for (int64_t distribution = 0; distribution < 5; distribution++) {
+            for (int64_t threads : thread_count_values()) {
+                benchmark->args({ count, distribution, threads });
+            }
+        }
+    }
+}
+
+template <class Sort>
+void sort_threads(TBenchState& state, Sort sort) {
+    std::vector<uint64_t> input =
+        make_input(static_cast<size_t>(state.arg(0)),
+                   static_cast<Distribution>(state.arg(1)));
+    std::vector<uint64_t> values(input.size());
+    TThreadPool pool(static_cast<size_t>(state.arg(2)));
+    while (state.keep_running()) {
+        state.pause_timing();
+        std::copy(input.begin(), input.end(), values.begin());
+        state.resume_timing();
+        sort(&pool, values.data(), values.size());
+        clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * input.size());
+}
+
+void bm_parallel_sort(TBenchState& state) {
+    sort_threads(state, [](TThreadPool* pool, uint64_t* data, size_t count) {
+        parallel_sort(pool, data, count);
+    });
+}
+BENCHMARK(bm_parallel_sort)->apply(add_parallel_grid);
+
+void bm_parallel_stable_sort(TBenchState& state) {
+    sort_threads(state, [](TThreadPool* pool, uint64_t* data, size_t count) {
+        parallel_stable_sort(pool, data, count);
+    });
+}
+BENCHMARK(bm_parallel_stable_sort)->apply(add_parallel_grid);
+
+}  // namespace
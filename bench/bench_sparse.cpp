@@ -0,0 +1,147 @@
+// Copyright 2024 Marina Usova
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_sparse/parallel_spmv.h"
+#include "../lib_sparse/sparse_matrix.h"
+
+namespace {
+
+const size_t kRows = 1 << 18;
+const size_t kAverageNonzeros = 16;
+
+// матрица со степенным распределением длин строк (закон Ципфа, как у
+// графов соцсетей и веб-ссылок): немногие строки содержат большую часть
+// ненулевых; столбцы тоже тяготеют к малым номерам
+TCsrMatrix<double> power_law_matrix(size_t rows, double exponent) {
+    std::mt19937_64 gen(7);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> weights(rows);
+    double total = 0;
+    for (size_t i = 0; i < rows; i++) {
+        weights[i] = 1.0 / std::pow(static_cast<double>(i + 1), exponent);
+        total += weights[i];
+    }
+    TCooMatrix<double> coo(rows, rows);
+    coo.reserve(rows * kAverageNonzeros);
+    double scale = static_cast<double>(rows * kAverageNonzeros) / total;
+    for (size_t i = 0; i < rows; i++) {
+        // строки перемешиваются, чтобы «хабы» не шли подряд в начале
+        size_t row = (i * 2654435761u) % rows;
+        size_t count = static_cast<size_t>(weights[i] * scale) + 1;
+        count = std::min(count, rows);
+        for (size_t k = 0; k < count; k++) {
+            double u = uniform(gen);
+            size_t col = static_cast<size_t>(rows * u * u * u);
+            coo.add(row, std::min(col, rows - 1), uniform(gen));
+        }
+    }
+    return coo.to_csr();
+}
+
+const TCsrMatrix<double>& cached_matrix() {
+    static const TCsrMatrix<double> matrix = power_law_matrix(kRows, 1.0);
+    return matrix;
+}
+
+// байт на ненулевой элемент у CSR против плотного хранения
+void bm_sparse_memory_footprint(TBenchState& state) {
+    const TCsrMatrix<double>& a = cached_matrix();
+    while (state.keep_running()) {
+        do_not_optimize(a.memory_bytes());
+    }
+    double dense = static_cast<double>(kRows) * kRows * sizeof(double);
+    state.set_counter("nonzeros", static_cast<double>(a.nonzeros()));
+    state.set_counter("csr_bytes", static_cast<double>(a.memory_bytes()));
+    state.set_counter("dense_bytes", dense);
+    state.set_counter("bytes_per_nonzero",
+                      static_cast<double>(a.memory_bytes()) / a.nonzeros());
+}
+BENCHMARK(bm_sparse_memory_footprint);
+
+void bm_spmv_csr(TBenchState& state) {
+    const TCsrMatrix<double>& a = cached_matrix();
+    std::vector<double> x(a.cols(), 1.0);
+    std::vector<double> y(a.rows());
+    while (state.keep_running()) {
+        multiply(a, x.data(), y.data());
+        clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * a.nonzeros());
+    state.set_bytes_processed(state.iterations() * a.memory_bytes());
+}
+BENCHMARK(bm_spmv_csr);
+
+void bm_spmv_csc(TBenchState& state) {
+    TCscMatrix<double> a = cached_matrix().to_csc();
+    std::vector<double> x(a.cols(), 1.0);
+    std::vector<double> y(a.rows());
+    while (state.keep_running()) {
+        multiply(a, x.data(), y.data());
+        clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * a.nonzeros());
+    state.set_bytes_processed(state.iterations() * a.memory_bytes());
+}
+BENCHMARK(bm_spmv_csc);
+
+void bm_spmv_parallel(TBenchState& state) {
+    const TCsrMatrix<double>& a = cached_matrix();
+    TThreadPool pool(static_cast<size_t>(state.arg(0)));
+    std::vector<double> x(a.cols(), 1.0);
+    std::vector<double> y(a.rows());
+    while (state.keep_running()) {
+        parallel_multiply(&pool, a, x.data(), y.data());
+        clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * a.nonzeros());
+    state.set_bytes_processed(state.iterations() * a.memory_bytes());
+}
+BENCHMARK(bm_spmv_parallel)->apply(thread_counts);
+
+// то же разбиение, что по числу строк: для сравнения с балансировкой
+// по ненулевым
+void bm_spmv_parallel_by_rows(TBenchState& state) {
+    const TCsrMatrix<double>& a = cached_matrix();
+    size_t threads = static_cast<size_t>(state.arg(0));
+    TThreadPool pool(threads);
+    std::vector<double> x(a.cols(), 1.0);
+    std::vector<double> y(a.rows());
+    const size_t* offsets = a.row_offsets();
+    size_t chunk = (a.rows() + threads - 1) / threads;
+    while (state.keep_running()) {
+        pool.parallel_for(0, a.rows(), chunk, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) {
+                double sum = 0;
+                for (size_t p = offsets[i]; p < offsets[i + 1]; p++) {
+                    sum += a.values()[p] * x[a.col_indices()[p]];
+                }
+                y[i] = sum;
+            }
+        });
+        clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * a.nonzeros());
+}
+BENCHMARK(bm_spmv_parallel_by_rows)->apply(thread_counts);
+
+void bm_coo_to_csr(TBenchState& state) {
+    const TCsrMatrix<double>& a = cached_matrix();
+    TCooMatrix<double> coo(a.rows(), a.cols());
+    for (size_t i = 0; i < a.rows(); i++) {
+        for (size_t p = a.row_offsets()[i]; p < a.row_offsets()[i + 1];
+             p++) {
+            coo.add(i, a.col_indices()[p], a.values()[p]);
+        }
+    }
+    while (state.keep_running()) {
+        do_not_optimize(coo.to_csr());
+    }
+    state.set_items_processed(state.iterations() * coo.entries());
+}
+BENCHMARK(bm_coo_to_csr);
+
+}  // namespace
@@ -0,0 +1,117 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <stack>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_deque/chunked_deque.h"
+#include "../lib_stack/stack.h"
+
+namespace {
+
+// аргумент - число элементов, которое кладётся в стек и снимается
+template <class Stack>
+void push_pop(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    while (state.keep_running()) {
+        Stack stack;
+        for (size_t i = 0; i < count; i++) {
+            stack.push(i);
+        }
+        uint64_t sum = 0;
+        while (!stack.empty()) {
+            sum += stack.top();
+            stack.pop();
+        }
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+
+void bm_stack_push_pop(TBenchState& state) {
+    push_pop<TStack<uint64_t>>(state);
+}
+BENCHMARK(bm_stack_push_pop)->range(1 << 10, 1 << 22, 16);
+
+void bm_std_stack_push_pop(TBenchState& state) {
+    push_pop<std::stack<uint64_t>>(state);
+}
+BENCHMARK(bm_std_stack_push_pop)->range(1 << 10, 1 << 22, 16);
+
+void bm_std_stack_vector_push_pop(TBenchState& state) {
+    push_pop<std::stack<uint64_t, std::vector<uint64_t>>>(state);
+}
+BENCHMARK(bm_std_stack_vector_push_pop)->range(1 << 10, 1 << 22, 16);
+
+// стек, глубина которого колеблется (как в обходе в глубину): после
+// первого прохода блоки берутся из запаса, а не из кучи
+template <class Stack>
+void oscillate(TBenchState& state) {
+    const size_t kWave = 4096;
+    size_t rounds = static_cast<size_t>(state.arg(0));
+    Stack stack;
+    while (state.keep_running()) {
+        for (size_t round = 0; round < rounds; round++) {
+            for (size_t i = 0; i < kWave; i++) {
+                stack.push(i);
+            }
+            for (size_t i = 0; i < kWave; i++) {
+                stack.pop();
+            }
+        }
+        do_not_optimize(stack.size());
+    }
+    state.set_items_processed(state.iterations() * rounds * kWave);
+}
+
+void bm_stack_oscillate(TBenchState& state) {
+    oscillate<TStack<uint64_t>>(state);
+}
+BENCHMARK(bm_stack_oscillate)->arg(64);
+
+void bm_std_stack_oscillate(TBenchState& state) {
+    oscillate<std::stack<uint64_t>>(state);
+}
+BENCHMARK(bm_std_stack_oscillate)->arg(64);
+
+// прирост резидентной памяти при заполнении контейнера 2^22 элементами:
+// максимум за время заполнения, отсчитанный от памяти перед бенчмарком,
+// поэтому он не зависит от пиков других бенчмарков
+template <class Deque>
+void footprint(TBenchState& state, Deque deque) {
+    const size_t kCount = 1 << 22;
+    const size_t kSampleStep = 1 << 16;
+    trim_free_memory();
+    int64_t before = current_rss_bytes();
+    int64_t peak = 0;
+    while (state.keep_running()) {
+        for (size_t i = 0; i < kCount; i++) {
+            deque.push_back(i);
+            if ((i + 1) % kSampleStep == 0) {
+                state.pause_timing();
+                peak = std::max(peak, current_rss_bytes() - before);
+                state.resume_timing();
+            }
+        }
+        deque.clear();
+    }
+    state.set_items_processed(state.iterations() * kCount);
+    state.set_counter("rss_bytes_per_item",
+                      static_cast<double>(peak) / kCount);
+    state.set_counter("peak_growth_mb",
+                      static_cast<double>(peak) / (1 << 20));
+}
+
+void bm_chunked_deque_footprint(TBenchState& state) {
+    footprint(state, TChunkedDeque<uint64_t>(state.arg(0)));
+}
+BENCHMARK(bm_chunked_deque_footprint)->range(64, 16384, 16);
+
+void bm_std_deque_footprint(TBenchState& state) {
+    footprint(state, std::deque<uint64_t>());
+}
+BENCHMARK(bm_std_deque_footprint);
+
+}  // namespace
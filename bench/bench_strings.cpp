@@ -0,0 +1,137 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_strings/aho_corasick.h"
+#include "../lib_strings/prefix_search.h"
+#include "../lib_strings/substring_search.h"
+
+namespace {
+
+// 32 МБ строк журнала вида
+// "2024-05-17 12:04:31 INFO worker-12 GET /api/items id=482913 status=200"
+const std::string& log_text() {
+    static std::string text;
+    if (text.empty()) {
+        const char* kLevels[] = {"DEBUG", "INFO", "INFO", "INFO", "WARN"};
+        const char* kMethods[] = {"GET", "GET", "POST", "PUT", "DELETE"};
+        const char* kPaths[] = {"/api/items", "/api/users", "/api/orders",
+                                "/static/app.js", "/health"};
+        const int kStatuses[] = {200, 200, 200, 201, 204, 304, 404, 500};
+        std::mt19937 gen(1);
+        text.reserve((32 << 20) + 128);
+        while (text.size() < (32 << 20)) {
+            char time[32];
+            std::snprintf(time, sizeof(time), "2024-05-17 %02u:%02u:%02u ",
+                          static_cast<unsigned>(gen() % 24),
+                          static_cast<unsigned>(gen() % 60),
+                          static_cast<unsigned>(gen() % 60));
+            text += time;
+            text += kLevels[gen() % 5];
+            text += " worker-" + std::to_string(gen() % 32) + " ";
+            text += kMethods[gen() % 5];
+            text += " ";
+            text += kPaths[gen() % 5];
+            text += " id=" + std::to_string(gen() % 1000000);
+            text += " status=" + std::to_string(kStatuses[gen() % 8]);
+            text += "\n";
+        }
+    }
+    return text;
+}
+
+// образец, которого нет в журнале: поиск проходит весь текст, но его
+// первый и последний байты в тексте встречаются
+const char kMissing[] = "worker-7 GET /api/payments";
+
+// arg(0) образцов вида "id=NNNNNN status=": часть встречается
+std::vector<std::string> make_patterns(size_t count) {
+    std::mt19937 gen(2);
+    std::vector<std::string> patterns;
+    for (size_t i = 0; i < count; i++) {
+        patterns.push_back("id=" + std::to_string(gen() % 1000000) +
+                           " status=");
+    }
+    return patterns;
+}
+
+void bm_strings_std_find(TBenchState& state) {
+    const std::string& text = log_text();
+    while (state.keep_running()) {
+        do_not_optimize(text.find(kMissing));
+    }
+    state.set_bytes_processed(state.iterations() * text.size());
+}
+BENCHMARK(bm_strings_std_find);
+
+// arg(0) - SimdLevel
+void bm_strings_find_substring(TBenchState& state) {
+    const std::string& text = log_text();
+    SimdLevel level = static_cast<SimdLevel>(state.arg(0));
+    while (state.keep_running()) {
+        do_not_optimize(find_substring(text, kMissing, 0, level));
+    }
+    state.set_bytes_processed(state.iterations() * text.size());
+}
+BENCHMARK(bm_strings_find_substring)->arg(0)->arg(1)->arg(2);
+
+void bm_strings_kmp(TBenchState& state) {
+    const std::string& text = log_text();
+    TKmpMatcher matcher(kMissing);
+    while (state.keep_running()) {
+        do_not_optimize(matcher.find_all(text).size());
+    }
+    state.set_bytes_processed(state.iterations() * text.size());
+}
+BENCHMARK(bm_strings_kmp);
+
+void bm_strings_z_find_all(TBenchState& state) {
+    const std::string& text = log_text();
+    while (state.keep_running()) {
+        do_not_optimize(z_find_all(text, kMissing).size());
+    }
+    state.set_bytes_processed(state.iterations() * text.size());
+}
+BENCHMARK(bm_strings_z_find_all);
+
+// arg(0) образцов по очереди через std::string::find
+void bm_strings_std_find_each(TBenchState& state) {
+    const std::string& text = log_text();
+    std::vector<std::string> patterns =
+        make_patterns(static_cast<size_t>(state.arg(0)));
+    while (state.keep_running()) {
+        size_t found = 0;
+        for (const std::string& pattern : patterns) {
+            for (size_t position = text.find(pattern);
+                 position != std::string::npos;
+                 position = text.find(pattern, position + 1)) {
+                found++;
+            }
+        }
+        do_not_optimize(found);
+    }
+    state.set_bytes_processed(state.iterations() * text.size());
+}
+BENCHMARK(bm_strings_std_find_each)->arg(10)->arg(100);
+
+// те же образцы за один проход автомата
+void bm_strings_aho_corasick(TBenchState& state) {
+    const std::string& text = log_text();
+    TAhoCorasick automaton(make_patterns(static_cast<size_t>(state.arg(0))));
+    while (state.keep_running()) {
+        size_t found = 0;
+        automaton.scan(text, [&found](size_t, size_t) { found++; });
+        do_not_optimize(found);
+    }
+    state.set_bytes_processed(state.iterations() * text.size());
+    state.set_counter("table_kb",
+                      static_cast<double>(automaton.memory_bytes()) / 1024);
+}
+BENCHMARK(bm_strings_aho_corasick)->arg(10)->arg(100)->arg(1000)
+    ->arg(10000);
+
+}  // namespace
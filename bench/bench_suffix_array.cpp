@@ -0,0 +1,103 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_suffix_array/suffix_array.h"
+#include "../lib_suffix_array/suffix_index.h"
+
+namespace {
+
+// вид текста - второй аргумент бенчмарков построения
+enum class Corpus { kLog, kDna };
+
+// arg(0) МБ текста: строки журнала с повторяющимися полями или
+// случайная последовательность из четырёх букв
+std::string make_corpus(size_t megabytes, Corpus corpus) {
+    std::mt19937 gen(1);
+    size_t size = megabytes << 20;
+    std::string text;
+    text.reserve(size + 128);
+    if (corpus == Corpus::kDna) {
+        const char kBases[] = "ACGT";
+        text.resize(size);
+        for (char& symbol : text) {
+            symbol = kBases[gen() % 4];
+        }
+        return text;
+    }
+    const char* kLevels[] = {"DEBUG", "INFO", "INFO", "WARN"};
+    const char* kPaths[] = {"/api/items", "/api/users", "/api/orders",
+                            "/static/app.js", "/health"};
+    while (text.size() < size) {
+        text += "2024-05-17 " + std::to_string(gen() % 86400) + " ";
+        text += kLevels[gen() % 4];
+        text += " worker-" + std::to_string(gen() % 32) + " GET ";
+        text += kPaths[gen() % 5];
+        text += " id=" + std::to_string(gen() % 1000000) + "\n";
+    }
+    text.resize(size);
+    return text;
+}
+
+void bm_suffix_array_build(TBenchState& state) {
+    std::string text = make_corpus(static_cast<size_t>(state.arg(0)),
+                                   static_cast<Corpus>(state.arg(1)));
+    size_t peak = 0;
+    while (state.keep_running()) {
+        std::vector<uint32_t> sa = suffix_array(text, &peak);
+        do_not_optimize(sa.data());
+    }
+    state.set_bytes_processed(state.iterations() * text.size());
+    // рабочая память построения вместе с результатом, без текста
+    state.set_counter("bytes_per_input_byte",
+                      static_cast<double>(peak) / text.size());
+}
+// 256 МБ - проверка линейности на корпусах в сотни мегабайт
+BENCHMARK(bm_suffix_array_build)->args({1, 0})->args({8, 0})
+    ->args({32, 0})->args({256, 0})->args({1, 1})->args({8, 1})
+    ->args({32, 1})->args({256, 1});
+
+void bm_suffix_array_lcp(TBenchState& state) {
+    std::string text = make_corpus(static_cast<size_t>(state.arg(0)),
+                                   Corpus::kLog);
+    std::vector<uint32_t> sa = suffix_array(text);
+    size_t peak = 0;
+    while (state.keep_running()) {
+        std::vector<uint32_t> lcp = lcp_array(text, sa, &peak);
+        do_not_optimize(lcp.data());
+    }
+    state.set_bytes_processed(state.iterations() * text.size());
+    // обратный массив и результат (суффиксный массив уже есть)
+    state.set_counter("bytes_per_input_byte",
+                      static_cast<double>(peak) / text.size());
+}
+BENCHMARK(bm_suffix_array_lcp)->arg(1)->arg(8)->arg(32)->arg(256);
+
+// подсчёт вхождений 12-байтовых подстрок текста
+void bm_suffix_index_count(TBenchState& state) {
+    TSuffixIndex index(make_corpus(static_cast<size_t>(state.arg(0)),
+                                   Corpus::kLog));
+    std::mt19937 gen(2);
+    std::vector<std::string> patterns;
+    for (int i = 0; i < 1024; i++) {
+        patterns.push_back(index.text().substr(gen() % (index.size() - 12),
+                                               12));
+    }
+    while (state.keep_running()) {
+        size_t found = 0;
+        for (const std::string& pattern : patterns) {
+            found += index.count(pattern);
+        }
+        do_not_optimize(found);
+    }
+    state.set_items_processed(state.iterations() * patterns.size());
+    state.set_counter("bytes_per_input_byte",
+                      static_cast<double>(index.memory_bytes()) /
+                      index.size());
+}
+BENCHMARK(bm_suffix_index_count)->arg(1)->arg(32);
+
+}  // namespace
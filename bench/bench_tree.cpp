@@ -0,0 +1,182 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_tree/search_tree.h"
+
+namespace {
+
+std::vector<uint64_t> random_keys(size_t count, uint32_t seed) {
+    std::mt19937_64 gen(seed);
+    std::vector<uint64_t> keys(count);
+    for (uint64_t& key : keys) {
+        key = gen();
+    }
+    return keys;
+}
+
+// вставка arg(0) случайных ключей в пустой словарь
+template <class Map>
+void insert_random(TBenchState& state) {
+    std::vector<uint64_t> keys =
+        random_keys(static_cast<size_t>(state.arg(0)), 3);
+    while (state.keep_running()) {
+        Map map;
+        for (uint64_t key : keys) {
+            map[key] = key;
+        }
+        do_not_optimize(map.size());
+    }
+    state.set_items_processed(state.iterations() * keys.size());
+}
+
+void bm_avl_insert(TBenchState& state) {
+    insert_random<TAvlMap<uint64_t, uint64_t>>(state);
+}
+BENCHMARK(bm_avl_insert)->range(1 << 10, 1 << 20, 32);
+
+void bm_red_black_insert(TBenchState& state) {
+    insert_random<TRedBlackMap<uint64_t, uint64_t>>(state);
+}
+BENCHMARK(bm_red_black_insert)->range(1 << 10, 1 << 20, 32);
+
+void bm_std_map_insert(TBenchState& state) {
+    insert_random<std::map<uint64_t, uint64_t>>(state);
+}
+BENCHMARK(bm_std_map_insert)->range(1 << 10, 1 << 20, 32);
+
+// поиск существующих ключей в словаре из arg(0) элементов
+const size_t kLookups = 1 << 16;
+
+template <class Map>
+void lookup_random(TBenchState& state) {
+    std::vector<uint64_t> keys =
+        random_keys(static_cast<size_t>(state.arg(0)), 5);
+    Map map;
+    for (uint64_t key : keys) {
+        map[key] = key;
+    }
+    std::mt19937 gen(7);
+    std::vector<uint64_t> queries(kLookups);
+    for (uint64_t& query : queries) {
+        query = keys[gen() % keys.size()];
+    }
+    while (state.keep_running()) {
+        uint64_t sum = 0;
+        for (uint64_t query : queries) {
+            sum += map.find(query)->second;
+        }
+        do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * kLookups);
+}
+
+void bm_avl_lookup(TBenchState& state) {
+    lookup_random<TAvlMap<uint64_t, uint64_t>>(state);
+}
+BENCHMARK(bm_avl_lookup)->range(1 << 10, 1 << 20, 32);
+
+void bm_red_black_lookup(TBenchState& state) {
+    lookup_random<TRedBlackMap<uint64_t, uint64_t>>(state);
+}
+BENCHMARK(bm_red_black_lookup)->range(1 << 10, 1 << 20, 32);
+
+void bm_std_map_lookup(TBenchState& state) {
+    lookup_random<std::map<uint64_t, uint64_t>>(state);
+}
+BENCHMARK(bm_std_map_lookup)->range(1 << 10, 1 << 20, 32);
+
+// построение из отсортированных данных за O(n) против вставки по
+// одному ключу и против std::map с подсказкой end() (без поиска, но с
+// перебалансировкой после каждой вставки)
+std::vector<std::pair<const uint64_t, uint64_t>> sorted_items(size_t count) {
+    std::vector<std::pair<const uint64_t, uint64_t>> items;
+    items.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        items.emplace_back(i * 2, i);
+    }
+    return items;
+}
+
+void bm_red_black_build_sorted(TBenchState& state) {
+    auto items = sorted_items(static_cast<size_t>(state.arg(0)));
+    while (state.keep_running()) {
+        TRedBlackMap<uint64_t, uint64_t> map;
+        map.assign_sorted(items);
+        do_not_optimize(map.size());
+    }
+    state.set_items_processed(state.iterations() * items.size());
+}
+BENCHMARK(bm_red_black_build_sorted)->arg(1 << 20);
+
+void bm_red_black_insert_sorted(TBenchState& state) {
+    auto items = sorted_items(static_cast<size_t>(state.arg(0)));
+    while (state.keep_running()) {
+        TRedBlackMap<uint64_t, uint64_t> map;
+        for (const auto& item : items) {
+            map.insert(item);
+        }
+        do_not_optimize(map.size());
+    }
+    state.set_items_processed(state.iterations() * items.size());
+}
+BENCHMARK(bm_red_black_insert_sorted)->arg(1 << 20);
+
+void bm_std_map_insert_sorted_hint(TBenchState& state) {
+    auto items = sorted_items(static_cast<size_t>(state.arg(0)));
+    while (state.keep_running()) {
+        std::map<uint64_t, uint64_t> map;
+        for (const auto& item : items) {
+            map.emplace_hint(map.end(), item);
+        }
+        do_not_optimize(map.size());
+    }
+    state.set_items_processed(state.iterations() * items.size());
+}
+BENCHMARK(bm_std_map_insert_sorted_hint)->arg(1 << 20);
+
+// число ключей в случайном диапазоне: два спуска по размерам
+// поддеревьев против обхода диапазона в std::map
+const size_t kRangeQueries = 1 << 12;
+
+void bm_red_black_count_range(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    TRedBlackMap<uint64_t, uint64_t> map;
+    map.assign_sorted(sorted_items(count));
+    std::mt19937_64 gen(9);
+    uint64_t total = 0;
+    while (state.keep_running()) {
+        for (size_t i = 0; i < kRangeQueries; i++) {
+            uint64_t from = gen() % (count * 2);
+            total += map.count_range(from, from + count / 8);
+        }
+        do_not_optimize(total);
+    }
+    state.set_items_processed(state.iterations() * kRangeQueries);
+}
+BENCHMARK(bm_red_black_count_range)->range(1 << 10, 1 << 20, 32);
+
+void bm_std_map_count_range(TBenchState& state) {
+    size_t count = static_cast<size_t>(state.arg(0));
+    auto items = sorted_items(count);
+    std::map<uint64_t, uint64_t> map(items.begin(), items.end());
+    std::mt19937_64 gen(9);
+    uint64_t total = 0;
+    while (state.keep_running()) {
+        for (size_t i = 0; i < kRangeQueries; i++) {
+            uint64_t from = gen() % (count * 2);
+            total += static_cast<uint64_t>(std::distance(
+                map.lower_bound(from), map.lower_bound(from + count / 8)));
+        }
+        do_not_optimize(total);
+    }
+    state.set_items_processed(state.iterations() * kRangeQueries);
+}
+BENCHMARK(bm_std_map_count_range)->range(1 << 10, 1 << 15, 32);
+
+}  // namespace
@@ -0,0 +1,88 @@
+// Copyright 2024 Marina Usova
+
+#include <string>
+#include <vector>
+#include "../bench/benchmark.h"
+#include "../lib_vector/vector.h"
+
+namespace {
+
+template <class Vector>
+void push_back_many(TBenchState& state) {
+    const int64_t count = state.arg(0);
+    while (state.keep_running()) {
+        Vector vector;
+        for (int64_t i = 0; i < count; i++) {
+            vector.push_back(static_cast<int>(i));
+        }
+        do_not_optimize(vector.data());
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+
+void bm_std_vector_push_back(TBenchState& state) {
+    push_back_many<std::vector<int>>(state);
+}
+BENCHMARK(bm_std_vector_push_back)->range(16, 1 << 20, 16);
+
+void bm_tvector_push_back(TBenchState& state) {
+    push_back_many<TVector<int>>(state);
+}
+BENCHMARK(bm_tvector_push_back)->range(16, 1 << 20, 16);
+
+void bm_tvector_growth_2_push_back(TBenchState& state) {
+    push_back_many<TVector<int, 0, 2, 1>>(state);
+}
+BENCHMARK(bm_tvector_growth_2_push_back)->range(16, 1 << 20, 16);
+
+// много коротких массивов: типичный размер до 8 элементов
+template <class Vector>
+void small_vectors(TBenchState& state) {
+    const int64_t size = state.arg(0);
+    while (state.keep_running()) {
+        for (int round = 0; round < 64; round++) {
+            Vector vector;
+            for (int64_t i = 0; i < size; i++) {
+                vector.push_back(static_cast<int>(i + round));
+            }
+            do_not_optimize(vector.data());
+        }
+    }
+    state.set_items_processed(state.iterations() * 64 * size);
+}
+
+void bm_std_vector_small(TBenchState& state) {
+    small_vectors<std::vector<int>>(state);
+}
+BENCHMARK(bm_std_vector_small)->arg(2)->arg(8);
+
+void bm_tvector_small_inline(TBenchState& state) {
+    small_vectors<TVector<int, 8>>(state);
+}
+BENCHMARK(bm_tvector_small_inline)->arg(2)->arg(8);
+
+// перенос нетривиальных элементов при росте
+template <class Vector>
+void push_back_strings(TBenchState& state) {
+    const std::string value(32, 'x');
+    while (state.keep_running()) {
+        Vector vector;
+        for (int i = 0; i < 4096; i++) {
+            vector.push_back(value);
+        }
+        do_not_optimize(vector.data());
+    }
+    state.set_items_processed(state.iterations() * 4096);
+}
+
+void bm_std_vector_strings(TBenchState& state) {
+    push_back_strings<std::vector<std::string>>(state);
+}
+BENCHMARK(bm_std_vector_strings);
+
+void bm_tvector_strings(TBenchState& state) {
+    push_back_strings<TVector<std::string>>(state);
+}
+BENCHMARK(bm_tvector_strings);
+
+}  // namespace
@@ -0,0 +1,542 @@
+// Copyright 2024 Marina Usova
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_RDTSC
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define BENCH_HAS_RDTSC
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>  // NOLINT [build/c++11]
+#include <vector>
+#include "../bench/benchmark.h"
+
+namespace {
+
+// запись сюда нельзя выбросить: переменная volatile
+const volatile void* volatile escape_sink = nullptr;
+
+}  // namespace
+
+void bench_escape(const volatile void* pointer) {
+    escape_sink = pointer;
+}
+
+int64_t peak_rss_bytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                             sizeof(counters))) {
+        return static_cast<int64_t>(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<int64_t>(usage.ru_maxrss);          // байты
+#else
+    return static_cast<int64_t>(usage.ru_maxrss) * 1024;   // килобайты
+#endif
+#endif
+}
+
+int64_t current_rss_bytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                             sizeof(counters))) {
+        return static_cast<int64_t>(counters.WorkingSetSize);
+    }
+    return 0;
+#elif defined(__linux__)
+    // второе поле /proc/self/statm - резидентные страницы
+    std::ifstream statm("/proc/self/statm");
+    int64_t total_pages = 0;
+    int64_t resident_pages = 0;
+    if (!(statm >> total_pages >> resident_pages)) {
+        return 0;
+    }
+    return resident_pages * static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+void trim_free_memory() {
+#if defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
+
+namespace {
+
+uint64_t read_cycles() {
+#ifdef BENCH_HAS_RDTSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+std::vector<std::unique_ptr<TBenchmark>>& registry() {
+    static std::vector<std::unique_ptr<TBenchmark>> benchmarks;
+    return benchmarks;
+}
+
+// сводная статистика по повторениям одного бенчмарка
+struct TSummary {
+    std::string name;
+    std::string label;
+    std::vector<int64_t> args;
+    uint64_t iterations = 0;
+    int repetitions = 0;
+    double min_ns = 0;
+    double median_ns = 0;
+    double mean_ns = 0;
+    double p99_ns = 0;
+    double stddev_ns = 0;
+    double median_cycles = 0;
+    double items_per_second = 0;
+    double bytes_per_second = 0;
+    std::map<std::string, double> counters;
+};
+
+// процентиль по методу ближайшего ранга, values отсортирован
+double percentile(const std::vector<double>& values, double p) {
+    size_t rank = static_cast<size_t>(std::ceil(p * values.size()));
+    rank = std::max<size_t>(rank, 1);
+    return values[std::min(rank, values.size()) - 1];
+}
+
+double median(const std::vector<double>& values) {
+    size_t n = values.size();
+    return n % 2 == 1 ? values[n / 2]
+                      : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+TBenchState run_once(const TBenchmark& benchmark,
+                     const std::vector<int64_t>& args, uint64_t iterations) {
+    TBenchState state(iterations, args);
+    benchmark.function()(state);
+    return state;
+}
+
+// подбирает число итераций, при котором повторение длится не меньше
+// min_time_ms; заодно прогревает кэши, предсказатель переходов и частоту
+uint64_t calibrate(const TBenchmark& benchmark,
+                   const std::vector<int64_t>& args,
+                   const TBenchOptions& options) {
+    const uint64_t kMaxIterations = 1000000000;
+    const double min_ns = options.min_time_ms * 1e6;
+    const double warmup_ns = options.warmup_ms * 1e6;
+    uint64_t iterations = 1;
+    double spent_ns = 0;
+    while (true) {
+        TBenchState state = run_once(benchmark, args, iterations);
+        double elapsed = state.elapsed_ns();
+        spent_ns += elapsed;
+        if ((elapsed >= min_ns && spent_ns >= warmup_ns) ||
+            iterations >= kMaxIterations) {
+            return iterations;
+        }
+        if (elapsed >= min_ns) {
+            continue;  // нужное число итераций найдено, догреваем
+        }
+        double factor = elapsed > 0 ? min_ns / elapsed * 1.4 : 10;
+        factor = std::min(std::max(factor, 2.0), 10.0);
+        iterations = std::min<uint64_t>(
+            static_cast<uint64_t>(iterations * factor), kMaxIterations);
+    }
+}
+
+TSummary measure(const TBenchmark& benchmark,
+                 const std::vector<int64_t>& args,
+                 const TBenchOptions& options) {
+    uint64_t iterations = calibrate(benchmark, args, options);
+
+    std::vector<double> ns_per_op;
+    std::vector<double> cycles_per_op;
+    double items = 0;
+    double bytes = 0;
+    double seconds = 0;
+    TSummary summary;
+    for (int r = 0; r < options.repetitions; r++) {
+        TBenchState state = run_once(benchmark, args, iterations);
+        ns_per_op.push_back(state.elapsed_ns() / iterations);
+        cycles_per_op.push_back(state.elapsed_cycles() / iterations);
+        items += static_cast<double>(state.items_processed());
+        bytes += static_cast<double>(state.bytes_processed());
+        seconds += state.elapsed_ns() * 1e-9;
+        summary.label = state.label();
+        summary.counters = state.counters();
+    }
+
+    std::sort(ns_per_op.begin(), ns_per_op.end());
+    std::sort(cycles_per_op.begin(), cycles_per_op.end());
+    summary.name = benchmark.name();
+    for (int64_t arg : args) {
+        summary.name += "/" + std::to_string(arg);
+    }
+    summary.args = args;
+    summary.iterations = iterations;
+    summary.repetitions = options.repetitions;
+    summary.min_ns = ns_per_op.front();
+    summary.median_ns = median(ns_per_op);
+    summary.p99_ns = percentile(ns_per_op, 0.99);
+    double sum = 0;
+    for (double value : ns_per_op) {
+        sum += value;
+    }
+    summary.mean_ns = sum / ns_per_op.size();
+    double squares = 0;
+    for (double value : ns_per_op) {
+        squares += (value - summary.mean_ns) * (value - summary.mean_ns);
+    }
+    summary.stddev_ns = std::sqrt(squares / ns_per_op.size());
+    summary.median_cycles = median(cycles_per_op);
+    if (seconds > 0) {
+        summary.items_per_second = items / seconds;
+        summary.bytes_per_second = bytes / seconds;
+    }
+    return summary;
+}
+
+std::string json_escape(const std::string& text) {
+    std::string result;
+    for (char c : text) {
+        switch (c) {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        default:
+            result += c;
+        }
+    }
+    return result;
+}
+
+std::string json_number(double value) {
+    if (!std::isfinite(value)) {
+        return "null";
+    }
+    std::ostringstream out;
+    out << std::setprecision(10) << value;
+    return out.str();
+}
+
+std::string current_date() {
+    std::time_t now = std::time(nullptr);
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S",
+                  std::gmtime(&now));  // NOLINT(runtime/threadsafe_fn)
+    return buffer;
+}
+
+void write_json(std::ostream& out, const std::vector<TSummary>& summaries,
+                const TBenchOptions& options) {
+    out << "{\n  \"context\": {\n";
+    out << "    \"date\": \"" << current_date() << "\",\n";
+    out << "    \"num_cpus\": " << std::thread::hardware_concurrency()
+        << ",\n";
+#ifdef NDEBUG
+    out << "    \"library_build_type\": \"release\",\n";
+#else
+    out << "    \"library_build_type\": \"debug\",\n";
+#endif
+#ifdef BENCH_HAS_RDTSC
+    out << "    \"cycles_source\": \"rdtsc\",\n";
+#else
+    out << "    \"cycles_source\": \"none\",\n";
+#endif
+    out << "    \"repetitions\": " << options.repetitions << ",\n";
+    out << "    \"min_time_ms\": " << json_number(options.min_time_ms)
+        << "\n  },\n  \"benchmarks\": [";
+    for (size_t i = 0; i < summaries.size(); i++) {
+        const TSummary& s = summaries[i];
+        out << (i == 0 ? "\n" : ",\n") << "    {\n";
+        out << "      \"name\": \"" << json_escape(s.name) << "\",\n";
+        out << "      \"label\": \"" << json_escape(s.label) << "\",\n";
+        out << "      \"args\": [";
+        for (size_t j = 0; j < s.args.size(); j++) {
+            out << (j == 0 ? "" : ", ") << s.args[j];
+        }
+        out << "],\n";
+        out << "      \"iterations\": " << s.iterations << ",\n";
+        out << "      \"repetitions\": " << s.repetitions << ",\n";
+        out << "      \"time_unit\": \"ns\",\n";
+        out << "      \"min\": " << json_number(s.min_ns) << ",\n";
+        out << "      \"median\": " << json_number(s.median_ns) << ",\n";
+        out << "      \"mean\": " << json_number(s.mean_ns) << ",\n";
+        out << "      \"p99\": " << json_number(s.p99_ns) << ",\n";
+        out << "      \"stddev\": " << json_number(s.stddev_ns) << ",\n";
+        out << "      \"cycles_per_op\": " << json_number(s.median_cycles)
+            << ",\n";
+        out << "      \"items_per_second\": "
+            << json_number(s.items_per_second) << ",\n";
+        out << "      \"bytes_per_second\": "
+            << json_number(s.bytes_per_second) << ",\n";
+        out << "      \"counters\": {";
+        size_t k = 0;
+        for (const auto& counter : s.counters) {
+            out << (k++ == 0 ? "" : ", ") << "\""
+                << json_escape(counter.first) << "\": "
+                << json_number(counter.second);
+        }
+        out << "}\n    }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+void print_header() {
+    std::cout << std::left << std::setw(44) << "Benchmark" << std::right
+              << std::setw(14) << "Median ns" << std::setw(14) << "p99 ns"
+              << std::setw(14) << "Cycles" << std::setw(12) << "Iters"
+              << "  Items/s" << std::endl;
+    std::cout << std::string(108, '-') << std::endl;
+}
+
+void print_summary(const TSummary& s) {
+    std::cout << std::left << std::setw(44) << s.name << std::right
+              << std::fixed << std::setprecision(2)
+              << std::setw(14) << s.median_ns << std::setw(14) << s.p99_ns
+              << std::setprecision(1) << std::setw(14) << s.median_cycles
+              << std::setw(12) << s.iterations;
+    std::cout.unsetf(std::ios::floatfield);
+    if (s.items_per_second > 0) {
+        std::cout << "  " << std::setprecision(4) << s.items_per_second;
+    }
+    if (s.bytes_per_second > 0) {
+        std::cout << "  " << std::setprecision(3)
+                  << s.bytes_per_second / 1e9 << " GB/s";
+    }
+    if (!s.label.empty()) {
+        std::cout << "  " << s.label;
+    }
+    std::cout << std::endl;
+}
+
+bool starts_with(const std::string& text, const std::string& prefix,
+                 std::string* rest) {
+    if (text.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    *rest = text.substr(prefix.size());
+    return true;
+}
+
+}  // namespace
+
+TBenchState::TBenchState(uint64_t iterations,
+                         const std::vector<int64_t>& args)
+    : iterations_(iterations), remaining_(iterations), args_(args),
+      started_(false), running_(false), start_cycles_(0), elapsed_ns_(0),
+      elapsed_cycles_(0), items_(0), bytes_(0) {}
+
+bool TBenchState::keep_running() {
+    if (!started_) {
+        started_ = true;
+        start_timer();
+    }
+    if (remaining_ == 0) {
+        if (running_) {
+            stop_timer();
+        }
+        return false;
+    }
+    remaining_--;
+    return true;
+}
+
+void TBenchState::pause_timing() {
+    if (running_) {
+        stop_timer();
+    }
+}
+
+void TBenchState::resume_timing() {
+    if (!running_) {
+        start_timer();
+    }
+}
+
+void TBenchState::start_timer() {
+    running_ = true;
+    start_cycles_ = read_cycles();
+    start_time_ = std::chrono::steady_clock::now();
+}
+
+void TBenchState::stop_timer() {
+    auto finish = std::chrono::steady_clock::now();
+    uint64_t cycles = read_cycles();
+    running_ = false;
+    std::chrono::duration<double, std::nano> elapsed = finish - start_time_;
+    elapsed_ns_ += elapsed.count();
+    elapsed_cycles_ += static_cast<double>(cycles - start_cycles_);
+}
+
+TBenchmark::TBenchmark(const std::string& name, BenchFunction function)
+    : name_(name), function_(function) {}
+
+TBenchmark* TBenchmark::arg(int64_t value) {
+    arg_sets_.push_back({ value });
+    return this;
+}
+
+TBenchmark* TBenchmark::args(std::initializer_list<int64_t> values) {
+    arg_sets_.push_back(values);
+    return this;
+}
+
+TBenchmark* TBenchmark::range(int64_t first, int64_t last,
+                              int64_t multiplier) {
+    for (int64_t value = first; value <= last; value *= multiplier) {
+        arg_sets_.push_back({ value });
+        if (multiplier <= 1) {
+            break;
+        }
+    }
+    return this;
+}
+
+TBenchmark* TBenchmark::dense_range(int64_t first, int64_t last) {
+    for (int64_t value = first; value <= last; value++) {
+        arg_sets_.push_back({ value });
+    }
+    return this;
+}
+
+TBenchmark* TBenchmark::apply(void (*customize)(TBenchmark* benchmark)) {
+    customize(this);
+    return this;
+}
+
+TBenchmark* register_benchmark(const char* name, BenchFunction function) {
+    registry().emplace_back(new TBenchmark(name, function));
+    return registry().back().get();
+}
+
+std::vector<int64_t> thread_count_values() {
+    int64_t cores = std::max<int64_t>(std::thread::hardware_concurrency(), 1);
+    std::vector<int64_t> values;
+    for (int64_t threads = 1; threads < cores; threads *= 2) {
+        values.push_back(threads);
+    }
+    values.push_back(cores);
+    return values;
+}
+
+void thread_counts(TBenchmark* benchmark) {
+    for (int64_t threads : thread_count_values()) {
+        benchmark->arg(threads);
+    }
+}
+
+bool parse_bench_options(int argc, char** argv, TBenchOptions* options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value;
+        if (starts_with(arg, "--filter=", &value)) {
+            options->filter = value;
+        } else if (starts_with(arg, "--repetitions=", &value)) {
+            options->repetitions = std::max(1, std::atoi(value.c_str()));
+        } else if (starts_with(arg, "--min_time_ms=", &value)) {
+            options->min_time_ms = std::atof(value.c_str());
+        } else if (starts_with(arg, "--warmup_ms=", &value)) {
+            options->warmup_ms = std::atof(value.c_str());
+        } else if (starts_with(arg, "--json=", &value)) {
+            options->json_path = value;
+        } else if (arg == "--list") {
+            options->list_only = true;
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            std::cerr << "Usage: " << argv[0] << " [--filter=substring]"
+                      << " [--repetitions=N] [--min_time_ms=T]"
+                      << " [--warmup_ms=T] [--json=path] [--list]"
+                      << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int run_benchmarks(const TBenchOptions& options) {
+#ifndef NDEBUG
+    std::cerr << "***WARNING*** benchmarks are built without optimization "
+              << "(configure with -DCMAKE_BUILD_TYPE=Release)" << std::endl;
+#endif
+    // при --json=- стандартный вывод занимает JSON, таблица не печатается
+    bool print_table = !options.list_only && options.json_path != "-";
+    if (print_table) {
+        print_header();
+    }
+    std::vector<TSummary> summaries;
+    for (const auto& benchmark : registry()) {
+        std::vector<std::vector<int64_t>> arg_sets = benchmark->arg_sets();
+        if (arg_sets.empty()) {
+            arg_sets.push_back({});
+        }
+        for (const std::vector<int64_t>& args : arg_sets) {
+            std::string name = benchmark->name();
+            for (int64_t arg : args) {
+                name += "/" + std::to_string(arg);
+            }
+            if (name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+            if (options.list_only) {
+                std::cout << name << std::endl;
+                continue;
+            }
+            summaries.push_back(measure(*benchmark, args, options));
+            if (print_table) {
+                print_summary(summaries.back());
+            }
+        }
+    }
+
+    if (!options.json_path.empty() && !options.list_only) {
+        if (options.json_path == "-") {
+            write_json(std::cout, summaries, options);
+        } else {
+            std::ofstream out(options.json_path);
+            if (!out) {
+                std::cerr << "Can't open " << options.json_path << std::endl;
+                return 1;
+            }
+            write_json(out, summaries, options);
+        }
+    }
+    return 0;
+}
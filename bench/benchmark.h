@@ -0,0 +1,170 @@
+// Copyright 2024 Marina Usova
+
+#ifndef BENCH_BENCHMARK_H_
+#define BENCH_BENCHMARK_H_
+
+#include <chrono>  // NOLINT [build/c++11]
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <string>
+#include <vector>
+
+// Небольшой самостоятельный фреймворк для микробенчмарков в стиле
+// Google Benchmark: прогрев, несколько повторений, медиана и p99 времени
+// на операцию, такты процессора (rdtsc) и вывод результатов в JSON.
+//
+//   void bm_example(TBenchState& state) {
+//       std::vector<int> data = ...;          // подготовка не измеряется
+//       while (state.keep_running()) {
+//           do_not_optimize(work(data));
+//       }
+//       state.set_items_processed(state.iterations() * data.size());
+//   }
+//   BENCHMARK(bm_example)->arg(16)->arg(1024);
+
+// запрещает компилятору выбросить вычисление value как неиспользуемое
+template <class T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    extern void bench_escape(const volatile void* pointer);
+    bench_escape(&value);
+#endif
+}
+
+// запрещает компилятору переупорядочивать обращения к памяти вокруг точки
+inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#else
+    extern void bench_escape(const volatile void* pointer);
+    bench_escape(nullptr);
+#endif
+}
+
+// пиковый объём резидентной памяти процесса в байтах (0, если неизвестно)
+int64_t peak_rss_bytes();
+// текущий объём резидентной памяти процесса в байтах (0, если неизвестно);
+// в отличие от пика, уменьшается после освобождения памяти
+int64_t current_rss_bytes();
+// возвращает системе свободную память кучи (где это умеет аллокатор),
+// чтобы рост current_rss_bytes() не поглощался памятью, освобождённой
+// предыдущими бенчмарками
+void trim_free_memory();
+
+// состояние одного запуска бенчмарка с заданным числом итераций
+class TBenchState {
+ public:
+    TBenchState(uint64_t iterations, const std::vector<int64_t>& args);
+
+    // при первом вызове запускает таймер; возвращает false (и
+    // останавливает таймер) после iterations() успешных вызовов
+    bool keep_running();
+
+    uint64_t iterations() const { return iterations_; }
+    int64_t arg(size_t index) const { return args_.at(index); }
+    size_t arg_count() const { return args_.size(); }
+
+    // исключение служебной работы внутри цикла из измерения
+    void pause_timing();
+    void resume_timing();
+
+    void set_items_processed(int64_t items) { items_ = items; }
+    void set_bytes_processed(int64_t bytes) { bytes_ = bytes; }
+    void set_label(const std::string& label) { label_ = label; }
+    // произвольная метрика, попадает в JSON как есть
+    void set_counter(const std::string& name, double value) {
+        counters_[name] = value;
+    }
+
+    double elapsed_ns() const { return elapsed_ns_; }
+    double elapsed_cycles() const { return elapsed_cycles_; }
+    int64_t items_processed() const { return items_; }
+    int64_t bytes_processed() const { return bytes_; }
+    const std::string& label() const { return label_; }
+    const std::map<std::string, double>& counters() const {
+        return counters_;
+    }
+
+ private:
+    void start_timer();
+    void stop_timer();
+
+    uint64_t iterations_;
+    uint64_t remaining_;
+    std::vector<int64_t> args_;
+    bool started_;
+    bool running_;
+    std::chrono::steady_clock::time_point start_time_;
+    uint64_t start_cycles_;
+    double elapsed_ns_;
+    double elapsed_cycles_;
+    int64_t items_;
+    int64_t bytes_;
+    std::string label_;
+    std::map<std::string, double> counters_;
+};
+
+using BenchFunction = void (*)(TBenchState& state);
+
+// зарегистрированный бенчмарк и наборы аргументов, с которыми он запускается
+class TBenchmark {
+ public:
+    TBenchmark(const std::string& name, BenchFunction function);
+
+    TBenchmark* arg(int64_t value);
+    TBenchmark* args(std::initializer_list<int64_t> values);
+    // значения first, first * multiplier, ... не больше last
+    TBenchmark* range(int64_t first, int64_t last, int64_t multiplier = 2);
+    // все значения first, first + 1, ..., last
+    TBenchmark* dense_range(int64_t first, int64_t last);
+    // произвольная настройка аргументов функцией customize
+    TBenchmark* apply(void (*customize)(TBenchmark* benchmark));
+
+    const std::string& name() const { return name_; }
+    BenchFunction function() const { return function_; }
+    const std::vector<std::vector<int64_t>>& arg_sets() const {
+        return arg_sets_;
+    }
+
+ private:
+    std::string name_;
+    BenchFunction function_;
+    std::vector<std::vector<int64_t>> arg_sets_;
+};
+
+TBenchmark* register_benchmark(const char* name, BenchFunction function);
+
+// числа потоков 1, 2, 4, ... и число ядер процессора
+std::vector<int64_t> thread_count_values();
+// добавляет аргументами thread_count_values()
+// (для бенчмарков масштабируемости по числу потоков)
+void thread_counts(TBenchmark* benchmark);
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+#define BENCHMARK(function)                                             \
+    static TBenchmark* BENCH_CONCAT(bench_registration_, __LINE__) =    \
+        register_benchmark(#function, function)
+
+// параметры запуска, задаются из командной строки
+struct TBenchOptions {
+    std::string filter;        // подстрока имени; пустая - все бенчмарки
+    int repetitions = 10;      // число измеряемых повторений
+    double min_time_ms = 10;   // минимальная длительность одного повторения
+    double warmup_ms = 20;     // длительность прогрева перед измерениями
+    std::string json_path;     // файл для JSON; пустой - без JSON,
+                               // "-" - stdout вместо таблицы
+    bool list_only = false;    // только перечислить бенчмарки
+};
+
+// разбирает аргументы вида --filter=..., --repetitions=N, --min_time_ms=T,
+// --warmup_ms=T, --json=path, --list; возвращает false при ошибке
+bool parse_bench_options(int argc, char** argv, TBenchOptions* options);
+
+// запускает зарегистрированные бенчмарки, возвращает код завершения
+int run_benchmarks(const TBenchOptions& options);
+
+#endif  // BENCH_BENCHMARK_H_
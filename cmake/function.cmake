@@ -7,6 +7,14 @@
 # + https://neerc.ifmo.ru/wiki/index.php?title=CMake_Tutorial
 # + https://habr.com/ru/post/330902/
 
+# функция, включающая межмодульную оптимизацию (LTO) для проекта, если задана опция BLTO;
+# тогда небольшие функции библиотек (например, division) могут встраиваться в место вызова
+function(enable_lto TARGET)
+    if(BLTO)
+        set_property(TARGET ${TARGET} PROPERTY INTERPROCEDURAL_OPTIMIZATION TRUE)
+    endif()
+endfunction()
+
 # функция, создающая и подключающая библиотеку
 function(create_project_lib TARGET)
     file(GLOB TARGET_SRC "*.c*")        # добавляем в переменную TARGET_SRC все файлы с расширением .c и .cpp
@@ -16,6 +24,7 @@ function(create_project_lib TARGET)
     # в неё добавляются файлы из переменных ${TARGET_SRC} (исходный код) и ${TARGET_HD} (хедеры);
 	# если заменить «STATIC» на «SHARED», то получим библиотеку динамическую. 
 	add_library(${TARGET} STATIC ${TARGET_SRC} ${TARGET_HD})
+	enable_lto(${TARGET})
     
 	# ${CMAKE_CURRENT_SOURCE_DIR} - стандартная переменная с адресом рабочей директории
 	
@@ -36,6 +45,7 @@ function(create_executable_project TARGET)
 	# создаём исполняемый проект,
 	# в него добавляются файлы из переменных ${TARGET_SRC} (исходный код) и ${TARGET_HD} (хедеры);
 	add_executable(${TARGET} ${TARGET_SRC} ${TARGET_HD})
+	enable_lto(${TARGET})
     
 	# добавляем зависимость от всех имеющихся библиотек
     get_property ( INCLUDE_DIRS GLOBAL PROPERTY INC_DIR)
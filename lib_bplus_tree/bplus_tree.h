@@ -0,0 +1,805 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_BPLUS_TREE_BPLUS_TREE_H_
+#define LIB_BPLUS_TREE_BPLUS_TREE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../lib_bplus_tree/node_search.h"
+#include "../lib_memory/pool.h"
+
+// размер узла B+-дерева по умолчанию: 8 строк кэша
+const size_t kBPlusNodeBytes = 512;
+
+// B+-дерево для упорядоченных индексов в памяти с целыми ключами.
+// Узел занимает NodeBytes байт (кратно строке кэша) и выровнен по
+// строке; ключи узла лежат подряд в его начале и просматриваются
+// векторным сравнением целиком (bplus_detail::count_less), поэтому на
+// уровень приходится один промах по узлу вместо промаха на каждый из
+// log2(fanout) уровней двоичного дерева: при 10^8 ключей - 6 уровней
+// против ~27. Значения хранятся только в листьях, листья связаны в
+// двусвязный список - обход диапазона идёт по листьям подряд без
+// подъёмов к корню. Разделитель внутреннего узла - верхняя граница
+// ключей своего поддерева: ребёнок i содержит ключи из
+// (keys[i - 1], keys[i]]. Узлы выделяются из пулов TObjectPool.
+// Узлы, кроме корня, заполнены не меньше чем наполовину: при удалении
+// недозаполненный узел занимает элемент у соседа или сливается с ним.
+template <class Key, class Value, size_t NodeBytes = kBPlusNodeBytes>
+class TBPlusTree {
+    static_assert(std::is_integral<Key>::value,
+                  "B+-tree keys must be integers");
+    static_assert(NodeBytes % 64 == 0,
+                  "node size must be a multiple of the cache line");
+
+ public:
+    // ключей во внутреннем узле: ключи, Capacity + 1 указателей на
+    // детей и счётчик
+    static constexpr size_t kInnerCapacity =
+        (NodeBytes - 2 * sizeof(void*)) / (sizeof(Key) + sizeof(void*));
+    // элементов в листе: ключи, значения, счётчик и две ссылки
+    static constexpr size_t kLeafCapacity =
+        (NodeBytes - 3 * sizeof(void*) - alignof(Value)) /
+        (sizeof(Key) + sizeof(Value));
+
+    static_assert(kInnerCapacity >= 4 && kLeafCapacity >= 4,
+                  "node size is too small for the key and value types");
+
+ private:
+    static constexpr size_t kMinInner = kInnerCapacity / 2;
+    static constexpr size_t kMinLeaf = kLeafCapacity / 2;
+
+    struct alignas(64) TInner {
+        Key keys[kInnerCapacity];
+        void* children[kInnerCapacity + 1];
+        uint32_t count;  // число ключей; детей на один больше
+    };
+
+    struct alignas(64) TLeaf {
+        Key keys[kLeafCapacity];
+        Value values[kLeafCapacity];
+        uint32_t count;
+        TLeaf* next;
+        TLeaf* prev;
+    };
+
+    static_assert(sizeof(TInner) <= NodeBytes && sizeof(TLeaf) <= NodeBytes,
+                  "node layout exceeds NodeBytes");
+
+    // результат разделения узла: разделитель и новый правый сосед
+    struct TSplit {
+        Key separator;
+        void* right;
+    };
+
+ public:
+    using key_type = Key;
+    using mapped_type = Value;
+
+    // прямой итератор по элементам в порядке ключей; key() - ключ,
+    // value() - значение
+    template <bool IsConst>
+    class TIterator {
+        using Leaf = typename std::conditional<IsConst, const TLeaf,
+                                               TLeaf>::type;
+
+     public:
+        using reference =
+            typename std::conditional<IsConst, const Value&, Value&>::type;
+
+        TIterator() noexcept : leaf_(nullptr), index_(0) {}
+        // iterator -> const_iterator
+        template <bool OtherConst,
+                  class = typename std::enable_if<IsConst &&
+                                                  !OtherConst>::type>
+        TIterator(const TIterator<OtherConst>& other) noexcept  // NOLINT
+            : leaf_(other.leaf_), index_(other.index_) {}
+
+        Key key() const noexcept { return leaf_->keys[index_]; }
+        reference value() const noexcept { return leaf_->values[index_]; }
+
+        TIterator& operator++() noexcept {
+            if (++index_ == leaf_->count) {
+                leaf_ = leaf_->next;
+                index_ = 0;
+            }
+            return *this;
+        }
+        TIterator operator++(int) noexcept {
+            TIterator copy(*this);
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(const TIterator& left,
+                               const TIterator& right) noexcept {
+            return left.leaf_ == right.leaf_ && left.index_ == right.index_;
+        }
+        friend bool operator!=(const TIterator& left,
+                               const TIterator& right) noexcept {
+            return !(left == right);
+        }
+
+     private:
+        friend class TBPlusTree;
+        template <bool>
+        friend class TIterator;
+
+        TIterator(Leaf* leaf, size_t index) noexcept
+            : leaf_(leaf), index_(index) {}
+
+        Leaf* leaf_;
+        size_t index_;
+    };
+
+    using iterator = TIterator<false>;
+    using const_iterator = TIterator<true>;
+
+    TBPlusTree()
+        : inner_pool_(new TObjectPool<TInner>()),
+          leaf_pool_(new TObjectPool<TLeaf>()), root_(nullptr), height_(0),
+          size_(0), first_(nullptr), last_(nullptr) {}
+
+    TBPlusTree(const TBPlusTree&) = delete;
+    TBPlusTree& operator=(const TBPlusTree&) = delete;
+
+    TBPlusTree(TBPlusTree&& other) noexcept : TBPlusTree() { swap(other); }
+
+    TBPlusTree& operator=(TBPlusTree&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~TBPlusTree() { clear(); }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    // число уровней (0 у пустого дерева, 1 - корень-лист)
+    size_t height() const noexcept { return height_; }
+
+    iterator begin() noexcept { return iterator(first_, 0); }
+    iterator end() noexcept { return iterator(); }
+    const_iterator begin() const noexcept {
+        return const_iterator(first_, 0);
+    }
+    const_iterator end() const noexcept { return const_iterator(); }
+
+    // первый элемент с ключом не меньше key
+    iterator lower_bound(Key key) {
+        if (root_ == nullptr) {
+            return end();
+        }
+        TLeaf* leaf = find_leaf(key);
+        size_t index = bplus_detail::count_less(leaf->keys, leaf->count, key);
+        if (index == leaf->count) {
+            return iterator(leaf->next, 0);
+        }
+        return iterator(leaf, index);
+    }
+    const_iterator lower_bound(Key key) const {
+        return const_cast<TBPlusTree*>(this)->lower_bound(key);
+    }
+
+    iterator find(Key key) {
+        iterator it = lower_bound(key);
+        return it != end() && it.key() == key ? it : end();
+    }
+    const_iterator find(Key key) const {
+        return const_cast<TBPlusTree*>(this)->find(key);
+    }
+
+    bool contains(Key key) const { return find(key) != end(); }
+
+    Value& at(Key key) {
+        iterator it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("TBPlusTree: key not found");
+        }
+        return it.value();
+    }
+    const Value& at(Key key) const {
+        return const_cast<TBPlusTree*>(this)->at(key);
+    }
+
+    // добавляет элемент; false (значение не меняется), если ключ уже есть
+    bool insert(Key key, Value value) {
+        return insert_impl(key, &value, false);
+    }
+
+    // добавляет элемент или заменяет значение существующего
+    void insert_or_assign(Key key, Value value) {
+        insert_impl(key, &value, true);
+    }
+
+    bool erase(Key key) {
+        if (root_ == nullptr || !erase_from(root_, height_, key)) {
+            return false;
+        }
+        size_--;
+        if (height_ > 1 && inner(root_)->count == 0) {
+            TInner* old_root = inner(root_);
+            root_ = old_root->children[0];
+            inner_pool_->destroy(old_root);
+            height_--;
+        } else if (height_ == 1 && leaf(root_)->count == 0) {
+            leaf_pool_->destroy(leaf(root_));
+            root_ = nullptr;
+            height_ = 0;
+            first_ = nullptr;
+            last_ = nullptr;
+        }
+        return true;
+    }
+
+    // вызывает fn(key, value) для элементов с ключами из [from, to) по
+    // возрастанию ключей и возвращает их число. Граница проверяется по
+    // последнему ключу листа: все листья, кроме последнего, проходятся
+    // без сравнений
+    template <class Fn>
+    size_t scan(Key from, Key to, Fn fn) const {
+        const_iterator it = lower_bound(from);
+        const TLeaf* current = it.leaf_;
+        size_t index = it.index_;
+        size_t visited = 0;
+        while (current != nullptr) {
+            size_t stop = current->count;
+            bool last = !(current->keys[stop - 1] < to);
+            if (last) {
+                stop = index + bplus_detail::count_less(
+                                   current->keys + index, stop - index, to);
+            }
+            for (size_t i = index; i < stop; i++) {
+                fn(current->keys[i], current->values[i]);
+            }
+            visited += stop - index;
+            if (last) {
+                break;
+            }
+            current = current->next;
+            index = 0;
+        }
+        return visited;
+    }
+
+    // заменяет содержимое элементами items со строго возрастающими
+    // ключами (иначе std::invalid_argument) за O(n): листья заполняются
+    // подряд почти полностью, затем уровень за уровнем строятся
+    // внутренние узлы. Плотная упаковка лучше для поиска и обхода;
+    // первые вставки в такое дерево расщепляют листья
+    void assign_sorted(const std::vector<std::pair<Key, Value>>& items) {
+        for (size_t i = 1; i < items.size(); i++) {
+            if (!(items[i - 1].first < items[i].first)) {
+                throw std::invalid_argument(
+                    "TBPlusTree: keys are not strictly increasing");
+            }
+        }
+        clear();
+        if (items.empty()) {
+            return;
+        }
+        std::vector<TInner*> inners;
+        try {
+            bulk_load(items, &inners);
+        } catch (...) {
+            for (TInner* node : inners) {
+                inner_pool_->destroy(node);
+            }
+            destroy_leaf_chain();
+            reset();
+            throw;
+        }
+    }
+
+    void clear() noexcept {
+        if (root_ != nullptr) {
+            destroy(root_, height_);
+        }
+        reset();
+    }
+
+    void swap(TBPlusTree& other) noexcept {
+        std::swap(inner_pool_, other.inner_pool_);
+        std::swap(leaf_pool_, other.leaf_pool_);
+        std::swap(root_, other.root_);
+        std::swap(height_, other.height_);
+        std::swap(size_, other.size_);
+        std::swap(first_, other.first_);
+        std::swap(last_, other.last_);
+    }
+
+    // проверка порядка ключей, границ-разделителей, заполненности узлов
+    // и списка листьев
+    bool check_invariants() const {
+        if (root_ == nullptr) {
+            return height_ == 0 && size_ == 0 && first_ == nullptr &&
+                   last_ == nullptr;
+        }
+        std::vector<const TLeaf*> leaves;
+        if (!check_node(root_, height_, nullptr, nullptr, true, &leaves)) {
+            return false;
+        }
+        size_t total = 0;
+        const TLeaf* expected_prev = nullptr;
+        const TLeaf* current = first_;
+        for (const TLeaf* node : leaves) {
+            if (current != node || node->prev != expected_prev) {
+                return false;
+            }
+            total += node->count;
+            expected_prev = node;
+            current = node->next;
+        }
+        return current == nullptr && last_ == expected_prev &&
+               total == size_;
+    }
+
+ private:
+    static TInner* inner(void* node) noexcept {
+        return static_cast<TInner*>(node);
+    }
+    static TLeaf* leaf(void* node) noexcept {
+        return static_cast<TLeaf*>(node);
+    }
+
+    TLeaf* find_leaf(Key key) const noexcept {
+        void* node = root_;
+        for (size_t level = height_; level > 1; level--) {
+            const TInner* current = inner(node);
+            node = current->children[bplus_detail::count_less(
+                current->keys, current->count, key)];
+        }
+        return leaf(node);
+    }
+
+    bool insert_impl(Key key, Value* value, bool assign) {
+        if (root_ == nullptr) {
+            TLeaf* created = create_leaf();
+            root_ = created;
+            height_ = 1;
+            first_ = created;
+            last_ = created;
+        }
+        TSplit split;
+        bool inserted = insert_into(root_, height_, key, value, assign,
+                                    &split);
+        if (split.right != nullptr) {
+            TInner* root = inner_pool_->create();
+            root->keys[0] = split.separator;
+            root->children[0] = root_;
+            root->children[1] = split.right;
+            root->count = 1;
+            root_ = root;
+            height_++;
+        }
+        if (inserted) {
+            size_++;
+        }
+        return inserted;
+    }
+
+    bool insert_into(void* node, size_t level, Key key, Value* value,
+                     bool assign, TSplit* split) {
+        split->right = nullptr;
+        if (level == 1) {
+            return insert_into_leaf(leaf(node), key, value, assign, split);
+        }
+        TInner* current = inner(node);
+        size_t index =
+            bplus_detail::count_less(current->keys, current->count, key);
+        TSplit child_split;
+        bool inserted = insert_into(current->children[index], level - 1, key,
+                                    value, assign, &child_split);
+        if (child_split.right != nullptr) {
+            insert_child(current, index, child_split, split);
+        }
+        return inserted;
+    }
+
+    bool insert_into_leaf(TLeaf* node, Key key, Value* value, bool assign,
+                          TSplit* split) {
+        size_t index = bplus_detail::count_less(node->keys, node->count, key);
+        if (index < node->count && node->keys[index] == key) {
+            if (assign) {
+                node->values[index] = std::move(*value);
+            }
+            return false;
+        }
+        if (node->count < kLeafCapacity) {
+            insert_at(node, index, key, value);
+            return true;
+        }
+        // полный лист делится пополам, элемент идёт в нужную половину
+        const size_t kHalf = kLeafCapacity / 2;
+        TLeaf* right = create_leaf();
+        for (size_t i = kHalf; i < kLeafCapacity; i++) {
+            right->keys[i - kHalf] = node->keys[i];
+            right->values[i - kHalf] = std::move(node->values[i]);
+        }
+        right->count = static_cast<uint32_t>(kLeafCapacity - kHalf);
+        node->count = static_cast<uint32_t>(kHalf);
+        right->next = node->next;
+        right->prev = node;
+        if (node->next != nullptr) {
+            node->next->prev = right;
+        } else {
+            last_ = right;
+        }
+        node->next = right;
+        if (index <= kHalf) {
+            insert_at(node, index, key, value);
+        } else {
+            insert_at(right, index - kHalf, key, value);
+        }
+        split->separator = node->keys[node->count - 1];
+        split->right = right;
+        return true;
+    }
+
+    static void insert_at(TLeaf* node, size_t index, Key key, Value* value) {
+        for (size_t i = node->count; i > index; i--) {
+            node->keys[i] = node->keys[i - 1];
+            node->values[i] = std::move(node->values[i - 1]);
+        }
+        node->keys[index] = key;
+        node->values[index] = std::move(*value);
+        node->count++;
+    }
+
+    // ребёнок index разделился: справа от него встаёт новый узел.
+    // Переполненный узел делится, средний разделитель уходит вверх
+    void insert_child(TInner* node, size_t index, const TSplit& child,
+                      TSplit* split) {
+        size_t count = node->count;
+        if (count < kInnerCapacity) {
+            for (size_t i = count; i > index; i--) {
+                node->keys[i] = node->keys[i - 1];
+                node->children[i + 1] = node->children[i];
+            }
+            node->keys[index] = child.separator;
+            node->children[index + 1] = child.right;
+            node->count++;
+            return;
+        }
+        Key keys[kInnerCapacity + 1];
+        void* children[kInnerCapacity + 2];
+        for (size_t i = 0; i < index; i++) {
+            keys[i] = node->keys[i];
+        }
+        keys[index] = child.separator;
+        for (size_t i = index; i < count; i++) {
+            keys[i + 1] = node->keys[i];
+        }
+        for (size_t i = 0; i <= index; i++) {
+            children[i] = node->children[i];
+        }
+        children[index + 1] = child.right;
+        for (size_t i = index + 1; i <= count; i++) {
+            children[i + 1] = node->children[i];
+        }
+        const size_t kMiddle = (kInnerCapacity + 1) / 2;
+        TInner* right = inner_pool_->create();
+        for (size_t i = 0; i < kMiddle; i++) {
+            node->keys[i] = keys[i];
+            node->children[i] = children[i];
+        }
+        node->children[kMiddle] = children[kMiddle];
+        node->count = static_cast<uint32_t>(kMiddle);
+        size_t right_count = kInnerCapacity - kMiddle;
+        for (size_t i = 0; i < right_count; i++) {
+            right->keys[i] = keys[kMiddle + 1 + i];
+            right->children[i] = children[kMiddle + 1 + i];
+        }
+        right->children[right_count] = children[kInnerCapacity + 1];
+        right->count = static_cast<uint32_t>(right_count);
+        split->separator = keys[kMiddle];
+        split->right = right;
+    }
+
+    bool erase_from(void* node, size_t level, Key key) {
+        if (level == 1) {
+            TLeaf* current = leaf(node);
+            size_t index =
+                bplus_detail::count_less(current->keys, current->count, key);
+            if (index == current->count || current->keys[index] != key) {
+                return false;
+            }
+            for (size_t i = index + 1; i < current->count; i++) {
+                current->keys[i - 1] = current->keys[i];
+                current->values[i - 1] = std::move(current->values[i]);
+            }
+            current->count--;
+            current->values[current->count] = Value();
+            return true;
+        }
+        TInner* current = inner(node);
+        size_t index =
+            bplus_detail::count_less(current->keys, current->count, key);
+        if (!erase_from(current->children[index], level - 1, key)) {
+            return false;
+        }
+        if (level == 2) {
+            if (leaf(current->children[index])->count < kMinLeaf) {
+                rebalance_leaf(current, index);
+            }
+        } else if (inner(current->children[index])->count < kMinInner) {
+            rebalance_inner(current, index);
+        }
+        return true;
+    }
+
+    // недозаполненный лист index занимает элемент у соседа, у которого
+    // их больше минимума, иначе сливается с соседом
+    void rebalance_leaf(TInner* parent, size_t index) {
+        TLeaf* child = leaf(parent->children[index]);
+        if (index > 0) {
+            TLeaf* left = leaf(parent->children[index - 1]);
+            if (left->count > kMinLeaf) {
+                left->count--;
+                Value value(std::move(left->values[left->count]));
+                insert_at(child, 0, left->keys[left->count], &value);
+                parent->keys[index - 1] = left->keys[left->count - 1];
+                return;
+            }
+        }
+        if (index < parent->count) {
+            TLeaf* right = leaf(parent->children[index + 1]);
+            if (right->count > kMinLeaf) {
+                insert_at(child, child->count, right->keys[0],
+                          &right->values[0]);
+                for (size_t i = 1; i < right->count; i++) {
+                    right->keys[i - 1] = right->keys[i];
+                    right->values[i - 1] = std::move(right->values[i]);
+                }
+                right->count--;
+                parent->keys[index] = child->keys[child->count - 1];
+                return;
+            }
+        }
+        size_t separator = index > 0 ? index - 1 : index;
+        TLeaf* left = leaf(parent->children[separator]);
+        TLeaf* right = leaf(parent->children[separator + 1]);
+        for (size_t i = 0; i < right->count; i++) {
+            left->keys[left->count + i] = right->keys[i];
+            left->values[left->count + i] = std::move(right->values[i]);
+        }
+        left->count += right->count;
+        left->next = right->next;
+        if (right->next != nullptr) {
+            right->next->prev = left;
+        } else {
+            last_ = left;
+        }
+        leaf_pool_->destroy(right);
+        remove_separator(parent, separator);
+    }
+
+    // то же для внутреннего узла: при заёме ребёнок соседа переходит
+    // вместе с разделителем родителя, при слиянии разделитель
+    // опускается между объединяемыми ключами
+    void rebalance_inner(TInner* parent, size_t index) {
+        TInner* child = inner(parent->children[index]);
+        if (index > 0) {
+            TInner* left = inner(parent->children[index - 1]);
+            if (left->count > kMinInner) {
+                for (size_t i = child->count; i > 0; i--) {
+                    child->keys[i] = child->keys[i - 1];
+                }
+                for (size_t i = child->count + 1; i > 0; i--) {
+                    child->children[i] = child->children[i - 1];
+                }
+                child->keys[0] = parent->keys[index - 1];
+                child->children[0] = left->children[left->count];
+                child->count++;
+                parent->keys[index - 1] = left->keys[left->count - 1];
+                left->count--;
+                return;
+            }
+        }
+        if (index < parent->count) {
+            TInner* right = inner(parent->children[index + 1]);
+            if (right->count > kMinInner) {
+                child->keys[child->count] = parent->keys[index];
+                child->children[child->count + 1] = right->children[0];
+                child->count++;
+                parent->keys[index] = right->keys[0];
+                for (size_t i = 1; i < right->count; i++) {
+                    right->keys[i - 1] = right->keys[i];
+                }
+                for (size_t i = 1; i <= right->count; i++) {
+                    right->children[i - 1] = right->children[i];
+                }
+                right->count--;
+                return;
+            }
+        }
+        size_t separator = index > 0 ? index - 1 : index;
+        TInner* left = inner(parent->children[separator]);
+        TInner* right = inner(parent->children[separator + 1]);
+        left->keys[left->count] = parent->keys[separator];
+        for (size_t i = 0; i < right->count; i++) {
+            left->keys[left->count + 1 + i] = right->keys[i];
+        }
+        for (size_t i = 0; i <= right->count; i++) {
+            left->children[left->count + 1 + i] = right->children[i];
+        }
+        left->count += right->count + 1;
+        inner_pool_->destroy(right);
+        remove_separator(parent, separator);
+    }
+
+    // удаляет разделитель index и правого ребёнка index + 1
+    static void remove_separator(TInner* node, size_t index) {
+        for (size_t i = index + 1; i < node->count; i++) {
+            node->keys[i - 1] = node->keys[i];
+            node->children[i] = node->children[i + 1];
+        }
+        node->count--;
+    }
+
+    void bulk_load(const std::vector<std::pair<Key, Value>>& items,
+                   std::vector<TInner*>* inners) {
+        // листья поровну: каждый заполнен не меньше чем наполовину
+        size_t count = items.size();
+        size_t leaves = (count + kLeafCapacity - 1) / kLeafCapacity;
+        std::vector<void*> nodes;
+        std::vector<Key> maximums;
+        nodes.reserve(leaves);
+        maximums.reserve(leaves);
+        size_t begin = 0;
+        for (size_t j = 0; j < leaves; j++) {
+            size_t end = count / leaves * (j + 1) +
+                         count % leaves * (j + 1) / leaves;
+            TLeaf* created = create_leaf();
+            created->prev = last_;
+            if (last_ != nullptr) {
+                last_->next = created;
+            } else {
+                first_ = created;
+            }
+            last_ = created;
+            for (size_t i = begin; i < end; i++) {
+                created->keys[i - begin] = items[i].first;
+                created->values[i - begin] = items[i].second;
+            }
+            created->count = static_cast<uint32_t>(end - begin);
+            nodes.push_back(created);
+            maximums.push_back(items[end - 1].first);
+            begin = end;
+        }
+        height_ = 1;
+        // уровень за уровнем: группы до kInnerCapacity + 1 детей,
+        // разделитель - наибольший ключ ребёнка слева от него
+        const size_t kFanout = kInnerCapacity + 1;
+        while (nodes.size() > 1) {
+            size_t children = nodes.size();
+            size_t groups = (children + kFanout - 1) / kFanout;
+            std::vector<void*> parents;
+            std::vector<Key> parent_maximums;
+            parents.reserve(groups);
+            parent_maximums.reserve(groups);
+            begin = 0;
+            for (size_t g = 0; g < groups; g++) {
+                size_t end = children / groups * (g + 1) +
+                             children % groups * (g + 1) / groups;
+                TInner* created = inner_pool_->create();
+                inners->push_back(created);
+                for (size_t c = begin; c < end; c++) {
+                    created->children[c - begin] = nodes[c];
+                    if (c + 1 < end) {
+                        created->keys[c - begin] = maximums[c];
+                    }
+                }
+                created->count = static_cast<uint32_t>(end - begin - 1);
+                parents.push_back(created);
+                parent_maximums.push_back(maximums[end - 1]);
+                begin = end;
+            }
+            nodes.swap(parents);
+            maximums.swap(parent_maximums);
+            height_++;
+        }
+        root_ = nodes[0];
+        size_ = count;
+    }
+
+    TLeaf* create_leaf() {
+        TLeaf* created = leaf_pool_->create();
+        created->count = 0;
+        created->next = nullptr;
+        created->prev = nullptr;
+        return created;
+    }
+
+    void destroy(void* node, size_t level) noexcept {
+        if (level == 1) {
+            leaf_pool_->destroy(leaf(node));
+            return;
+        }
+        TInner* current = inner(node);
+        for (size_t i = 0; i <= current->count; i++) {
+            destroy(current->children[i], level - 1);
+        }
+        inner_pool_->destroy(current);
+    }
+
+    void destroy_leaf_chain() noexcept {
+        while (first_ != nullptr) {
+            TLeaf* next = first_->next;
+            leaf_pool_->destroy(first_);
+            first_ = next;
+        }
+    }
+
+    void reset() noexcept {
+        root_ = nullptr;
+        height_ = 0;
+        size_ = 0;
+        first_ = nullptr;
+        last_ = nullptr;
+    }
+
+    // ключи поддерева лежат в (*low, *high]; nullptr - без границы
+    bool check_node(const void* node, size_t level, const Key* low,
+                    const Key* high, bool is_root,
+                    std::vector<const TLeaf*>* leaves) const {
+        if (level == 1) {
+            const TLeaf* current = static_cast<const TLeaf*>(node);
+            if (current->count == 0 || current->count > kLeafCapacity ||
+                (!is_root && current->count < kMinLeaf)) {
+                return false;
+            }
+            if (!keys_within(current->keys, current->count, low, high)) {
+                return false;
+            }
+            leaves->push_back(current);
+            return true;
+        }
+        const TInner* current = static_cast<const TInner*>(node);
+        if (current->count == 0 || current->count > kInnerCapacity ||
+            (!is_root && current->count < kMinInner)) {
+            return false;
+        }
+        if (!keys_within(current->keys, current->count, low, high)) {
+            return false;
+        }
+        for (size_t i = 0; i <= current->count; i++) {
+            const Key* child_low = i > 0 ? &current->keys[i - 1] : low;
+            const Key* child_high =
+                i < current->count ? &current->keys[i] : high;
+            if (!check_node(current->children[i], level - 1, child_low,
+                            child_high, false, leaves)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool keys_within(const Key* keys, size_t count, const Key* low,
+                            const Key* high) {
+        for (size_t i = 0; i < count; i++) {
+            if ((i > 0 && !(keys[i - 1] < keys[i])) ||
+                (low != nullptr && !(*low < keys[i])) ||
+                (high != nullptr && *high < keys[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::unique_ptr<TObjectPool<TInner>> inner_pool_;
+    std::unique_ptr<TObjectPool<TLeaf>> leaf_pool_;
+    void* root_;
+    size_t height_;
+    size_t size_;
+    TLeaf* first_;
+    TLeaf* last_;
+};
+
+#endif  // LIB_BPLUS_TREE_BPLUS_TREE_H_
@@ -0,0 +1,186 @@
+// Copyright 2024 Marina Usova
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+#define BPLUS_TREE_X86
+#endif
+
+#ifdef BPLUS_TREE_X86
+#include <immintrin.h>
+#endif
+
+#include "../lib_bplus_tree/node_search.h"
+
+#if defined(BPLUS_TREE_X86) && (defined(__GNUC__) || defined(__clang__))
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE41
+#define TARGET_AVX2
+#endif
+
+namespace bplus_detail {
+
+namespace {
+
+// беззнаковые ключи сравниваются знаковыми инструкциями после
+// инверсии старшего бита у ключа и у искомого значения
+const int64_t kSign64 = INT64_MIN;
+const int32_t kSign32 = INT32_MIN;
+
+#ifdef BPLUS_TREE_X86
+
+// сравнение даёт -1 в «меньших» дорожках, поэтому вычитание маски из
+// счётчика считает их без movemask и popcnt
+TARGET_AVX2
+size_t count_less_avx2(const int64_t* keys, size_t count, int64_t key,
+                       int64_t flip) {
+    __m256i needle = _mm256_set1_epi64x(key ^ flip);
+    __m256i flips = _mm256_set1_epi64x(flip);
+    __m256i counter = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i values = _mm256_xor_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)),
+            flips);
+        counter = _mm256_sub_epi64(counter,
+                                   _mm256_cmpgt_epi64(needle, values));
+    }
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), counter);
+    size_t result = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] +
+                                        lanes[3]);
+    for (; i < count; i++) {
+        result += (keys[i] ^ flip) < (key ^ flip) ? 1 : 0;
+    }
+    return result;
+}
+
+TARGET_AVX2
+size_t count_less_avx2(const int32_t* keys, size_t count, int32_t key,
+                       int32_t flip) {
+    __m256i needle = _mm256_set1_epi32(key ^ flip);
+    __m256i flips = _mm256_set1_epi32(flip);
+    __m256i counter = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i values = _mm256_xor_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)),
+            flips);
+        counter = _mm256_sub_epi32(counter,
+                                   _mm256_cmpgt_epi32(needle, values));
+    }
+    alignas(32) int32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), counter);
+    size_t result = 0;
+    for (int32_t lane : lanes) {
+        result += static_cast<size_t>(lane);
+    }
+    for (; i < count; i++) {
+        result += (keys[i] ^ flip) < (key ^ flip) ? 1 : 0;
+    }
+    return result;
+}
+
+TARGET_SSE41
+size_t count_less_sse41(const int32_t* keys, size_t count, int32_t key,
+                        int32_t flip) {
+    __m128i needle = _mm_set1_epi32(key ^ flip);
+    __m128i flips = _mm_set1_epi32(flip);
+    __m128i counter = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i values = _mm_xor_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)),
+            flips);
+        counter = _mm_sub_epi32(counter, _mm_cmpgt_epi32(needle, values));
+    }
+    alignas(16) int32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), counter);
+    size_t result = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] +
+                                        lanes[3]);
+    for (; i < count; i++) {
+        result += (keys[i] ^ flip) < (key ^ flip) ? 1 : 0;
+    }
+    return result;
+}
+
+#endif  // BPLUS_TREE_X86
+
+SimdLevel supported(SimdLevel level) {
+    if (static_cast<int>(level) > static_cast<int>(detect_simd_level())) {
+        return detect_simd_level();
+    }
+    return level;
+}
+
+// 64-битного сравнения в SSE4.1 нет (pcmpgtq появилась в SSE4.2),
+// поэтому для 64-битных ключей без AVX2 - скалярный счёт
+size_t count_less_64(const int64_t* keys, size_t count, int64_t key,
+                     int64_t flip, SimdLevel level) {
+#ifdef BPLUS_TREE_X86
+    if (level == SimdLevel::kAvx2) {
+        return count_less_avx2(keys, count, key, flip);
+    }
+#endif
+    size_t result = 0;
+    for (size_t i = 0; i < count; i++) {
+        result += (keys[i] ^ flip) < (key ^ flip) ? 1 : 0;
+    }
+    return result;
+}
+
+size_t count_less_32(const int32_t* keys, size_t count, int32_t key,
+                     int32_t flip, SimdLevel level) {
+    switch (level) {
+#ifdef BPLUS_TREE_X86
+    case SimdLevel::kAvx2:
+        return count_less_avx2(keys, count, key, flip);
+    case SimdLevel::kSse41:
+        return count_less_sse41(keys, count, key, flip);
+#endif
+    default: {
+        size_t result = 0;
+        for (size_t i = 0; i < count; i++) {
+            result += (keys[i] ^ flip) < (key ^ flip) ? 1 : 0;
+        }
+        return result;
+    }
+    }
+}
+
+}  // namespace
+
+size_t count_less(const int32_t* keys, size_t count, int32_t key) {
+    return count_less_32(keys, count, key, 0, detect_simd_level());
+}
+
+size_t count_less(const uint32_t* keys, size_t count, uint32_t key) {
+    return count_less(keys, count, key, detect_simd_level());
+}
+
+size_t count_less(const int64_t* keys, size_t count, int64_t key) {
+    return count_less_64(keys, count, key, 0, detect_simd_level());
+}
+
+size_t count_less(const uint64_t* keys, size_t count, uint64_t key) {
+    return count_less(keys, count, key, detect_simd_level());
+}
+
+size_t count_less(const uint64_t* keys, size_t count, uint64_t key,
+                  SimdLevel level) {
+    // uint64_t и int64_t - знаковый и беззнаковый варианты одного типа,
+    // чтение через указатель на другой из них допустимо
+    return count_less_64(reinterpret_cast<const int64_t*>(keys), count,
+                         static_cast<int64_t>(key), kSign64,
+                         supported(level));
+}
+
+size_t count_less(const uint32_t* keys, size_t count, uint32_t key,
+                  SimdLevel level) {
+    return count_less_32(reinterpret_cast<const int32_t*>(keys), count,
+                         static_cast<int32_t>(key), kSign32,
+                         supported(level));
+}
+
+}  // namespace bplus_detail
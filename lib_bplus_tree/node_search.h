@@ -0,0 +1,43 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_BPLUS_TREE_NODE_SEARCH_H_
+#define LIB_BPLUS_TREE_NODE_SEARCH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "../lib_cpu_features/cpu_features.h"
+
+namespace bplus_detail {
+
+// Поиск внутри узла: число ключей keys[0 .. count), меньших key.
+// Ключи узла лежат подряд и их немного (одна-две строки кэша на
+// вектор), поэтому сравниваются все сразу: векторное сравнение даёт
+// маску, а ответ - число её битов. В отличие от двоичного поиска нет
+// ни зависимых загрузок, ни непредсказуемых ветвлений. Для 32- и
+// 64-битных целых ключей набор инструкций (AVX2, SSE) выбирается при
+// первом вызове по detect_simd_level(); для остальных типов - скалярный
+// счёт без ветвлений.
+size_t count_less(const int32_t* keys, size_t count, int32_t key);
+size_t count_less(const uint32_t* keys, size_t count, uint32_t key);
+size_t count_less(const int64_t* keys, size_t count, int64_t key);
+size_t count_less(const uint64_t* keys, size_t count, uint64_t key);
+
+template <class Key>
+size_t count_less(const Key* keys, size_t count, Key key) {
+    size_t result = 0;
+    for (size_t i = 0; i < count; i++) {
+        result += keys[i] < key ? 1 : 0;
+    }
+    return result;
+}
+
+// то же с явно заданным набором инструкций (для тестов и бенчмарков);
+// если процессор его не поддерживает, используется detect_simd_level()
+size_t count_less(const uint64_t* keys, size_t count, uint64_t key,
+                  SimdLevel level);
+size_t count_less(const uint32_t* keys, size_t count, uint32_t key,
+                  SimdLevel level);
+
+}  // namespace bplus_detail
+
+#endif  // LIB_BPLUS_TREE_NODE_SEARCH_H_
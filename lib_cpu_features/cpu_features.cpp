@@ -0,0 +1,80 @@
+// Copyright 2024 Marina Usova
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+#define CPU_FEATURES_X86
+#endif
+
+#if defined(CPU_FEATURES_X86) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+#include "../lib_cpu_features/cpu_features.h"
+
+namespace {
+
+// возможности процессора, определяемые один раз
+struct TCpuFeatures {
+    SimdLevel level;
+    bool fma;
+};
+
+#ifdef CPU_FEATURES_X86
+
+TCpuFeatures query_cpu_features() {
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 0);
+    int max_leaf = regs[0];
+    __cpuid(regs, 1);
+    bool sse41 = (regs[2] & (1 << 19)) != 0;
+    bool fma = (regs[2] & (1 << 12)) != 0;
+    bool osxsave = (regs[2] & (1 << 27)) != 0;
+    bool avx = (regs[2] & (1 << 28)) != 0;
+    bool avx2 = false;
+    if (max_leaf >= 7 && osxsave && avx) {
+        // ОС должна сохранять регистры ymm при переключении контекста
+        bool ymm_enabled = (_xgetbv(0) & 0x6) == 0x6;
+        __cpuidex(regs, 7, 0);
+        avx2 = ymm_enabled && (regs[1] & (1 << 5)) != 0;
+    }
+#else
+    __builtin_cpu_init();
+    bool sse41 = __builtin_cpu_supports("sse4.1");
+    bool fma = __builtin_cpu_supports("fma");
+    bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+    if (avx2) {
+        // FMA работает с регистрами ymm, поэтому учитывается только
+        // вместе с AVX2
+        return { SimdLevel::kAvx2, fma };
+    }
+    if (sse41) {
+        return { SimdLevel::kSse41, false };
+    }
+    return { SimdLevel::kScalar, false };
+}
+
+#else
+
+TCpuFeatures query_cpu_features() {
+    return { SimdLevel::kScalar, false };
+}
+
+#endif  // CPU_FEATURES_X86
+
+const TCpuFeatures& cpu_features() {
+    static const TCpuFeatures features = query_cpu_features();
+    return features;
+}
+
+}  // namespace
+
+SimdLevel detect_simd_level() {
+    return cpu_features().level;
+}
+
+bool detect_fma() {
+    return cpu_features().fma;
+}
@@ -0,0 +1,22 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_CPU_FEATURES_CPU_FEATURES_H_
+#define LIB_CPU_FEATURES_CPU_FEATURES_H_
+
+#include <cstddef>
+
+// размер кэш-линии, по которому разносятся данные разных потоков
+const size_t kCacheLineSize = 64;
+
+// набор векторных инструкций, которым выполняются ядра библиотек
+enum class SimdLevel { kScalar, kSse41, kAvx2 };
+
+// лучший набор инструкций, поддерживаемый текущим процессором
+// (определяется один раз при первом вызове)
+SimdLevel detect_simd_level();
+
+// поддерживает ли процессор FMA3 вместе с AVX2 (определяется один раз
+// при первом вызове)
+bool detect_fma();
+
+#endif  // LIB_CPU_FEATURES_CPU_FEATURES_H_
@@ -0,0 +1,3 @@
+// Copyright 2024 Marina Usova
+
+#include "../lib_deque/chunked_deque.h"
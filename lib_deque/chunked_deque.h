@@ -0,0 +1,442 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_DEQUE_CHUNKED_DEQUE_H_
+#define LIB_DEQUE_CHUNKED_DEQUE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Двусторонняя очередь из блоков (чанков) фиксированного размера.
+// В отличие от std::deque (в libstdc++ блок всего 512 байт) размер блока
+// задаётся при создании; он округляется вверх до степени двойки, чтобы
+// адрес элемента вычислялся сдвигом и маской. Освободившиеся блоки не
+// возвращаются в кучу сразу, а складываются в запас (до max_spare_chunks
+// штук) и берутся оттуда при следующем росте, поэтому очередь, размер
+// которой колеблется, почти не обращается к аллокатору.
+// Ссылки на элементы остаются действительными при push/pop на концах
+// (кроме ссылок на удалённые элементы).
+template <class T>
+class TChunkedDeque {
+    template <bool IsConst>
+    class TIterator;
+
+ public:
+    using value_type = T;
+    using iterator = TIterator<false>;
+    using const_iterator = TIterator<true>;
+
+    static constexpr size_t kDefaultChunkBytes = 4096;
+    static constexpr size_t kDefaultSpareChunks = 4;
+
+    static size_t default_chunk_size() noexcept {
+        return std::max<size_t>(kDefaultChunkBytes / sizeof(T), 16);
+    }
+
+    // chunk_size - число элементов в блоке
+    explicit TChunkedDeque(size_t chunk_size = default_chunk_size(),
+                           size_t max_spare_chunks = kDefaultSpareChunks)
+        : shift_(chunk_shift(chunk_size)), map_begin_(0), map_end_(0),
+          head_(0), size_(0), first_(nullptr), last_(nullptr),
+          last_begin_(nullptr), last_limit_(nullptr),
+          max_spare_chunks_(max_spare_chunks), chunk_allocations_(0) {}
+
+    TChunkedDeque(const TChunkedDeque& other)
+        : TChunkedDeque(other.chunk_size(), other.max_spare_chunks_) {
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+
+    TChunkedDeque(TChunkedDeque&& other) noexcept
+        : TChunkedDeque(other.chunk_size(), other.max_spare_chunks_) {
+        swap(other);
+    }
+
+    ~TChunkedDeque() {
+        clear();
+        shrink_to_fit();
+    }
+
+    TChunkedDeque& operator=(const TChunkedDeque& other) {
+        if (this != &other) {
+            TChunkedDeque copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    TChunkedDeque& operator=(TChunkedDeque&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_t chunk_size() const noexcept { return size_t(1) << shift_; }
+    // сколько раз блок выделялся из кучи (а не брался из запаса)
+    size_t chunk_allocations() const noexcept { return chunk_allocations_; }
+    size_t spare_chunks() const noexcept { return spare_.size(); }
+
+    T& operator[](size_t index) noexcept { return *address(index); }
+    const T& operator[](size_t index) const noexcept {
+        return *address(index);
+    }
+
+    T& at(size_t index) {
+        check_index(index);
+        return *address(index);
+    }
+    const T& at(size_t index) const {
+        check_index(index);
+        return *address(index);
+    }
+
+    T& front() noexcept { return *first_; }
+    const T& front() const noexcept { return *first_; }
+    T& back() noexcept { return last_[-1]; }
+    const T& back() const noexcept { return last_[-1]; }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept {
+        return const_iterator(this, size_);
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+
+    template <class... Args>
+    T& emplace_back(Args&&... args) {
+        T* limit = last_limit_;
+        if (last_ == limit) {
+            add_chunk_back();
+            last_begin_ = last_ = chunks_[map_end_ - 1];
+            last_limit_ = last_ + chunk_size();
+            if (size_ == 0) {
+                first_ = last_;
+            }
+        }
+        T* slot = last_;
+        try {
+            new (slot) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (last_limit_ != limit) {
+                drop_chunk_back();
+                if (size_ == 0) {
+                    release_all();
+                } else {
+                    set_full_back_chunk();
+                }
+            }
+            throw;
+        }
+        last_++;
+        size_++;
+        return *slot;
+    }
+
+    template <class... Args>
+    T& emplace_front(Args&&... args) {
+        if (head_ == 0) {
+            add_chunk_front();
+            head_ = chunk_size();
+        }
+        T* slot = chunks_[map_begin_] + head_ - 1;
+        try {
+            new (slot) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (head_ == chunk_size()) {
+                drop_chunk_front();
+                head_ = 0;
+            }
+            throw;
+        }
+        if (size_ == 0) {
+            // следующий push_back потребует нового блока
+            set_full_back_chunk();
+        }
+        first_ = slot;
+        head_--;
+        size_++;
+        return *slot;
+    }
+
+    void pop_back() noexcept {
+        last_--;
+        last_->~T();
+        size_--;
+        if (size_ == 0) {
+            release_all();
+        } else if (last_ == last_begin_) {
+            drop_chunk_back();
+            set_full_back_chunk();
+        }
+    }
+
+    void pop_front() noexcept {
+        first_->~T();
+        first_++;
+        head_++;
+        size_--;
+        if (size_ == 0) {
+            release_all();
+        } else if (head_ == chunk_size()) {
+            drop_chunk_front();
+            head_ = 0;
+            first_ = chunks_[map_begin_];
+        }
+    }
+
+    void clear() noexcept {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < size_; i++) {
+                address(i)->~T();
+            }
+        }
+        size_ = 0;
+        release_all();
+    }
+
+    // возвращает запасные блоки в кучу
+    void shrink_to_fit() noexcept {
+        for (T* chunk : spare_) {
+            ::operator delete(chunk);
+        }
+        spare_.clear();
+        spare_.shrink_to_fit();
+    }
+
+    void swap(TChunkedDeque& other) noexcept {
+        std::swap(shift_, other.shift_);
+        chunks_.swap(other.chunks_);
+        std::swap(map_begin_, other.map_begin_);
+        std::swap(map_end_, other.map_end_);
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+        std::swap(first_, other.first_);
+        std::swap(last_, other.last_);
+        std::swap(last_begin_, other.last_begin_);
+        std::swap(last_limit_, other.last_limit_);
+        spare_.swap(other.spare_);
+        std::swap(max_spare_chunks_, other.max_spare_chunks_);
+        std::swap(chunk_allocations_, other.chunk_allocations_);
+    }
+
+ private:
+    // итератор произвольного доступа хранит индекс элемента
+    template <bool IsConst>
+    class TIterator {
+        using Owner = typename std::conditional<IsConst, const TChunkedDeque,
+                                                TChunkedDeque>::type;
+
+     public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference =
+            typename std::conditional<IsConst, const T&, T&>::type;
+
+        TIterator() noexcept : owner_(nullptr), index_(0) {}
+        TIterator(Owner* owner, size_t index) noexcept
+            : owner_(owner), index_(index) {}
+
+        reference operator*() const noexcept { return (*owner_)[index_]; }
+        pointer operator->() const noexcept { return &(*owner_)[index_]; }
+        reference operator[](difference_type n) const noexcept {
+            return (*owner_)[index_ + n];
+        }
+
+        TIterator& operator++() noexcept {
+            index_++;
+            return *this;
+        }
+        TIterator operator++(int) noexcept {
+            TIterator copy(*this);
+            index_++;
+            return copy;
+        }
+        TIterator& operator--() noexcept {
+            index_--;
+            return *this;
+        }
+        TIterator operator--(int) noexcept {
+            TIterator copy(*this);
+            index_--;
+            return copy;
+        }
+        TIterator& operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+        TIterator& operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+        friend TIterator operator+(TIterator it, difference_type n) noexcept {
+            return it += n;
+        }
+        friend TIterator operator-(TIterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+        friend difference_type operator-(const TIterator& left,
+                                         const TIterator& right) noexcept {
+            return static_cast<difference_type>(left.index_) -
+                   static_cast<difference_type>(right.index_);
+        }
+        friend bool operator==(const TIterator& left,
+                               const TIterator& right) noexcept {
+            return left.index_ == right.index_;
+        }
+        friend bool operator!=(const TIterator& left,
+                               const TIterator& right) noexcept {
+            return left.index_ != right.index_;
+        }
+        friend bool operator<(const TIterator& left,
+                              const TIterator& right) noexcept {
+            return left.index_ < right.index_;
+        }
+
+     private:
+        Owner* owner_;
+        size_t index_;
+    };
+
+    static size_t chunk_shift(size_t chunk_size) {
+        if (chunk_size == 0) {
+            throw std::invalid_argument("TChunkedDeque: chunk size is zero");
+        }
+        size_t shift = 0;
+        while ((size_t(1) << shift) < chunk_size) {
+            shift++;
+        }
+        return shift;
+    }
+
+    size_t mask() const noexcept { return chunk_size() - 1; }
+    size_t active_chunks() const noexcept { return map_end_ - map_begin_; }
+
+    T* address(size_t index) const noexcept {
+        size_t position = head_ + index;
+        return chunks_[map_begin_ + (position >> shift_)] +
+               (position & mask());
+    }
+
+    void check_index(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("TChunkedDeque: index is out of range");
+        }
+    }
+
+    T* acquire_chunk() {
+        if (!spare_.empty()) {
+            T* chunk = spare_.back();
+            spare_.pop_back();
+            return chunk;
+        }
+        chunk_allocations_++;
+        return static_cast<T*>(::operator new(chunk_size() * sizeof(T)));
+    }
+
+    void recycle_chunk(T* chunk) noexcept {
+        if (spare_.size() < max_spare_chunks_) {
+            try {
+                spare_.push_back(chunk);
+                return;
+            } catch (...) {
+            }
+        }
+        ::operator delete(chunk);
+    }
+
+    // перестраивает карту блоков так, чтобы с каждой стороны было
+    // свободное место; карта растёт вдвое, если занята больше чем наполовину
+    void relayout_map() {
+        size_t active = active_chunks();
+        size_t capacity = chunks_.size();
+        if (active * 2 + 2 > capacity) {
+            capacity = std::max<size_t>(8, capacity * 2 + 2);
+        }
+        std::vector<T*> map(capacity, nullptr);
+        size_t begin = (capacity - active) / 2;
+        std::copy(chunks_.begin() + map_begin_, chunks_.begin() + map_end_,
+                  map.begin() + begin);
+        chunks_.swap(map);
+        map_begin_ = begin;
+        map_end_ = begin + active;
+    }
+
+    void add_chunk_back() {
+        if (map_end_ == chunks_.size()) {
+            relayout_map();
+        }
+        chunks_[map_end_] = acquire_chunk();
+        map_end_++;
+    }
+
+    void add_chunk_front() {
+        if (map_begin_ == 0) {
+            relayout_map();
+        }
+        chunks_[map_begin_ - 1] = acquire_chunk();
+        map_begin_--;
+    }
+
+    void drop_chunk_back() noexcept {
+        map_end_--;
+        recycle_chunk(chunks_[map_end_]);
+    }
+
+    void drop_chunk_front() noexcept {
+        recycle_chunk(chunks_[map_begin_]);
+        map_begin_++;
+    }
+
+    // очередь пуста: все блоки - в запас, начало - в середину карты
+    void release_all() noexcept {
+        while (map_end_ > map_begin_) {
+            drop_chunk_back();
+        }
+        map_begin_ = map_end_ = chunks_.size() / 2;
+        head_ = 0;
+        first_ = last_ = last_begin_ = last_limit_ = nullptr;
+    }
+
+    // последний блок заполнен до конца: push_back возьмёт новый
+    void set_full_back_chunk() noexcept {
+        last_begin_ = chunks_[map_end_ - 1];
+        last_ = last_limit_ = last_begin_ + chunk_size();
+    }
+
+    size_t shift_;            // log2 размера блока
+    std::vector<T*> chunks_;  // карта блоков
+    size_t map_begin_;        // занятая часть карты - [map_begin_, map_end_)
+    size_t map_end_;
+    size_t head_;             // позиция первого элемента в первом блоке
+    size_t size_;
+    // концы очереди, чтобы push/pop не обращались к карте блоков:
+    // first_ - первый элемент, last_ - место для следующего push_back,
+    // [last_begin_, last_limit_) - блок с last_ (last_ == last_limit_ -
+    // места нет)
+    T* first_;
+    T* last_;
+    T* last_begin_;
+    T* last_limit_;
+    std::vector<T*> spare_;   // запасные пустые блоки
+    size_t max_spare_chunks_;
+    size_t chunk_allocations_;
+};
+
+#endif  // LIB_DEQUE_CHUNKED_DEQUE_H_
@@ -0,0 +1,48 @@
+// Copyright 2024 Marina Usova
+
+#include "../lib_dsu/concurrent_dsu.h"
+
+namespace {
+
+size_t checked_count(size_t count) {
+    if (count > TConcurrentDsu::kMaxSize) {
+        throw std::out_of_range("TConcurrentDsu: too many elements");
+    }
+    return count;
+}
+
+}  // namespace
+
+TConcurrentDsu::TConcurrentDsu(size_t count)
+    : parent_(new std::atomic<Index>[checked_count(count)]), size_(count) {
+    for (size_t i = 0; i < count; i++) {
+        parent_[i].store(static_cast<Index>(i), std::memory_order_relaxed);
+    }
+}
+
+size_t TConcurrentDsu::set_count() const {
+    size_t count = 0;
+    for (size_t i = 0; i < size_; i++) {
+        count += parent_[i].load(std::memory_order_relaxed) == i;
+    }
+    return count;
+}
+
+std::vector<TConcurrentDsu::Index> TConcurrentDsu::labels() {
+    std::vector<Index> result(size_);
+    for (size_t i = 0; i < size_; i++) {
+        result[i] = root(static_cast<Index>(i));
+    }
+    return result;
+}
+
+void parallel_unite(TThreadPool* pool, TConcurrentDsu* dsu,
+                    const TDsuEdge* edges, size_t count) {
+    // рёбра дешёвые, а кусок должен окупать кражу работы
+    const size_t kGrain = 1 << 14;
+    pool->parallel_for(0, count, kGrain, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; i++) {
+            dsu->unite(edges[i].a, edges[i].b);
+        }
+    });
+}
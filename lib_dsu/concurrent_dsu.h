@@ -0,0 +1,143 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_DSU_CONCURRENT_DSU_H_
+#define LIB_DSU_CONCURRENT_DSU_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../lib_parallel/thread_pool.h"
+
+// ребро для пакетного объединения
+struct TDsuEdge {
+    uint32_t a;
+    uint32_t b;
+};
+
+// Неблокирующая система непересекающихся множеств: find, unite и same
+// можно вызывать из любого числа потоков одновременно. Слово элемента -
+// атомарный индекс родителя (корень ссылается сам на себя), 4 байта на
+// элемент. Корень подвешивается одним CAS, который не проходит, если
+// корень тем временем сам был подвешен, - тогда поиск повторяется.
+// Чтобы параллельные объединения не создали цикл, подвешивание идёт
+// только в одну сторону: по случайному, но фиксированному приоритету
+// элемента (биективное перемешивание индекса), к корню с большим
+// приоритетом. Такое связывание по случайному порядку даёт ожидаемую
+// глубину O(log n) без хранения размеров, а деление путей пополам
+// выполняется тем же CAS и безопасно: оно лишь перевешивает узел на
+// предка.
+class TConcurrentDsu {
+ public:
+    using Index = uint32_t;
+
+    static constexpr size_t kMaxSize = UINT32_MAX;
+
+    explicit TConcurrentDsu(size_t count);
+
+    TConcurrentDsu(const TConcurrentDsu&) = delete;
+    TConcurrentDsu& operator=(const TConcurrentDsu&) = delete;
+
+    size_t size() const noexcept { return size_; }
+
+    Index find(Index x) {
+        check_index(x);
+        return root(x);
+    }
+
+    // объединяет множества a и b; false, если они уже совпадали. Из
+    // нескольких потоков, объединяющих одни и те же множества, true
+    // получает ровно один
+    bool unite(Index a, Index b) {
+        check_index(a);
+        check_index(b);
+        while (true) {
+            a = root(a);
+            b = root(b);
+            if (a == b) {
+                return false;
+            }
+            if (priority(a) > priority(b)) {
+                std::swap(a, b);
+            }
+            Index expected = a;
+            if (parent_[a].compare_exchange_strong(
+                    expected, b, std::memory_order_acq_rel,
+                    std::memory_order_acquire)) {
+                return true;
+            }
+        }
+    }
+
+    // a и b в одном множестве. При параллельных объединениях ответ
+    // верен на какой-то момент выполнения вызова
+    bool same(Index a, Index b) {
+        check_index(a);
+        check_index(b);
+        while (true) {
+            a = root(a);
+            b = root(b);
+            if (a == b) {
+                return true;
+            }
+            // a остался корнем - значит, при чтении b множества были
+            // различны
+            if (parent_[a].load(std::memory_order_acquire) == a) {
+                return false;
+            }
+        }
+    }
+
+    // число множеств и метки (корень для каждого элемента); вызывать,
+    // когда параллельные объединения завершены
+    size_t set_count() const;
+    std::vector<Index> labels();
+
+ private:
+    // биективное перемешивание 32 бит: разные индексы - разные
+    // приоритеты
+    static uint32_t priority(uint32_t x) noexcept {
+        x ^= x >> 16;
+        x *= 0x7feb352dU;
+        x ^= x >> 15;
+        x *= 0x846ca68bU;
+        x ^= x >> 16;
+        return x;
+    }
+
+    void check_index(Index x) const {
+        if (x >= size_) {
+            throw std::out_of_range("TConcurrentDsu: index out of range");
+        }
+    }
+
+    // поиск корня с делением пути пополам; неудачный CAS не мешает -
+    // значит, другой поток уже перевесил узел выше
+    Index root(Index x) {
+        while (true) {
+            Index parent = parent_[x].load(std::memory_order_acquire);
+            if (parent == x) {
+                return x;
+            }
+            Index grand = parent_[parent].load(std::memory_order_acquire);
+            if (grand != parent) {
+                parent_[x].compare_exchange_weak(parent, grand,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed);
+            }
+            x = grand;
+        }
+    }
+
+    std::unique_ptr<std::atomic<Index>[]> parent_;
+    size_t size_;
+};
+
+// объединяет концы рёбер edges[0 .. count) потоками пула
+void parallel_unite(TThreadPool* pool, TConcurrentDsu* dsu,
+                    const TDsuEdge* edges, size_t count);
+
+#endif  // LIB_DSU_CONCURRENT_DSU_H_
@@ -0,0 +1,4 @@
+// Copyright 2024 Marina Usova
+
+#include "../lib_dsu/dsu.h"
+#include "../lib_dsu/rollback_dsu.h"
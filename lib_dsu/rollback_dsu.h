@@ -0,0 +1,114 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_DSU_ROLLBACK_DSU_H_
+#define LIB_DSU_ROLLBACK_DSU_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Система непересекающихся множеств с откатом объединений - для
+// офлайн-алгоритмов (динамическая связность по отрезку времени, обход
+// дерева запросов с возвратом). Сжатие путей здесь невозможно: оно
+// меняет много ссылок, и откат стал бы дорогим, поэтому используется
+// только объединение по размеру (глубина не больше log2 n). Каждое
+// успешное объединение меняет два слова и записывается в журнал;
+// checkpoint() запоминает длину журнала, rollback() отменяет всё, что
+// было сделано после неё, за O(1) на объединение.
+class TRollbackDsu {
+ public:
+    using Index = uint32_t;
+
+    static constexpr size_t kMaxSize = INT32_MAX;
+
+    explicit TRollbackDsu(size_t count = 0) : links_(), history_(), sets_(0) {
+        if (count > kMaxSize) {
+            throw std::out_of_range("TRollbackDsu: too many elements");
+        }
+        links_.assign(count, -1);
+        sets_ = count;
+    }
+
+    size_t size() const noexcept { return links_.size(); }
+    size_t set_count() const noexcept { return sets_; }
+
+    Index find(Index x) const {
+        check_index(x);
+        while (links_[x] >= 0) {
+            x = static_cast<Index>(links_[x]);
+        }
+        return x;
+    }
+
+    // объединяет множества a и b; false (и без записи в журнал), если
+    // они уже совпадали
+    bool unite(Index a, Index b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) {
+            return false;
+        }
+        if (links_[a] > links_[b]) {
+            std::swap(a, b);
+        }
+        history_.push_back({ b, links_[b] });
+        links_[a] += links_[b];
+        links_[b] = static_cast<int32_t>(a);
+        sets_--;
+        return true;
+    }
+
+    bool same(Index a, Index b) const { return find(a) == find(b); }
+
+    size_t set_size(Index x) const {
+        return static_cast<size_t>(-links_[find(x)]);
+    }
+
+    // отметка для rollback(): число объединений в журнале
+    size_t checkpoint() const noexcept { return history_.size(); }
+
+    // отменяет объединения, сделанные после отметки checkpoint
+    void rollback(size_t checkpoint) {
+        if (checkpoint > history_.size()) {
+            throw std::invalid_argument(
+                "TRollbackDsu: checkpoint is newer than history");
+        }
+        while (history_.size() > checkpoint) {
+            TChange change = history_.back();
+            history_.pop_back();
+            Index root = static_cast<Index>(links_[change.child]);
+            links_[root] -= change.link;
+            links_[change.child] = change.link;
+            sets_++;
+        }
+    }
+
+    // отменяет последнее объединение
+    void undo() {
+        if (history_.empty()) {
+            throw std::out_of_range("TRollbackDsu: history is empty");
+        }
+        rollback(history_.size() - 1);
+    }
+
+ private:
+    // подвешенный корень и его слово до объединения (минус размер)
+    struct TChange {
+        Index child;
+        int32_t link;
+    };
+
+    void check_index(Index x) const {
+        if (x >= links_.size()) {
+            throw std::out_of_range("TRollbackDsu: index out of range");
+        }
+    }
+
+    std::vector<int32_t> links_;  // -размер у корня, иначе родитель
+    std::vector<TChange> history_;
+    size_t sets_;
+};
+
+#endif  // LIB_DSU_ROLLBACK_DSU_H_
@@ -0,0 +1,70 @@
+// Copyright 2024 Marina Usova
+
+#include <stdexcept>
+#include "../lib_easy_example/divider.h"
+#include "../lib_easy_example/easy_example.h"
+
+namespace {
+
+int floor_log2(uint32_t value) {
+    int result = -1;
+    while (value != 0) {
+        value >>= 1;
+        result++;
+    }
+    return result;
+}
+
+}  // namespace
+
+Divider::Divider(int divisor)
+    : divisor_(divisor), magic_(0), sign_(divisor < 0 ? ~0u : 0u),
+      shift_(0), add_(false), reciprocal_(0) {
+    if (divisor == 0) {
+        throw std::invalid_argument(
+            error_message(ErrorCode::kDivisionByZero));
+    }
+    reciprocal_ = 1.0 / static_cast<float>(divisor);
+
+    uint32_t abs_d = (divisor < 0) ? 0u - static_cast<uint32_t>(divisor)
+                                   : static_cast<uint32_t>(divisor);
+    int log2 = floor_log2(abs_d);
+    if ((abs_d & (abs_d - 1)) == 0) {
+        shift_ = log2;
+        return;
+    }
+
+    // m = 2^(31 + log2) / |d|; если погрешность слишком велика,
+    // берём на один бит точности больше и корректируем сложением
+    uint64_t dividend = static_cast<uint64_t>(1) << (31 + log2);
+    uint32_t m = static_cast<uint32_t>(dividend / abs_d);
+    uint32_t rem = static_cast<uint32_t>(dividend % abs_d);
+    uint32_t e = abs_d - rem;
+    if (e < (static_cast<uint32_t>(1) << log2)) {
+        shift_ = log2 - 1;
+    } else {
+        m += m;
+        uint32_t twice_rem = rem + rem;
+        if (twice_rem >= abs_d || twice_rem < rem) {
+            m += 1;
+        }
+        shift_ = log2;
+        add_ = true;
+    }
+    m += 1;
+    magic_ = (divisor < 0) ? 0u - m : m;
+}
+
+void Divider::quotient(const int* numerators, int* result,
+                       size_t count) const {
+    for (size_t i = 0; i < count; i++) {
+        result[i] = quotient(numerators[i]);
+    }
+}
+
+void Divider::divide(const int* numerators, float* result,
+                     size_t count) const {
+    for (size_t i = 0; i < count; i++) {
+        result[i] = divide(numerators[i]);
+    }
+}
@@ -0,0 +1,72 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_EASY_EXAMPLE_DIVIDER_H_
+#define LIB_EASY_EXAMPLE_DIVIDER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+// делитель, зафиксированный заранее (в духе libdivide): в конструкторе
+// вычисляются «магический» множитель и сдвиг, после чего целочисленное
+// деление выполняется умножением со взятием старшей половины и сдвигами,
+// без аппаратной инструкции деления.
+// Деление на ноль, как и в division(), приводит к std::invalid_argument.
+class Divider {
+ public:
+    explicit Divider(int divisor);
+
+    int divisor() const noexcept { return divisor_; }
+
+    // целая часть частного с округлением к нулю (как a / b для int);
+    // INT_MIN / -1 не определено для int и здесь даёт INT_MIN
+    int quotient(int numerator) const noexcept;
+
+    // частное в виде float, побитово совпадает с division(numerator, b)
+    float divide(int numerator) const noexcept;
+
+    // пакетные варианты для count элементов
+    void quotient(const int* numerators, int* result, size_t count) const;
+    void divide(const int* numerators, float* result, size_t count) const;
+
+ private:
+    int32_t divisor_;
+    uint32_t magic_;      // 0 для делителей вида ±2^k
+    uint32_t sign_;       // 0xFFFFFFFF для отрицательного делителя, иначе 0
+    int shift_;
+    bool add_;            // нужна ли коррекция сложением с делимым
+    double reciprocal_;   // 1 / float(divisor) с двойной точностью
+};
+
+inline int Divider::quotient(int numerator) const noexcept {
+    uint32_t n = static_cast<uint32_t>(numerator);
+    int32_t q;
+    if (magic_ == 0) {
+        // делитель ±2^k: сдвиг с поправкой для отрицательных делимых
+        uint32_t mask = (shift_ == 0) ? 0u : (~0u >> (32 - shift_));
+        uint32_t fill = numerator < 0 ? ~0u : 0u;
+        q = static_cast<int32_t>(n + (fill & mask)) >> shift_;
+        q = static_cast<int32_t>((static_cast<uint32_t>(q) ^ sign_) - sign_);
+    } else {
+        int64_t product = static_cast<int64_t>(static_cast<int32_t>(magic_)) *
+                          numerator;
+        uint32_t hi = static_cast<uint32_t>(static_cast<uint64_t>(product)
+                                            >> 32);
+        if (add_) {
+            hi += (n ^ sign_) - sign_;
+        }
+        q = static_cast<int32_t>(hi) >> shift_;
+        q += (q < 0) ? 1 : 0;
+    }
+    return q;
+}
+
+inline float Divider::divide(int numerator) const noexcept {
+    // частное двух 24-битных мантисс не может лежать ближе 2^-49
+    // (относительно) к середине между соседними float, а ошибка умножения
+    // на обратное в double не превышает 2^-52, поэтому округление до float
+    // совпадает с результатом деления float(a) / float(b)
+    double a = static_cast<float>(numerator);
+    return static_cast<float>(a * reciprocal_);
+}
+
+#endif  // LIB_EASY_EXAMPLE_DIVIDER_H_
@@ -0,0 +1,34 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_EASY_EXAMPLE_DIVISION_INLINE_H_
+#define LIB_EASY_EXAMPLE_DIVISION_INLINE_H_
+
+#include <stdexcept>
+#include <type_traits>
+#include "../lib_easy_example/easy_example.h"
+
+// тип результата inline_division: для двух целых - float (как у division),
+// иначе - общий тип аргументов, но не менее точный, чем float
+template <class T, class U>
+using division_result_t = typename std::conditional<
+    std::is_integral<T>::value && std::is_integral<U>::value,
+    float,
+    typename std::common_type<T, U, float>::type>::type;
+
+// header-only вариант division(): может встраиваться в место вызова
+// и вычисляться на этапе компиляции. При b == 0 бросает
+// std::invalid_argument (в constexpr-контексте - ошибка компиляции)
+template <class T, class U>
+constexpr division_result_t<T, U> inline_division(T a, U b) {
+    static_assert(std::is_arithmetic<T>::value &&
+                  std::is_arithmetic<U>::value,
+                  "inline_division expects arithmetic arguments");
+    if (b == 0) {
+        throw std::invalid_argument(
+            error_message(ErrorCode::kDivisionByZero));
+    }
+    return static_cast<division_result_t<T, U>>(a) /
+           static_cast<division_result_t<T, U>>(b);
+}
+
+#endif  // LIB_EASY_EXAMPLE_DIVISION_INLINE_H_
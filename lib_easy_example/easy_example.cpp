@@ -3,9 +3,27 @@
 #include <stdexcept>
 #include "../lib_easy_example/easy_example.h"
 
-float division(int a, int b) {
+const char* error_message(ErrorCode code) noexcept {
+    switch (code) {
+    case ErrorCode::kOk:
+        return "OK";
+    case ErrorCode::kDivisionByZero:
+        return "Input Error: can't divide by zero!";
+    }
+    return "Unknown error";
+}
+
+TExpected<float, ErrorCode> try_division(int a, int b) noexcept {
     if (b == 0) {
-        throw std::invalid_argument("Input Error: can't divide by zero!");
+        return make_unexpected(ErrorCode::kDivisionByZero);
     }
     return static_cast<float>(a) / b;
 }
+
+float division(int a, int b) {
+    TExpected<float, ErrorCode> result = try_division(a, b);
+    if (!result) {
+        throw std::invalid_argument(error_message(result.error()));
+    }
+    return result.value();
+}
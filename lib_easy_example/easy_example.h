@@ -3,6 +3,33 @@
 #ifndef LIB_EASY_EXAMPLE_EASY_EXAMPLE_H_
 #define LIB_EASY_EXAMPLE_EASY_EXAMPLE_H_
 
+#include <cstddef>
+#include <cstdint>
+#include "../lib_cpu_features/cpu_features.h"
+#include "../lib_easy_example/expected.h"
+
+// коды ожидаемых ошибок библиотеки
+enum class ErrorCode { kOk = 0, kDivisionByZero };
+
+// текстовое описание кода ошибки
+const char* error_message(ErrorCode code) noexcept;
+
+// деление без исключений: при b == 0 возвращает ErrorCode::kDivisionByZero
+TExpected<float, ErrorCode> try_division(int a, int b) noexcept;
+
+// деление с исключением std::invalid_argument при b == 0
 float division(int a, int b);
 
+// пакетное деление: result[i] = a[i] / b[i] для i из [0, count).
+// Деление на ноль не прерывает обработку: в такой ячейке result[i] = NaN,
+// а zero_mask[i] = 1 (иначе 0); zero_mask может быть nullptr.
+// Возвращает количество ячеек с нулевым делителем.
+size_t division_batch(const int* a, const int* b, float* result,
+                      size_t count, uint8_t* zero_mask = nullptr);
+
+// то же самое, но с явно заданным набором инструкций; если процессор
+// его не поддерживает, используется detect_simd_level()
+size_t division_batch(const int* a, const int* b, float* result,
+                      size_t count, uint8_t* zero_mask, SimdLevel level);
+
 #endif  // LIB_EASY_EXAMPLE_EASY_EXAMPLE_H_
@@ -0,0 +1,131 @@
+// Copyright 2024 Marina Usova
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+#define EASY_EXAMPLE_X86
+#endif
+
+#ifdef EASY_EXAMPLE_X86
+#include <immintrin.h>
+#endif
+
+#include <limits>
+#include "../lib_easy_example/easy_example.h"
+
+#if defined(EASY_EXAMPLE_X86) && (defined(__GNUC__) || defined(__clang__))
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE41
+#define TARGET_AVX2
+#endif
+
+namespace {
+
+const float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+size_t division_scalar(const int* a, const int* b, float* result,
+                       size_t count, uint8_t* zero_mask) {
+    size_t zeros = 0;
+    for (size_t i = 0; i < count; i++) {
+        bool is_zero = (b[i] == 0);
+        result[i] = is_zero ? kNaN : static_cast<float>(a[i]) / b[i];
+        if (zero_mask != nullptr) {
+            zero_mask[i] = is_zero ? 1 : 0;
+        }
+        zeros += is_zero ? 1 : 0;
+    }
+    return zeros;
+}
+
+#ifdef EASY_EXAMPLE_X86
+
+// раскладывает битовую маску из movemask по байтам zero_mask
+// и возвращает число установленных битов
+inline size_t store_mask(unsigned bits, size_t lanes, uint8_t* zero_mask) {
+    size_t zeros = 0;
+    for (size_t j = 0; j < lanes; j++) {
+        uint8_t bit = static_cast<uint8_t>((bits >> j) & 1u);
+        if (zero_mask != nullptr) {
+            zero_mask[j] = bit;
+        }
+        zeros += bit;
+    }
+    return zeros;
+}
+
+TARGET_SSE41
+size_t division_sse41(const int* a, const int* b, float* result,
+                      size_t count, uint8_t* zero_mask) {
+    const size_t kLanes = 4;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 nan = _mm_set1_ps(kNaN);
+    size_t zeros = 0;
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        __m128 is_zero = _mm_castsi128_ps(_mm_cmpeq_epi32(vb, zero));
+        __m128 q = _mm_div_ps(_mm_cvtepi32_ps(va), _mm_cvtepi32_ps(vb));
+        _mm_storeu_ps(result + i, _mm_blendv_ps(q, nan, is_zero));
+        unsigned bits = static_cast<unsigned>(_mm_movemask_ps(is_zero));
+        zeros += store_mask(bits, kLanes,
+                            zero_mask != nullptr ? zero_mask + i : nullptr);
+    }
+    return zeros + division_scalar(a + i, b + i, result + i, count - i,
+                                   zero_mask != nullptr ? zero_mask + i
+                                                        : nullptr);
+}
+
+TARGET_AVX2
+size_t division_avx2(const int* a, const int* b, float* result,
+                     size_t count, uint8_t* zero_mask) {
+    const size_t kLanes = 8;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256 nan = _mm256_set1_ps(kNaN);
+    size_t zeros = 0;
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes) {
+        __m256i va = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(b + i));
+        __m256 is_zero = _mm256_castsi256_ps(_mm256_cmpeq_epi32(vb, zero));
+        __m256 q = _mm256_div_ps(_mm256_cvtepi32_ps(va),
+                                 _mm256_cvtepi32_ps(vb));
+        _mm256_storeu_ps(result + i, _mm256_blendv_ps(q, nan, is_zero));
+        unsigned bits = static_cast<unsigned>(_mm256_movemask_ps(is_zero));
+        zeros += store_mask(bits, kLanes,
+                            zero_mask != nullptr ? zero_mask + i : nullptr);
+    }
+    return zeros + division_scalar(a + i, b + i, result + i, count - i,
+                                   zero_mask != nullptr ? zero_mask + i
+                                                        : nullptr);
+}
+
+#endif  // EASY_EXAMPLE_X86
+
+}  // namespace
+
+size_t division_batch(const int* a, const int* b, float* result,
+                      size_t count, uint8_t* zero_mask) {
+    return division_batch(a, b, result, count, zero_mask,
+                          detect_simd_level());
+}
+
+size_t division_batch(const int* a, const int* b, float* result,
+                      size_t count, uint8_t* zero_mask, SimdLevel level) {
+    if (static_cast<int>(level) > static_cast<int>(detect_simd_level())) {
+        level = detect_simd_level();
+    }
+    switch (level) {
+#ifdef EASY_EXAMPLE_X86
+    case SimdLevel::kAvx2:
+        return division_avx2(a, b, result, count, zero_mask);
+    case SimdLevel::kSse41:
+        return division_sse41(a, b, result, count, zero_mask);
+#endif
+    default:
+        return division_scalar(a, b, result, count, zero_mask);
+    }
+}
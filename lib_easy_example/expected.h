@@ -0,0 +1,65 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_EASY_EXAMPLE_EXPECTED_H_
+#define LIB_EASY_EXAMPLE_EXPECTED_H_
+
+#include <cassert>
+#include <utility>
+
+// обёртка над кодом ошибки, из которой строится неуспешный TExpected
+template <class E>
+struct TUnexpected {
+    E error;
+};
+
+template <class E>
+constexpr TUnexpected<E> make_unexpected(E error) {
+    return TUnexpected<E>{ error };
+}
+
+// упрощённый аналог std::expected (C++23), доступный в C++14/17:
+// хранит либо результат типа T, либо код ошибки типа E.
+// Позволяет сообщать об ожидаемых ошибках без исключений.
+template <class T, class E>
+class TExpected {
+ public:
+    TExpected(const T& value)  // NOLINT(runtime/explicit)
+        : value_(value), error_(), has_value_(true) {}
+    TExpected(T&& value)  // NOLINT(runtime/explicit)
+        : value_(std::move(value)), error_(), has_value_(true) {}
+    TExpected(TUnexpected<E> unexpected)  // NOLINT(runtime/explicit)
+        : value_(), error_(unexpected.error), has_value_(false) {}
+
+    bool has_value() const noexcept { return has_value_; }
+    explicit operator bool() const noexcept { return has_value_; }
+
+    // обращение к значению допустимо только при has_value() == true
+    const T& value() const & {
+        assert(has_value_);
+        return value_;
+    }
+    T& value() & {
+        assert(has_value_);
+        return value_;
+    }
+    T&& value() && {
+        assert(has_value_);
+        return std::move(value_);
+    }
+
+    // код ошибки; осмыслен только при has_value() == false
+    E error() const noexcept { return error_; }
+
+    template <class U>
+    T value_or(U&& default_value) const & {
+        return has_value_ ? value_
+                          : static_cast<T>(std::forward<U>(default_value));
+    }
+
+ private:
+    T value_;
+    E error_;
+    bool has_value_;
+};
+
+#endif  // LIB_EASY_EXAMPLE_EXPECTED_H_
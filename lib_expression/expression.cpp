@@ -0,0 +1,385 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include "../lib_expression/expression.h"
+#include "../lib_expression/tokenizer.h"
+
+namespace {
+
+const double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+// глубина стека, до которой evaluate() обходится без выделения памяти
+const size_t kInlineStack = 32;
+
+const char* op_name(OpCode op) {
+    switch (op) {
+    case OpCode::kPushConst: return "push_const";
+    case OpCode::kLoadColumn: return "load_column";
+    case OpCode::kAdd: return "add";
+    case OpCode::kSub: return "sub";
+    case OpCode::kMul: return "mul";
+    case OpCode::kDiv: return "div";
+    case OpCode::kNeg: return "neg";
+    case OpCode::kAddConst: return "add_const";
+    case OpCode::kSubConst: return "sub_const";
+    case OpCode::kMulConst: return "mul_const";
+    case OpCode::kDivConst: return "div_const";
+    }
+    return "unknown";
+}
+
+OpCode binary_op(char op, bool with_const) {
+    switch (op) {
+    case '+': return with_const ? OpCode::kAddConst : OpCode::kAdd;
+    case '-': return with_const ? OpCode::kSubConst : OpCode::kSub;
+    case '*': return with_const ? OpCode::kMulConst : OpCode::kMul;
+    default: return with_const ? OpCode::kDivConst : OpCode::kDiv;
+    }
+}
+
+double fold(char op, double a, double b) {
+    switch (op) {
+    case '+': return a + b;
+    case '-': return a - b;
+    case '*': return a * b;
+    default: return a / b;
+    }
+}
+
+// ядра пакетного вычисления: один проход по n строкам на команду
+
+template <class Op>
+void apply(const double* a, const double* b, double* out, size_t n, Op op) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = op(a[i], b[i]);
+    }
+}
+
+template <class Op>
+void apply_const(const double* a, double c, double* out, size_t n, Op op) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = op(a[i], c);
+    }
+}
+
+void divide_checked(const double* a, const double* b, double* out,
+                    uint8_t* zero, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        bool is_zero = b[i] == 0;
+        out[i] = is_zero ? kNaN : a[i] / b[i];
+        zero[i] |= is_zero ? 1 : 0;
+    }
+}
+
+struct TAdd {
+    double operator()(double a, double b) const { return a + b; }
+};
+struct TSub {
+    double operator()(double a, double b) const { return a - b; }
+};
+struct TMul {
+    double operator()(double a, double b) const { return a * b; }
+};
+
+// вычисление для одной строки; false при делении на ноль
+bool run_row(const std::vector<TInstruction>& code,
+             const std::vector<double>& constants, const double* row,
+             double* stack, double* value) {
+    size_t top = 0;
+    for (const TInstruction& instruction : code) {
+        double c = 0;
+        switch (instruction.op) {
+        case OpCode::kPushConst:
+            stack[top++] = constants[instruction.operand];
+            continue;
+        case OpCode::kLoadColumn:
+            stack[top++] = row[instruction.operand];
+            continue;
+        case OpCode::kNeg:
+            stack[top - 1] = -stack[top - 1];
+            continue;
+        case OpCode::kAdd:
+        case OpCode::kSub:
+        case OpCode::kMul:
+        case OpCode::kDiv:
+            c = stack[--top];
+            break;
+        default:
+            c = constants[instruction.operand];
+            break;
+        }
+        double& a = stack[top - 1];
+        switch (instruction.op) {
+        case OpCode::kAdd:
+        case OpCode::kAddConst:
+            a += c;
+            break;
+        case OpCode::kSub:
+        case OpCode::kSubConst:
+            a -= c;
+            break;
+        case OpCode::kMul:
+        case OpCode::kMulConst:
+            a *= c;
+            break;
+        default:
+            if (c == 0) {
+                return false;
+            }
+            a /= c;
+            break;
+        }
+    }
+    *value = stack[0];
+    return true;
+}
+
+}  // namespace
+
+TCompiledExpression compile_expression(
+    const std::string& text, const std::vector<std::string>& columns) {
+    std::vector<TToken> postfix = to_postfix(tokenize(text));
+
+    // для каждого значения на стеке времени компиляции помним, константа
+    // ли это; константа всегда представлена последней командой
+    // push_const, поэтому свёртка просто снимает такие команды с конца
+    struct TEntry {
+        bool is_const;
+        double value;
+    };
+    std::vector<TEntry> stack;
+    std::vector<TInstruction> code;
+    std::vector<double> constants;
+    auto push_const = [&](double value) {
+        constants.push_back(value);
+        code.push_back({ OpCode::kPushConst,
+                         static_cast<uint32_t>(constants.size() - 1) });
+        stack.push_back({ true, value });
+    };
+
+    for (const TToken& token : postfix) {
+        if (token.type == TokenType::kNumber) {
+            push_const(token.value);
+        } else if (token.type == TokenType::kIdentifier) {
+            auto it = std::find(columns.begin(), columns.end(), token.text);
+            if (it == columns.end()) {
+                throw std::invalid_argument(
+                    "Expression Error: unknown column '" + token.text + "'");
+            }
+            code.push_back({ OpCode::kLoadColumn,
+                             static_cast<uint32_t>(it - columns.begin()) });
+            stack.push_back({ false, 0 });
+        } else if (token.text == "~") {
+            if (stack.back().is_const) {
+                double value = -stack.back().value;
+                stack.pop_back();
+                code.pop_back();
+                push_const(value);
+            } else {
+                code.push_back({ OpCode::kNeg, 0 });
+            }
+        } else {
+            char op = token.text[0];
+            TEntry right = stack.back();
+            stack.pop_back();
+            TEntry left = stack.back();
+            bool divides_by_zero = op == '/' && right.value == 0;
+            if (left.is_const && right.is_const && !divides_by_zero) {
+                stack.pop_back();
+                code.pop_back();
+                code.pop_back();
+                push_const(fold(op, left.value, right.value));
+            } else if (right.is_const) {
+                code.back().op = binary_op(op, true);
+                stack.back().is_const = false;
+            } else {
+                code.push_back({ binary_op(op, false), 0 });
+                stack.back().is_const = false;
+            }
+        }
+    }
+
+    TCompiledExpression result;
+    // таблица констант без свёрнутых промежуточных значений, глубина
+    // стека - моделированием выполнения
+    size_t depth = 0;
+    for (TInstruction instruction : code) {
+        switch (instruction.op) {
+        case OpCode::kPushConst:
+        case OpCode::kAddConst:
+        case OpCode::kSubConst:
+        case OpCode::kMulConst:
+        case OpCode::kDivConst:
+            result.constants_.push_back(constants[instruction.operand]);
+            instruction.operand =
+                static_cast<uint32_t>(result.constants_.size() - 1);
+            break;
+        default:
+            break;
+        }
+        switch (instruction.op) {
+        case OpCode::kPushConst:
+        case OpCode::kLoadColumn:
+            depth++;
+            break;
+        case OpCode::kAdd:
+        case OpCode::kSub:
+        case OpCode::kMul:
+        case OpCode::kDiv:
+            depth--;
+            break;
+        default:
+            break;
+        }
+        result.stack_depth_ = std::max(result.stack_depth_, depth);
+        result.code_.push_back(instruction);
+    }
+    result.column_count_ = columns.size();
+    return result;
+}
+
+TExpected<double, ErrorCode> TCompiledExpression::try_evaluate(
+    const double* row) const {
+    double inline_stack[kInlineStack];
+    std::vector<double> heap_stack;
+    double* stack = inline_stack;
+    if (stack_depth_ > kInlineStack) {
+        heap_stack.resize(stack_depth_);
+        stack = heap_stack.data();
+    }
+    double value = 0;
+    if (!run_row(code_, constants_, row, stack, &value)) {
+        return make_unexpected(ErrorCode::kDivisionByZero);
+    }
+    return value;
+}
+
+double TCompiledExpression::evaluate(const double* row) const {
+    TExpected<double, ErrorCode> result = try_evaluate(row);
+    if (!result) {
+        throw std::invalid_argument(error_message(result.error()));
+    }
+    return result.value();
+}
+
+size_t TCompiledExpression::evaluate_batch(const double* const* columns,
+                                           size_t rows, double* result,
+                                           uint8_t* zero_mask) const {
+    // у каждой глубины стека свой буфер на пачку строк; значение на
+    // стеке - указатель либо в такой буфер, либо прямо в столбец
+    // (load_column ничего не копирует)
+    std::vector<double> scratch(stack_depth_ * kBatchSize);
+    std::vector<const double*> slots(stack_depth_);
+    uint8_t zero[kBatchSize];
+    size_t zeros = 0;
+    for (size_t begin = 0; begin < rows; begin += kBatchSize) {
+        size_t n = std::min(kBatchSize, rows - begin);
+        std::memset(zero, 0, n);
+        size_t top = 0;
+        for (const TInstruction& instruction : code_) {
+            double* out = nullptr;
+            switch (instruction.op) {
+            case OpCode::kPushConst:
+                out = scratch.data() + top * kBatchSize;
+                std::fill(out, out + n, constants_[instruction.operand]);
+                slots[top++] = out;
+                continue;
+            case OpCode::kLoadColumn:
+                slots[top++] = columns[instruction.operand] + begin;
+                continue;
+            case OpCode::kNeg:
+                out = scratch.data() + (top - 1) * kBatchSize;
+                apply_const(slots[top - 1], -1.0, out, n, TMul());
+                slots[top - 1] = out;
+                continue;
+            default:
+                break;
+            }
+            bool binary = instruction.op == OpCode::kAdd ||
+                          instruction.op == OpCode::kSub ||
+                          instruction.op == OpCode::kMul ||
+                          instruction.op == OpCode::kDiv;
+            // второй операнд есть только у бинарных операций: у остальных
+            // slots[top] лежит за вершиной стека (и за концом slots)
+            double c = 0;
+            const double* b = nullptr;
+            if (binary) {
+                top--;
+                b = slots[top];
+            } else {
+                c = constants_[instruction.operand];
+            }
+            const double* a = slots[top - 1];
+            out = scratch.data() + (top - 1) * kBatchSize;
+            switch (instruction.op) {
+            case OpCode::kAdd:
+                apply(a, b, out, n, TAdd());
+                break;
+            case OpCode::kSub:
+                apply(a, b, out, n, TSub());
+                break;
+            case OpCode::kMul:
+                apply(a, b, out, n, TMul());
+                break;
+            case OpCode::kDiv:
+                divide_checked(a, b, out, zero, n);
+                break;
+            case OpCode::kAddConst:
+                apply_const(a, c, out, n, TAdd());
+                break;
+            case OpCode::kSubConst:
+                apply_const(a, c, out, n, TSub());
+                break;
+            case OpCode::kMulConst:
+                apply_const(a, c, out, n, TMul());
+                break;
+            default:
+                if (c == 0) {
+                    std::fill(out, out + n, kNaN);
+                    std::memset(zero, 1, n);
+                } else {
+                    apply_const(a, c, out, n,
+                                [](double x, double y) { return x / y; });
+                }
+                break;
+            }
+            slots[top - 1] = out;
+        }
+        const double* value = slots[0];
+        for (size_t i = 0; i < n; i++) {
+            result[begin + i] = zero[i] != 0 ? kNaN : value[i];
+            zeros += zero[i];
+        }
+        if (zero_mask != nullptr) {
+            std::memcpy(zero_mask + begin, zero, n);
+        }
+    }
+    return zeros;
+}
+
+std::string TCompiledExpression::disassemble() const {
+    std::ostringstream out;
+    for (const TInstruction& instruction : code_) {
+        out << op_name(instruction.op);
+        switch (instruction.op) {
+        case OpCode::kLoadColumn:
+            out << ' ' << instruction.operand;
+            break;
+        case OpCode::kPushConst:
+        case OpCode::kAddConst:
+        case OpCode::kSubConst:
+        case OpCode::kMulConst:
+        case OpCode::kDivConst:
+            out << ' ' << constants_[instruction.operand];
+            break;
+        default:
+            break;
+        }
+        out << '\n';
+    }
+    return out.str();
+}
@@ -0,0 +1,90 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_EXPRESSION_EXPRESSION_H_
+#define LIB_EXPRESSION_EXPRESSION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../lib_easy_example/easy_example.h"
+#include "../lib_easy_example/expected.h"
+
+// команды стековой машины; варианты *Const берут правый операнд из
+// таблицы констант, а не со стека (так компилируются выражения вида
+// x * 2 - одна команда вместо двух)
+enum class OpCode : uint8_t {
+    kPushConst,   // положить константу operand
+    kLoadColumn,  // положить значение столбца operand
+    kAdd,
+    kSub,
+    kMul,
+    kDiv,         // деление с проверкой делителя на ноль, как division()
+    kNeg,
+    kAddConst,
+    kSubConst,
+    kMulConst,
+    kDivConst
+};
+
+struct TInstruction {
+    OpCode op;
+    uint32_t operand;  // номер константы или столбца
+};
+
+// Выражение, скомпилированное в плоский байт-код стековой машины.
+// Значения столбцов передаются по номеру в списке columns из
+// compile_expression().
+class TCompiledExpression {
+ public:
+    // сколько строк обрабатывает одна команда в evaluate_batch()
+    static constexpr size_t kBatchSize = 256;
+
+    // значение для одной строки: row[c] - значение столбца c.
+    // При делении на ноль бросает std::invalid_argument, как division()
+    double evaluate(const double* row) const;
+
+    // то же без исключений: при делении на ноль -
+    // ErrorCode::kDivisionByZero, как try_division()
+    TExpected<double, ErrorCode> try_evaluate(const double* row) const;
+
+    // значения для rows строк, заданных столбцами: columns[c][i] -
+    // значение столбца c в строке i. Строки обрабатываются пачками по
+    // kBatchSize: выбор команды происходит один раз на пачку, а сама
+    // команда - простой цикл по строкам, который компилятор
+    // векторизует. Как и в division_batch(), деление на ноль не
+    // прерывает обработку: result[i] = NaN, zero_mask[i] = 1 (иначе 0),
+    // zero_mask может быть nullptr. Возвращает число таких строк.
+    size_t evaluate_batch(const double* const* columns, size_t rows,
+                          double* result, uint8_t* zero_mask = nullptr) const;
+
+    const std::vector<TInstruction>& code() const noexcept { return code_; }
+    const std::vector<double>& constants() const noexcept {
+        return constants_;
+    }
+    // наибольшая глубина стека при выполнении
+    size_t stack_depth() const noexcept { return stack_depth_; }
+    size_t column_count() const noexcept { return column_count_; }
+
+    // текстовая запись байт-кода, по команде на строку
+    std::string disassemble() const;
+
+ private:
+    friend TCompiledExpression compile_expression(
+        const std::string& text, const std::vector<std::string>& columns);
+
+    std::vector<TInstruction> code_;
+    std::vector<double> constants_;
+    size_t stack_depth_ = 0;
+    size_t column_count_ = 0;
+};
+
+// разбирает выражение (числа, имена столбцов, + - * /, унарный минус,
+// скобки), сворачивает константные подвыражения и компилирует в
+// байт-код. Деление на константный ноль не сворачивается и
+// обнаруживается при вычислении. Синтаксическая ошибка или неизвестное
+// имя - std::invalid_argument.
+TCompiledExpression compile_expression(
+    const std::string& text, const std::vector<std::string>& columns);
+
+#endif  // LIB_EXPRESSION_EXPRESSION_H_
@@ -0,0 +1,163 @@
+// Copyright 2024 Marina Usova
+
+#include <cctype>
+#include <cstdlib>
+#include <stdexcept>
+#include "../lib_expression/tokenizer.h"
+
+namespace {
+
+void fail(const std::string& message, size_t position) {
+    throw std::invalid_argument("Expression Error: " + message +
+                                " at position " + std::to_string(position));
+}
+
+bool is_identifier_char(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_';
+}
+
+int precedence(const std::string& op) {
+    if (op == "~") {
+        return 3;
+    }
+    if (op == "*" || op == "/") {
+        return 2;
+    }
+    return 1;
+}
+
+bool is_right_associative(const std::string& op) {
+    return op == "~";
+}
+
+}  // namespace
+
+std::vector<TToken> tokenize(const std::string& text) {
+    std::vector<TToken> tokens;
+    // ожидается ли операнд: тогда '-' и '+' унарные
+    bool expect_operand = true;
+    size_t i = 0;
+    while (i < text.size()) {
+        char c = text[i];
+        if (std::isspace(static_cast<unsigned char>(c)) != 0) {
+            i++;
+            continue;
+        }
+        size_t start = i;
+        if (std::isdigit(static_cast<unsigned char>(c)) != 0 || c == '.') {
+            const char* begin = text.c_str() + i;
+            char* end = nullptr;
+            double value = std::strtod(begin, &end);
+            if (end == begin) {
+                fail("malformed number", start);
+            }
+            i += static_cast<size_t>(end - begin);
+            tokens.push_back({ TokenType::kNumber,
+                               text.substr(start, i - start), value, start });
+            expect_operand = false;
+        } else if (is_identifier_char(c)) {
+            while (i < text.size() && is_identifier_char(text[i])) {
+                i++;
+            }
+            tokens.push_back({ TokenType::kIdentifier,
+                               text.substr(start, i - start), 0, start });
+            expect_operand = false;
+        } else if (c == '(') {
+            tokens.push_back({ TokenType::kLeftParen, "(", 0, start });
+            expect_operand = true;
+            i++;
+        } else if (c == ')') {
+            tokens.push_back({ TokenType::kRightParen, ")", 0, start });
+            expect_operand = false;
+            i++;
+        } else if (c == '+' || c == '-' || c == '*' || c == '/') {
+            i++;
+            if (expect_operand && c == '+') {
+                continue;
+            }
+            if (expect_operand && c != '-') {
+                fail(std::string("unexpected operator '") + c + "'", start);
+            }
+            std::string op = expect_operand ? "~" : std::string(1, c);
+            tokens.push_back({ TokenType::kOperator, op, 0, start });
+            expect_operand = true;
+        } else {
+            fail(std::string("unexpected character '") + c + "'", start);
+        }
+    }
+    return tokens;
+}
+
+std::vector<TToken> to_postfix(const std::vector<TToken>& tokens) {
+    std::vector<TToken> output;
+    std::vector<TToken> operators;
+    // как и в tokenize(): ожидается операнд или оператор
+    bool expect_operand = true;
+    for (const TToken& token : tokens) {
+        switch (token.type) {
+        case TokenType::kNumber:
+        case TokenType::kIdentifier:
+            if (!expect_operand) {
+                fail("missing operator", token.position);
+            }
+            output.push_back(token);
+            expect_operand = false;
+            break;
+        case TokenType::kOperator:
+            if (token.text == "~") {
+                // унарный оператор не выталкивает предыдущие
+                operators.push_back(token);
+                break;
+            }
+            if (expect_operand) {
+                fail("missing operand", token.position);
+            }
+            while (!operators.empty() &&
+                   operators.back().type == TokenType::kOperator) {
+                int top = precedence(operators.back().text);
+                int current = precedence(token.text);
+                if (top < current ||
+                    (top == current && is_right_associative(token.text))) {
+                    break;
+                }
+                output.push_back(operators.back());
+                operators.pop_back();
+            }
+            operators.push_back(token);
+            expect_operand = true;
+            break;
+        case TokenType::kLeftParen:
+            if (!expect_operand) {
+                fail("missing operator", token.position);
+            }
+            operators.push_back(token);
+            break;
+        case TokenType::kRightParen:
+            if (expect_operand) {
+                fail("missing operand", token.position);
+            }
+            while (!operators.empty() &&
+                   operators.back().type != TokenType::kLeftParen) {
+                output.push_back(operators.back());
+                operators.pop_back();
+            }
+            if (operators.empty()) {
+                fail("unmatched ')'", token.position);
+            }
+            operators.pop_back();
+            break;
+        }
+    }
+    if (expect_operand) {
+        fail("unexpected end of expression",
+             tokens.empty() ? 0 : tokens.back().position + 1);
+    }
+    while (!operators.empty()) {
+        if (operators.back().type == TokenType::kLeftParen) {
+            fail("unmatched '('", operators.back().position);
+        }
+        output.push_back(operators.back());
+        operators.pop_back();
+    }
+    return output;
+}
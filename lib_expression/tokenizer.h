@@ -0,0 +1,35 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_EXPRESSION_TOKENIZER_H_
+#define LIB_EXPRESSION_TOKENIZER_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+enum class TokenType {
+    kNumber,      // число с плавающей точкой: 2, 0.5, 1e-3
+    kIdentifier,  // имя столбца: price, tax_rate
+    kOperator,    // + - * / и унарный минус
+    kLeftParen,
+    kRightParen
+};
+
+struct TToken {
+    TokenType type;
+    std::string text;   // имя или оператор; для унарного минуса - "~"
+    double value;       // значение для kNumber
+    size_t position;    // смещение начала лексемы в исходной строке
+};
+
+// разбивает инфиксное выражение на лексемы и различает унарный и бинарный
+// минус (унарный получает text "~"); унарный плюс отбрасывается.
+// При ошибке бросает std::invalid_argument с позицией в тексте.
+std::vector<TToken> tokenize(const std::string& text);
+
+// переводит лексемы в обратную польскую запись алгоритмом
+// сортировочной станции Дейкстры; проверяет парность скобок и
+// расстановку операндов. Скобок в результате нет.
+std::vector<TToken> to_postfix(const std::vector<TToken>& tokens);
+
+#endif  // LIB_EXPRESSION_TOKENIZER_H_
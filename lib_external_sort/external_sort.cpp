@@ -0,0 +1,310 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <chrono>  // NOLINT [build/c++11]
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "../lib_external_sort/external_sort.h"
+#include "../lib_external_sort/loser_tree.h"
+#include "../lib_sort/radix_sort.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+const size_t kRecordBytes = sizeof(uint64_t);
+// буфер проверки и генерации файлов
+const size_t kStreamBuffer = 1 << 20;
+
+double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Последовательное чтение записей [begin, end) файла окнами по
+// buffer_bytes. В режиме kPread окно копируется в свой буфер, в режиме
+// kMmap записи берутся прямо из отображения: следующее окно заранее
+// запрашивается у ядра, пройденное отдаётся обратно
+class TRunReader {
+ public:
+    TRunReader(const TInputFile& file, uint64_t begin, uint64_t end,
+               size_t buffer_bytes)
+        : file_(file), position_(begin), end_(end),
+          window_(buffer_bytes / kRecordBytes * kRecordBytes),
+          current_(nullptr), last_(nullptr) {
+        if (file_.data() == nullptr) {
+            buffer_.resize(window_ / kRecordBytes);
+        }
+        file_.prefetch(position_, window_);
+    }
+
+    // следующая запись; false - записи кончились
+    bool next(uint64_t* value) {
+        if (current_ == last_ && !refill()) {
+            return false;
+        }
+        *value = *current_++;
+        return true;
+    }
+
+ private:
+    bool refill() {
+        if (position_ >= end_) {
+            return false;
+        }
+        size_t bytes = static_cast<size_t>(
+            std::min<uint64_t>(window_, end_ - position_));
+        if (file_.data() != nullptr) {
+            if (current_ != nullptr) {
+                file_.release(position_ - window_, window_);
+            }
+            current_ = reinterpret_cast<const uint64_t*>(file_.data() +
+                                                         position_);
+        } else {
+            file_.read(position_, buffer_.data(), bytes);
+            current_ = buffer_.data();
+        }
+        last_ = current_ + bytes / kRecordBytes;
+        position_ += bytes;
+        file_.prefetch(position_, window_);
+        return true;
+    }
+
+    const TInputFile& file_;
+    uint64_t position_;
+    uint64_t end_;
+    size_t window_;
+    std::vector<uint64_t> buffer_;
+    const uint64_t* current_;
+    const uint64_t* last_;
+};
+
+// запись в файл через буфер из buffer_bytes байт
+class TRecordWriter {
+ public:
+    TRecordWriter(const std::string& path, size_t buffer_bytes)
+        : file_(path), written_(0) {
+        buffer_.reserve(std::max<size_t>(buffer_bytes / kRecordBytes, 1));
+    }
+
+    void push(uint64_t value) {
+        buffer_.push_back(value);
+        if (buffer_.size() == buffer_.capacity()) {
+            flush();
+        }
+    }
+
+    void write(const uint64_t* data, size_t count) {
+        flush();
+        file_.write(data, count * kRecordBytes);
+        written_ += count * kRecordBytes;
+    }
+
+    // байтов записано с начала файла
+    uint64_t written() const noexcept {
+        return written_ + buffer_.size() * kRecordBytes;
+    }
+
+    void close() {
+        flush();
+        file_.close();
+    }
+
+ private:
+    void flush() {
+        if (!buffer_.empty()) {
+            file_.write(buffer_.data(), buffer_.size() * kRecordBytes);
+            written_ += buffer_.size() * kRecordBytes;
+            buffer_.clear();
+        }
+    }
+
+    TOutputFile file_;
+    uint64_t written_;
+    std::vector<uint64_t> buffer_;
+};
+
+// удаляет временные файлы и при ошибке
+class TTempFiles {
+ public:
+    TTempFiles(const std::string& first, const std::string& second)
+        : paths_{first, second} {}
+    ~TTempFiles() {
+        for (const std::string& path : paths_) {
+            std::error_code error;
+            std::filesystem::remove(path, error);
+        }
+    }
+
+    const std::string& operator[](size_t index) const {
+        return paths_[index];
+    }
+
+ private:
+    std::string paths_[2];
+};
+
+// слияние серий [begin, ends[0]), [ends[0], ends[1]) ... в writer
+void merge_runs(const TInputFile& source, uint64_t begin,
+                const uint64_t* ends, size_t count, size_t buffer_bytes,
+                TRecordWriter* writer) {
+    std::vector<TRunReader> readers;
+    readers.reserve(count);
+    TLoserTree<uint64_t> tree(count);
+    for (size_t way = 0; way < count; way++) {
+        readers.emplace_back(source, begin, ends[way], buffer_bytes);
+        begin = ends[way];
+        uint64_t value;
+        if (readers[way].next(&value)) {
+            tree.set(way, value);
+        }
+    }
+    tree.build();
+    while (!tree.empty()) {
+        writer->push(tree.top());
+        uint64_t value;
+        if (readers[tree.winner()].next(&value)) {
+            tree.replace_top(value);
+        } else {
+            tree.pop_top();
+        }
+    }
+}
+
+}  // namespace
+
+TExternalSortStats external_sort(const std::string& input,
+                                 const std::string& output,
+                                 const TExternalSortOptions& options) {
+    if (options.fan_in < 2) {
+        throw std::invalid_argument("TExternalSort: fan-in is less than 2");
+    }
+    if (options.memory_bytes / (options.fan_in + 1) < kExternalSortMinBuffer) {
+        throw std::invalid_argument(
+            "TExternalSort: memory budget is too small for the fan-in");
+    }
+    std::error_code input_error;
+    std::error_code output_error;
+    std::filesystem::path input_path =
+        std::filesystem::weakly_canonical(input, input_error);
+    std::filesystem::path output_path =
+        std::filesystem::weakly_canonical(output, output_error);
+    if (!input_error && !output_error && input_path == output_path) {
+        throw std::invalid_argument(
+            "TExternalSort: output is the same file as input");
+    }
+
+    TExternalSortStats stats;
+    Clock::time_point start = Clock::now();
+    TInputFile in(input, options.io_mode);
+    if (in.size() % kRecordBytes != 0) {
+        throw std::invalid_argument(
+            "TExternalSort: input size is not a multiple of the record size");
+    }
+    stats.bytes = in.size();
+    stats.records = in.size() / kRecordBytes;
+
+    // кусок серии и буфер radix_sort делят память пополам
+    size_t chunk = options.memory_bytes / 2 / kRecordBytes;
+    if (stats.records <= chunk) {
+        std::vector<uint64_t> records(static_cast<size_t>(stats.records));
+        in.read(0, records.data(), static_cast<size_t>(stats.bytes));
+        radix_sort(records.data(), records.size());
+        TOutputFile out(output);
+        out.write(records.data(), static_cast<size_t>(stats.bytes));
+        out.close();
+        stats.runs = stats.records > 0 ? 1 : 0;
+        stats.run_seconds = seconds_since(start);
+        return stats;
+    }
+
+    std::filesystem::path directory = options.temp_directory.empty() ?
+        std::filesystem::path(output).parent_path() :
+        std::filesystem::path(options.temp_directory);
+    std::string name = std::filesystem::path(output).filename().string();
+    TTempFiles temp((directory / (name + ".run0")).string(),
+                    (directory / (name + ".run1")).string());
+
+    // этап 1: отсортированные серии подряд в temp[0], ends - их концы
+    std::vector<uint64_t> ends;
+    {
+        std::vector<uint64_t> records(chunk);
+        TRecordWriter writer(temp[0], 0);
+        for (uint64_t offset = 0; offset < stats.bytes;) {
+            size_t count = static_cast<size_t>(
+                std::min<uint64_t>(chunk, (stats.bytes - offset) /
+                                          kRecordBytes));
+            size_t bytes = count * kRecordBytes;
+            in.read(offset, records.data(), bytes);
+            in.release(offset, bytes);
+            offset += bytes;
+            in.prefetch(offset, bytes);
+            radix_sort(records.data(), count);
+            writer.write(records.data(), count);
+            ends.push_back(writer.written());
+        }
+        writer.close();
+    }
+    stats.runs = ends.size();
+    stats.run_seconds = seconds_since(start);
+
+    // этап 2: проходы слияния temp[0] -> temp[1] -> temp[0] ... -> output
+    start = Clock::now();
+    size_t current = 0;
+    while (ends.size() > 1) {
+        bool last = ends.size() <= options.fan_in;
+        size_t ways = std::min(options.fan_in, ends.size());
+        // буферы ways источников и выхода
+        size_t buffer_bytes = options.memory_bytes / (ways + 1);
+        std::vector<uint64_t> merged;
+        {
+            TInputFile source(temp[current], options.io_mode);
+            TRecordWriter writer(last ? output : temp[1 - current],
+                                 buffer_bytes);
+            uint64_t begin = 0;
+            for (size_t run = 0; run < ends.size(); run += ways) {
+                size_t count = std::min(ways, ends.size() - run);
+                merge_runs(source, begin, ends.data() + run, count,
+                           buffer_bytes, &writer);
+                begin = ends[run + count - 1];
+                merged.push_back(writer.written());
+            }
+            writer.close();
+        }
+        ends.swap(merged);
+        current = 1 - current;
+        stats.merge_passes++;
+    }
+    stats.merge_seconds = seconds_since(start);
+    return stats;
+}
+
+bool is_sorted_file(const std::string& path, IoMode mode) {
+    TInputFile file(path, mode);
+    if (file.size() % kRecordBytes != 0) {
+        throw std::invalid_argument(
+            "TExternalSort: file size is not a multiple of the record size");
+    }
+    TRunReader reader(file, 0, file.size(), kStreamBuffer);
+    uint64_t previous = 0;
+    uint64_t value;
+    while (reader.next(&value)) {
+        if (value < previous) {
+            return false;
+        }
+        previous = value;
+    }
+    return true;
+}
+
+void generate_records(const std::string& path, uint64_t count,
+                      uint64_t seed) {
+    std::mt19937_64 random(seed);
+    TRecordWriter writer(path, kStreamBuffer);
+    for (uint64_t i = 0; i < count; i++) {
+        writer.push(random());
+    }
+    writer.close();
+}
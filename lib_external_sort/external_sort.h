@@ -0,0 +1,69 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_EXTERNAL_SORT_EXTERNAL_SORT_H_
+#define LIB_EXTERNAL_SORT_EXTERNAL_SORT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "../lib_external_sort/record_file.h"
+
+// наименьший буфер одного источника при слиянии: на меньших кусках
+// время уходит на системные вызовы и перемещения головки диска
+const size_t kExternalSortMinBuffer = 1 << 16;
+
+struct TExternalSortOptions {
+    // память под записи: кусок серии вместе с буфером поразрядной
+    // сортировки или буферы всех источников слияния и выхода
+    size_t memory_bytes = size_t(256) << 20;
+    // число серий, сливаемых за один проход
+    size_t fan_in = 64;
+    IoMode io_mode = IoMode::kPread;
+    // каталог временных файлов; пустой - каталог выходного файла
+    std::string temp_directory;
+};
+
+struct TExternalSortStats {
+    uint64_t records = 0;
+    uint64_t bytes = 0;
+    // серий после первого этапа и проходов слияния
+    size_t runs = 0;
+    size_t merge_passes = 0;
+    double run_seconds = 0;
+    double merge_seconds = 0;
+
+    double seconds() const noexcept { return run_seconds + merge_seconds; }
+    // пропускная способность по входу, МБ (2^20 байт) в секунду
+    double megabytes_per_second(double elapsed) const noexcept {
+        return elapsed > 0 ? static_cast<double>(bytes) / (1 << 20) / elapsed
+                           : 0;
+    }
+};
+
+// Сортировка файла из 64-битных беззнаковых записей (порядок байтов
+// машины) по возрастанию в ограниченной памяти. Этап 1: файл читается
+// кусками по memory_bytes / 2, каждый сортируется radix_sort и пишется
+// серией во временный файл; пока кусок сортируется, ядро по подсказке
+// prefetch уже читает следующий. Этап 2: серии сливаются группами по
+// fan_in деревом проигравших (TLoserTree) в новый временный файл, пока
+// их не останется не больше fan_in; последний проход пишет в output.
+// Каждый источник читается своим буфером memory_bytes / (fan_in + 1)
+// (в режиме kMmap - окно отображения того же размера), поэтому чтение
+// и запись идут крупными последовательными кусками. Если вход
+// помещается в один кусок, он сортируется в памяти и сразу пишется в
+// output. std::invalid_argument - размер входа не кратен 8 байтам,
+// output совпадает с input, fan_in < 2 или на буфер источника
+// приходится меньше kExternalSortMinBuffer; std::runtime_error -
+// ошибка ввода-вывода. Временные файлы удаляются в любом случае
+TExternalSortStats external_sort(
+    const std::string& input, const std::string& output,
+    const TExternalSortOptions& options = TExternalSortOptions());
+
+// true, если записи файла не убывают
+bool is_sorted_file(const std::string& path, IoMode mode = IoMode::kPread);
+
+// записывает count равномерно распределённых случайных записей
+void generate_records(const std::string& path, uint64_t count,
+                      uint64_t seed);
+
+#endif  // LIB_EXTERNAL_SORT_EXTERNAL_SORT_H_
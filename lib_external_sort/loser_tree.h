@@ -0,0 +1,124 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_EXTERNAL_SORT_LOSER_TREE_H_
+#define LIB_EXTERNAL_SORT_LOSER_TREE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Дерево проигравших для слияния k упорядоченных источников. Листья -
+// текущие элементы источников, во внутренних узлах хранится номер
+// источника, проигравшего сравнение в этом узле, в корне - победитель.
+// После выдачи победителя его источник даёт следующий элемент, и
+// подъём от его листа сравнивает элемент только с проигравшими на пути:
+// не больше ceil(log2 k) сравнений без выбора между двумя детьми (в
+// двоичной куче на уровень приходится по два сравнения). Число
+// источников любое, не только степень двойки. При равных элементах
+// побеждает источник с меньшим номером, поэтому слияние устойчиво.
+// Исчерпанный источник закрывается и проигрывает всем остальным
+template <class T, class Less = std::less<T>>
+class TLoserTree {
+ public:
+    explicit TLoserTree(size_t ways, Less less = Less())
+        : values_(ways), open_(ways, 0), nodes_(ways, 0),
+          open_count_(0), less_(less) {
+        if (ways == 0) {
+            throw std::invalid_argument("TLoserTree: no sources");
+        }
+        if (ways > UINT32_MAX) {
+            throw std::length_error("TLoserTree: too many sources");
+        }
+    }
+
+    size_t ways() const noexcept { return values_.size(); }
+    // true - все источники исчерпаны
+    bool empty() const noexcept { return open_count_ == 0; }
+
+    // начальный элемент источника way (до build())
+    void set(size_t way, T value) {
+        values_.at(way) = std::move(value);
+        if (!open_[way]) {
+            open_[way] = 1;
+            open_count_++;
+        }
+    }
+
+    // турнир по начальным элементам; источники без set() пусты
+    void build() {
+        size_t ways = values_.size();
+        std::vector<uint32_t> winners(ways);
+        for (size_t node = ways - 1; node >= 1; node--) {
+            uint32_t left = winner_of(2 * node, winners);
+            uint32_t right = winner_of(2 * node + 1, winners);
+            if (beats(left, right)) {
+                winners[node] = left;
+                nodes_[node] = right;
+            } else {
+                winners[node] = right;
+                nodes_[node] = left;
+            }
+        }
+        nodes_[0] = ways == 1 ? 0 : winners[1];
+    }
+
+    // источник и элемент победителя (при !empty())
+    size_t winner() const noexcept { return nodes_[0]; }
+    const T& top() const noexcept { return values_[nodes_[0]]; }
+
+    // источник победителя дал следующий элемент
+    void replace_top(T value) {
+        values_[nodes_[0]] = std::move(value);
+        replay(nodes_[0]);
+    }
+
+    // источник победителя исчерпан
+    void pop_top() {
+        open_[nodes_[0]] = 0;
+        open_count_--;
+        replay(nodes_[0]);
+    }
+
+ private:
+    // лист источника way - узел ways + way
+    uint32_t winner_of(size_t node, const std::vector<uint32_t>& winners)
+        const noexcept {
+        return node >= values_.size() ?
+               static_cast<uint32_t>(node - values_.size()) : winners[node];
+    }
+
+    // a побеждает b; при равенстве - меньший номер, поэтому хватает
+    // одного сравнения
+    bool beats(uint32_t a, uint32_t b) const {
+        if (open_[a] != open_[b]) {
+            return open_[a] != 0;
+        }
+        if (!open_[a]) {
+            return a < b;
+        }
+        return a < b ? !less_(values_[b], values_[a])
+                     : less_(values_[a], values_[b]);
+    }
+
+    void replay(uint32_t way) {
+        uint32_t winner = way;
+        for (size_t node = (values_.size() + way) / 2; node >= 1; node /= 2) {
+            if (beats(nodes_[node], winner)) {
+                std::swap(nodes_[node], winner);
+            }
+        }
+        nodes_[0] = winner;
+    }
+
+    std::vector<T> values_;
+    std::vector<uint8_t> open_;
+    // nodes_[0] - победитель, nodes_[1 .. ways) - проигравшие
+    std::vector<uint32_t> nodes_;
+    size_t open_count_;
+    Less less_;
+};
+
+#endif  // LIB_EXTERNAL_SORT_LOSER_TREE_H_
@@ -0,0 +1,217 @@
+// Copyright 2024 Marina Usova
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include "../lib_external_sort/record_file.h"
+
+namespace {
+
+[[noreturn]] void throw_io_error(const char* action, const std::string& path) {
+    throw std::runtime_error(std::string("TExternalSort: cannot ") + action +
+                             " '" + path + "': " + std::strerror(errno));
+}
+
+#if !defined(_WIN32)
+uint64_t page_size() {
+    static const uint64_t kPageSize =
+        static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    return kPageSize;
+}
+#endif
+
+}  // namespace
+
+#if defined(_WIN32)
+
+TInputFile::TInputFile(const std::string& path, IoMode mode)
+    : path_(path), mode_(IoMode::kPread), size_(0), fd_(-1),
+      stream_(std::fopen(path.c_str(), "rb")), mapping_(nullptr) {
+    (void)mode;
+    if (stream_ == nullptr) {
+        throw_io_error("open", path_);
+    }
+    _fseeki64(stream_, 0, SEEK_END);
+    size_ = static_cast<uint64_t>(_ftelli64(stream_));
+}
+
+TInputFile::~TInputFile() { std::fclose(stream_); }
+
+void TInputFile::read(uint64_t offset, void* buffer, size_t bytes) const {
+    if (_fseeki64(stream_, static_cast<int64_t>(offset), SEEK_SET) != 0 ||
+        std::fread(buffer, 1, bytes, stream_) != bytes) {
+        throw_io_error("read", path_);
+    }
+}
+
+void TInputFile::prefetch(uint64_t, size_t) const noexcept {}
+
+void TInputFile::release(uint64_t, size_t) const noexcept {}
+
+TOutputFile::TOutputFile(const std::string& path)
+    : path_(path), fd_(-1), stream_(std::fopen(path.c_str(), "wb")) {
+    if (stream_ == nullptr) {
+        throw_io_error("create", path_);
+    }
+}
+
+TOutputFile::~TOutputFile() {
+    if (stream_ != nullptr) {
+        std::fclose(stream_);
+    }
+}
+
+void TOutputFile::write(const void* data, size_t bytes) {
+    if (std::fwrite(data, 1, bytes, stream_) != bytes) {
+        throw_io_error("write", path_);
+    }
+}
+
+void TOutputFile::close() {
+    if (stream_ == nullptr) {
+        return;
+    }
+    std::FILE* stream = stream_;
+    stream_ = nullptr;
+    if (std::fclose(stream) != 0) {
+        throw_io_error("close", path_);
+    }
+}
+
+#else
+
+TInputFile::TInputFile(const std::string& path, IoMode mode)
+    : path_(path), mode_(mode), size_(0), fd_(open(path.c_str(), O_RDONLY)),
+      stream_(nullptr), mapping_(nullptr) {
+    if (fd_ < 0) {
+        throw_io_error("open", path_);
+    }
+    struct stat info;
+    if (fstat(fd_, &info) != 0) {
+        ::close(fd_);
+        throw_io_error("stat", path_);
+    }
+    size_ = static_cast<uint64_t>(info.st_size);
+    posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+    if (mode_ == IoMode::kMmap && size_ > 0) {
+        void* mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd_);
+            throw_io_error("map", path_);
+        }
+        mapping_ = static_cast<unsigned char*>(mapping);
+        madvise(mapping_, size_, MADV_SEQUENTIAL);
+    }
+}
+
+TInputFile::~TInputFile() {
+    if (mapping_ != nullptr) {
+        munmap(mapping_, size_);
+    }
+    ::close(fd_);
+}
+
+void TInputFile::read(uint64_t offset, void* buffer, size_t bytes) const {
+    if (mapping_ != nullptr) {
+        std::memcpy(buffer, mapping_ + offset, bytes);
+        return;
+    }
+    char* target = static_cast<char*>(buffer);
+    while (bytes > 0) {
+        ssize_t done = pread(fd_, target, bytes, static_cast<off_t>(offset));
+        if (done < 0 && errno == EINTR) {
+            continue;
+        }
+        if (done <= 0) {
+            if (done == 0) {
+                errno = EIO;
+            }
+            throw_io_error("read", path_);
+        }
+        target += done;
+        offset += static_cast<uint64_t>(done);
+        bytes -= static_cast<size_t>(done);
+    }
+}
+
+void TInputFile::prefetch(uint64_t offset, size_t bytes) const noexcept {
+    if (offset >= size_ || bytes == 0) {
+        return;
+    }
+    uint64_t begin = offset / page_size() * page_size();
+    uint64_t end = std::min<uint64_t>(size_, offset + bytes);
+    if (mapping_ != nullptr) {
+        madvise(mapping_ + begin, end - begin, MADV_WILLNEED);
+    } else {
+        posix_fadvise(fd_, static_cast<off_t>(begin),
+                      static_cast<off_t>(end - begin), POSIX_FADV_WILLNEED);
+    }
+}
+
+void TInputFile::release(uint64_t offset, size_t bytes) const noexcept {
+    // отдаются только страницы, целиком лежащие внутри диапазона
+    uint64_t begin = (offset + page_size() - 1) / page_size() * page_size();
+    uint64_t end = std::min<uint64_t>(size_, offset + bytes) / page_size() *
+                   page_size();
+    if (begin >= end) {
+        return;
+    }
+    if (mapping_ != nullptr) {
+        madvise(mapping_ + begin, end - begin, MADV_DONTNEED);
+    } else {
+        posix_fadvise(fd_, static_cast<off_t>(begin),
+                      static_cast<off_t>(end - begin), POSIX_FADV_DONTNEED);
+    }
+}
+
+TOutputFile::TOutputFile(const std::string& path)
+    : path_(path), fd_(open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)),
+      stream_(nullptr) {
+    if (fd_ < 0) {
+        throw_io_error("create", path_);
+    }
+}
+
+TOutputFile::~TOutputFile() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+void TOutputFile::write(const void* data, size_t bytes) {
+    const char* source = static_cast<const char*>(data);
+    while (bytes > 0) {
+        ssize_t done = ::write(fd_, source, bytes);
+        if (done < 0 && errno == EINTR) {
+            continue;
+        }
+        if (done < 0) {
+            throw_io_error("write", path_);
+        }
+        source += done;
+        bytes -= static_cast<size_t>(done);
+    }
+}
+
+void TOutputFile::close() {
+    if (fd_ < 0) {
+        return;
+    }
+    int fd = fd_;
+    fd_ = -1;
+    if (::close(fd) != 0) {
+        throw_io_error("close", path_);
+    }
+}
+
+#endif  // _WIN32
@@ -0,0 +1,74 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_EXTERNAL_SORT_RECORD_FILE_H_
+#define LIB_EXTERNAL_SORT_RECORD_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// способ чтения файла
+enum class IoMode {
+    kPread,  // pread в буфер вызывающего, ядро читает вперёд
+    kMmap    // отображение файла в память без копирования
+};
+
+// Файл только для чтения с доступом по смещению. В режиме kPread куски
+// копируются вызовом pread в буфер вызывающего, а posix_fadvise
+// (SEQUENTIAL) удваивает окно упреждающего чтения ядра. В режиме kMmap
+// файл отображается целиком, data() даёт указатель на его байты, а
+// prefetch/release управляют страницами: MADV_WILLNEED начинает чтение
+// следующего окна заранее, MADV_DONTNEED отдаёт прочитанное, чтобы
+// объём резидентной памяти не рос с размером файла. На Windows оба
+// режима читают через fread. Ошибки ввода-вывода - std::runtime_error
+class TInputFile {
+ public:
+    TInputFile(const std::string& path, IoMode mode);
+    ~TInputFile();
+
+    TInputFile(const TInputFile&) = delete;
+    TInputFile& operator=(const TInputFile&) = delete;
+
+    uint64_t size() const noexcept { return size_; }
+    IoMode mode() const noexcept { return mode_; }
+    // байты файла в режиме kMmap (иначе nullptr)
+    const unsigned char* data() const noexcept { return mapping_; }
+
+    // копирует [offset, offset + bytes) в buffer
+    void read(uint64_t offset, void* buffer, size_t bytes) const;
+    // [offset, offset + bytes) скоро понадобится
+    void prefetch(uint64_t offset, size_t bytes) const noexcept;
+    // [offset, offset + bytes) больше не понадобится
+    void release(uint64_t offset, size_t bytes) const noexcept;
+
+ private:
+    std::string path_;
+    IoMode mode_;
+    uint64_t size_;
+    int fd_;
+    std::FILE* stream_;
+    unsigned char* mapping_;
+};
+
+// Файл, записываемый последовательно крупными кусками (write без
+// буферизации библиотеки C). close() сообщает об ошибке исключением,
+// повторный close() ничего не делает, деструктор закрывает молча
+class TOutputFile {
+ public:
+    explicit TOutputFile(const std::string& path);
+    ~TOutputFile();
+
+    TOutputFile(const TOutputFile&) = delete;
+    TOutputFile& operator=(const TOutputFile&) = delete;
+
+    void write(const void* data, size_t bytes);
+    void close();
+
+ private:
+    std::string path_;
+    int fd_;
+    std::FILE* stream_;
+};
+
+#endif  // LIB_EXTERNAL_SORT_RECORD_FILE_H_
@@ -0,0 +1,517 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_HASH_TABLE_HASH_MAP_H_
+#define LIB_HASH_TABLE_HASH_MAP_H_
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HASH_TABLE_SSE2
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// перемешивание битов хеша (финализатор MurmurHash3): std::hash для целых
+// часто тождественный, а таблице нужны «случайные» и младшие, и старшие биты
+inline size_t hash_mix(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return static_cast<size_t>(value);
+}
+
+// хеш по умолчанию для THashMap
+template <class K>
+struct THash {
+    size_t operator()(const K& key) const {
+        return hash_mix(static_cast<uint64_t>(std::hash<K>()(key)));
+    }
+};
+
+// строки хешируются через std::string_view, поэтому искать в таблице со
+// строковыми ключами можно по string_view и const char* без создания
+// временной std::string (гетерогенный поиск)
+template <>
+struct THash<std::string> {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view key) const {
+        return hash_mix(
+            static_cast<uint64_t>(std::hash<std::string_view>()(key)));
+    }
+};
+
+// Группа из 16 управляющих байтов, которые сравниваются одной
+// SSE2-инструкцией. Управляющий байт: kEmpty, kDeleted или 7 младших битов
+// хеша (H2) занятой ячейки.
+class TControlGroup {
+ public:
+    static constexpr size_t kWidth = 16;
+    static constexpr int8_t kEmpty = -128;   // 0b10000000
+    static constexpr int8_t kDeleted = -2;   // 0b11111110
+
+    explicit TControlGroup(const int8_t* control) {
+#ifdef HASH_TABLE_SSE2
+        bytes_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+#else
+        std::memcpy(bytes_, control, kWidth);
+#endif
+    }
+
+    // битовая маска ячеек с заданным H2
+    uint32_t match(int8_t h2) const {
+#ifdef HASH_TABLE_SSE2
+        return static_cast<uint32_t>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(bytes_, _mm_set1_epi8(h2))));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kWidth; i++) {
+            mask |= static_cast<uint32_t>(bytes_[i] == h2) << i;
+        }
+        return mask;
+#endif
+    }
+
+    uint32_t match_empty() const { return match(kEmpty); }
+
+    // пустые и удалённые ячейки - единственные с установленным старшим битом
+    uint32_t match_empty_or_deleted() const {
+#ifdef HASH_TABLE_SSE2
+        return static_cast<uint32_t>(_mm_movemask_epi8(bytes_));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kWidth; i++) {
+            mask |= static_cast<uint32_t>(bytes_[i] < 0) << i;
+        }
+        return mask;
+#endif
+    }
+
+ private:
+#ifdef HASH_TABLE_SSE2
+    __m128i bytes_;
+#else
+    int8_t bytes_[kWidth];
+#endif
+};
+
+inline int count_trailing_zeros(uint32_t mask) {
+#ifdef _MSC_VER
+    unsigned long index;  // NOLINT(runtime/int)
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+// Хеш-таблица с открытой адресацией в стиле Swiss table (Abseil):
+// - ключи и значения лежат подряд в одном массиве ячеек, рядом - массив
+//   управляющих байтов; поиск сравнивает 16 байтов за раз и обращается
+//   к ячейке, только если совпали 7 битов хеша, поэтому промах почти
+//   никогда не читает сами ключи;
+// - пробирование квадратичное по группам, поиск останавливается на группе
+//   с пустой ячейкой;
+// - удаление оставляет «надгробие» (kDeleted); когда свободные ячейки
+//   кончаются, а значительная часть занятых - надгробия, таблица
+//   перестраивается без увеличения ёмкости;
+// - максимальная загрузка 7/8.
+// Ключ элемента, полученного через итератор, изменять нельзя.
+template <class K, class V, class Hash = THash<K>,
+          class Equal = std::equal_to<>>
+class THashMap {
+    template <class T, class = void>
+    struct is_transparent : std::false_type {};
+    template <class T>
+    struct is_transparent<T, std::void_t<typename T::is_transparent>>
+        : std::true_type {};
+
+    // поиск по типу Q, отличному от K, разрешён только при прозрачных
+    // Hash и Equal
+    template <class Q>
+    using EnableLookup = typename std::enable_if<
+        std::is_same<Q, K>::value ||
+        (is_transparent<Hash>::value && is_transparent<Equal>::value)>::type;
+
+ public:
+    using value_type = std::pair<K, V>;
+
+    template <bool IsConst>
+    class TIterator {
+        using Map = typename std::conditional<IsConst, const THashMap,
+                                              THashMap>::type;
+        using Value = typename std::conditional<IsConst, const value_type,
+                                                value_type>::type;
+
+     public:
+        TIterator(Map* map, size_t index) : map_(map), index_(index) {
+            skip_free();
+        }
+        TIterator(const TIterator&) = default;
+        TIterator& operator=(const TIterator&) = default;
+        // неконстантный итератор приводится к константному
+        template <bool OtherConst,
+                  class = typename std::enable_if<IsConst && !OtherConst>::type>
+        TIterator(const TIterator<OtherConst>& other)  // NOLINT
+            : map_(other.map_), index_(other.index_) {}
+
+        Value& operator*() const { return map_->slots_[index_]; }
+        Value* operator->() const { return &map_->slots_[index_]; }
+
+        TIterator& operator++() {
+            index_++;
+            skip_free();
+            return *this;
+        }
+
+        bool operator==(const TIterator& other) const {
+            return index_ == other.index_;
+        }
+        bool operator!=(const TIterator& other) const {
+            return index_ != other.index_;
+        }
+
+     private:
+        friend class THashMap;
+        template <bool>
+        friend class TIterator;
+
+        void skip_free() {
+            while (index_ < map_->capacity_ && map_->control_[index_] < 0) {
+                index_++;
+            }
+        }
+
+        Map* map_;
+        size_t index_;
+    };
+
+    using iterator = TIterator<false>;
+    using const_iterator = TIterator<true>;
+
+    THashMap() noexcept
+        : control_(empty_group()), slots_(nullptr), capacity_(0), size_(0),
+          growth_left_(0) {}
+
+    explicit THashMap(size_t expected_size) : THashMap() {
+        reserve(expected_size);
+    }
+
+    THashMap(const THashMap& other) : THashMap() {
+        reserve(other.size_);
+        for (const value_type& item : other) {
+            insert_unique(hash_of(item.first), item);
+        }
+    }
+
+    THashMap(THashMap&& other) noexcept : THashMap() {
+        swap(other);
+    }
+
+    THashMap& operator=(THashMap other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~THashMap() {
+        destroy_all();
+    }
+
+    void swap(THashMap& other) noexcept {
+        std::swap(control_, other.control_);
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(growth_left_, other.growth_left_);
+    }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_t capacity() const noexcept { return capacity_; }
+    double load_factor() const noexcept {
+        return capacity_ == 0 ? 0.0 : static_cast<double>(size_) / capacity_;
+    }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, capacity_); }
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(this, capacity_);
+    }
+
+    // --- поиск (для прозрачных Hash и Equal - по любому сравнимому типу) --
+
+    template <class Q = K, class = EnableLookup<Q>>
+    iterator find(const Q& key) {
+        return iterator(this, find_index(key));
+    }
+    template <class Q = K, class = EnableLookup<Q>>
+    const_iterator find(const Q& key) const {
+        return const_iterator(this, find_index(key));
+    }
+    template <class Q = K, class = EnableLookup<Q>>
+    bool contains(const Q& key) const {
+        return find_index(key) != capacity_;
+    }
+    template <class Q = K, class = EnableLookup<Q>>
+    size_t count(const Q& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    V& at(const K& key) {
+        size_t index = find_index(key);
+        if (index == capacity_) {
+            throw std::out_of_range("THashMap: key is not found");
+        }
+        return slots_[index].second;
+    }
+
+    // --- вставка ---
+
+    // вставляет (key, V(args...)), если ключа ещё нет
+    template <class... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) {
+        size_t hash = hash_of(key);
+        size_t index = find_index(key, hash);
+        if (index != capacity_) {
+            return { iterator(this, index), false };
+        }
+        index = insert_unique(hash, std::piecewise_construct,
+                              std::forward_as_tuple(key),
+                              std::forward_as_tuple(
+                                  std::forward<Args>(args)...));
+        return { iterator(this, index), true };
+    }
+
+    std::pair<iterator, bool> insert(const value_type& item) {
+        return try_emplace(item.first, item.second);
+    }
+
+    std::pair<iterator, bool> insert(const K& key, const V& value) {
+        return try_emplace(key, value);
+    }
+
+    V& operator[](const K& key) {
+        return try_emplace(key).first->second;
+    }
+
+    // --- удаление ---
+
+    template <class Q = K, class = EnableLookup<Q>>
+    size_t erase(const Q& key) {
+        size_t index = find_index(key);
+        if (index == capacity_) {
+            return 0;
+        }
+        erase_at(index);
+        return 1;
+    }
+
+    iterator erase(const_iterator position) {
+        erase_at(position.index_);
+        return iterator(this, position.index_ + 1);
+    }
+
+    void clear() noexcept {
+        destroy_all();
+        control_ = empty_group();
+        slots_ = nullptr;
+        capacity_ = 0;
+        size_ = 0;
+        growth_left_ = 0;
+    }
+
+    // ёмкость, достаточная для count элементов без перестроения
+    void reserve(size_t count) {
+        size_t capacity = capacity_for(count);
+        if (capacity > capacity_) {
+            rehash_to(capacity);
+        }
+    }
+
+ private:
+    static int8_t* empty_group() {
+        // общая группа из пустых ячеек для таблицы без памяти: поиск в ней
+        // сразу заканчивается, не требуя проверок capacity_ == 0
+        alignas(16) static int8_t group[TControlGroup::kWidth] = {
+            -128, -128, -128, -128, -128, -128, -128, -128,
+            -128, -128, -128, -128, -128, -128, -128, -128 };
+        return group;
+    }
+
+    static size_t capacity_for(size_t count) {
+        if (count == 0) {
+            return 0;
+        }
+        size_t capacity = TControlGroup::kWidth;
+        while (capacity / 8 * 7 < count) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    template <class Q>
+    size_t hash_of(const Q& key) const {
+        return Hash()(key);
+    }
+
+    static int8_t h2(size_t hash) {
+        return static_cast<int8_t>(hash & 0x7F);
+    }
+
+    template <class Q>
+    size_t find_index(const Q& key) const {
+        return find_index(key, hash_of(key));
+    }
+
+    // индекс ячейки с ключом или capacity_, если ключа нет
+    template <class Q>
+    size_t find_index(const Q& key, size_t hash) const {
+        if (capacity_ == 0) {
+            return 0;
+        }
+        size_t mask = capacity_ - 1;
+        size_t position = (hash >> 7) & mask;
+        size_t stride = 0;
+        while (true) {
+            TControlGroup group(control_ + position);
+            for (uint32_t bits = group.match(h2(hash)); bits != 0;
+                 bits &= bits - 1) {
+                size_t index = (position + count_trailing_zeros(bits)) & mask;
+                if (Equal()(slots_[index].first, key)) {
+                    return index;
+                }
+            }
+            if (group.match_empty() != 0) {
+                return capacity_;
+            }
+            stride += TControlGroup::kWidth;
+            position = (position + stride) & mask;
+        }
+    }
+
+    // первая пустая или удалённая ячейка на пути пробирования
+    size_t find_free(size_t hash) const {
+        size_t mask = capacity_ - 1;
+        size_t position = (hash >> 7) & mask;
+        size_t stride = 0;
+        while (true) {
+            TControlGroup group(control_ + position);
+            uint32_t bits = group.match_empty_or_deleted();
+            if (bits != 0) {
+                return (position + count_trailing_zeros(bits)) & mask;
+            }
+            stride += TControlGroup::kWidth;
+            position = (position + stride) & mask;
+        }
+    }
+
+    // байты [capacity, capacity + 15) повторяют начало массива, чтобы
+    // группу можно было читать с любой позиции без проверки границ
+    void set_control(size_t index, int8_t value) {
+        control_[index] = value;
+        if (index < TControlGroup::kWidth - 1) {
+            control_[capacity_ + index] = value;
+        }
+    }
+
+    // вставка ключа, которого точно нет в таблице
+    template <class... Args>
+    size_t insert_unique(size_t hash, Args&&... args) {
+        size_t index = capacity_ == 0 ? 0 : find_free(hash);
+        if (growth_left_ == 0 && (capacity_ == 0 ||
+                                  control_[index] == TControlGroup::kEmpty)) {
+            grow_or_cleanup();
+            index = find_free(hash);
+        }
+        new (slots_ + index) value_type(std::forward<Args>(args)...);
+        if (control_[index] == TControlGroup::kEmpty) {
+            growth_left_--;
+        }
+        set_control(index, h2(hash));
+        size_++;
+        return index;
+    }
+
+    void erase_at(size_t index) {
+        slots_[index].~value_type();
+        set_control(index, TControlGroup::kDeleted);
+        size_--;
+    }
+
+    // свободные ячейки кончились: если хотя бы половина допустимой загрузки
+    // ушла на надгробия, перестраиваем таблицу той же ёмкости, иначе растём
+    void grow_or_cleanup() {
+        if (capacity_ != 0 && size_ <= capacity_ / 8 * 7 / 2) {
+            rehash_to(capacity_);
+        } else {
+            rehash_to(capacity_ == 0 ? TControlGroup::kWidth
+                                     : capacity_ * 2);
+        }
+    }
+
+    void rehash_to(size_t capacity) {
+        int8_t* old_control = control_;
+        value_type* old_slots = slots_;
+        size_t old_capacity = capacity_;
+
+        control_ = new int8_t[capacity + TControlGroup::kWidth];
+        std::memset(control_, TControlGroup::kEmpty,
+                    capacity + TControlGroup::kWidth);
+        slots_ = static_cast<value_type*>(
+            ::operator new(capacity * sizeof(value_type)));
+        capacity_ = capacity;
+        growth_left_ = capacity / 8 * 7 - size_;
+
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (old_control[i] >= 0) {
+                size_t hash = hash_of(old_slots[i].first);
+                size_t index = find_free(hash);
+                new (slots_ + index) value_type(std::move(old_slots[i]));
+                old_slots[i].~value_type();
+                set_control(index, h2(hash));
+            }
+        }
+        if (old_capacity != 0) {
+            delete[] old_control;
+            ::operator delete(old_slots);
+        }
+    }
+
+    void destroy_all() noexcept {
+        if (capacity_ == 0) {
+            return;
+        }
+        for (size_t i = 0; i < capacity_; i++) {
+            if (control_[i] >= 0) {
+                slots_[i].~value_type();
+            }
+        }
+        delete[] control_;
+        ::operator delete(slots_);
+    }
+
+    int8_t* control_;
+    value_type* slots_;
+    size_t capacity_;       // степень двойки, не меньше 16 (или 0)
+    size_t size_;
+    size_t growth_left_;    // сколько пустых ячеек ещё можно занять
+};
+
+#endif  // LIB_HASH_TABLE_HASH_MAP_H_
@@ -0,0 +1,275 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_HEAP_D_ARY_HEAP_H_
+#define LIB_HEAP_D_ARY_HEAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// выравнивание хранилища кучи (строка кэша)
+const size_t kHeapAlignment = 64;
+
+namespace heap_detail {
+
+// просеивание вверх методом «дырки»: элемент value ставится на место
+// hole и поднимается, пока он меньше родителя; родители сдвигаются вниз
+// перемещением, без обменов. Moved(target, position) сообщает, что
+// элемент оказался на позиции position
+template <size_t Arity, class T, class Less, class Moved>
+void sift_up(T* heap, size_t hole, T value, Less& less, Moved moved) {
+    while (hole > 0) {
+        size_t parent = (hole - 1) / Arity;
+        if (!less(value, heap[parent])) {
+            break;
+        }
+        heap[hole] = std::move(heap[parent]);
+        moved(heap[hole], hole);
+        hole = parent;
+    }
+    heap[hole] = std::move(value);
+    moved(heap[hole], hole);
+}
+
+// просеивание вниз: на каждом уровне выбирается наименьший из Arity
+// детей (они лежат подряд), и он поднимается в дырку
+template <size_t Arity, class T, class Less, class Moved>
+void sift_down(T* heap, size_t size, size_t hole, T value, Less& less,
+               Moved moved) {
+    while (true) {
+        size_t first = hole * Arity + 1;
+        if (first >= size) {
+            break;
+        }
+        size_t last = std::min(first + Arity, size);
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++) {
+            if (less(heap[child], heap[best])) {
+                best = child;
+            }
+        }
+        if (!less(heap[best], value)) {
+            break;
+        }
+        heap[hole] = std::move(heap[best]);
+        moved(heap[hole], hole);
+        hole = best;
+    }
+    heap[hole] = std::move(value);
+    moved(heap[hole], hole);
+}
+
+struct TIgnoreMove {
+    template <class T>
+    void operator()(const T&, size_t) const noexcept {}
+};
+
+}  // namespace heap_detail
+
+// d-арная куча с минимумом на вершине (порядок задаёт Less; для кучи с
+// максимумом - std::greater). У узла i дети i*Arity+1 .. i*Arity+Arity.
+// Перед корнем хранится Arity-1 пустых мест, поэтому группа детей любого
+// узла начинается с адреса, кратного Arity*sizeof(T), а хранилище
+// выровнено по kHeapAlignment: при Arity*sizeof(T) == 64 все дети узла
+// лежат в одной строке кэша, и выбор наименьшего стоит одного промаха.
+// Большая арность - ниже дерево и меньше промахов при pop, но больше
+// сравнений на уровень; лучшее значение подбирается бенчмарком.
+template <class T, size_t Arity = 4, class Less = std::less<T>>
+class TDaryHeap {
+    static_assert(Arity >= 2, "heap arity must be at least 2");
+
+ public:
+    using value_type = T;
+
+    static constexpr size_t kArity = Arity;
+
+    explicit TDaryHeap(Less less = Less())
+        : heap_(nullptr), capacity_(0), size_(0), less_(less) {}
+
+    // строит кучу из values за O(n) (просеиванием вниз от последнего
+    // внутреннего узла к корню)
+    explicit TDaryHeap(const std::vector<T>& values, Less less = Less())
+        : TDaryHeap(less) {
+        reserve(values.size());
+        for (const T& value : values) {
+            new (heap_ + size_) T(value);
+            size_++;
+        }
+        if (size_ > 1) {
+            for (size_t i = (size_ - 2) / Arity + 1; i-- > 0;) {
+                T value(std::move(heap_[i]));
+                heap_detail::sift_down<Arity>(heap_, size_, i,
+                                              std::move(value), less_,
+                                              heap_detail::TIgnoreMove());
+            }
+        }
+    }
+
+    TDaryHeap(const TDaryHeap& other) : TDaryHeap(other.less_) {
+        reserve(other.size_);
+        for (size_t i = 0; i < other.size_; i++) {
+            new (heap_ + i) T(other.heap_[i]);
+            size_++;
+        }
+    }
+
+    TDaryHeap(TDaryHeap&& other) noexcept : TDaryHeap(other.less_) {
+        swap(other);
+    }
+
+    TDaryHeap& operator=(const TDaryHeap& other) {
+        if (this != &other) {
+            TDaryHeap copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    TDaryHeap& operator=(TDaryHeap&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~TDaryHeap() {
+        clear();
+        release(heap_);
+    }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_t capacity() const noexcept { return capacity_; }
+
+    // элементы в порядке хранения кучи (корень - первый)
+    const T* data() const noexcept { return heap_; }
+
+    const T& top() const {
+        check_not_empty();
+        return heap_[0];
+    }
+
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    template <class... Args>
+    void emplace(Args&&... args) {
+        T value(std::forward<Args>(args)...);
+        if (size_ == capacity_) {
+            reserve(std::max<size_t>(capacity_ * 2, kMinCapacity));
+        }
+        // новое место заполняется перемещением, чтобы дырка была
+        // сконструированным объектом
+        new (heap_ + size_) T(std::move(value));
+        size_++;
+        T moving(std::move(heap_[size_ - 1]));
+        heap_detail::sift_up<Arity>(heap_, size_ - 1, std::move(moving),
+                                    less_, heap_detail::TIgnoreMove());
+    }
+
+    void pop() {
+        check_not_empty();
+        size_--;
+        if (size_ > 0) {
+            T last(std::move(heap_[size_]));
+            heap_detail::sift_down<Arity>(heap_, size_, 0, std::move(last),
+                                          less_, heap_detail::TIgnoreMove());
+        }
+        heap_[size_].~T();
+    }
+
+    // снимает вершину и возвращает её значение
+    T take() {
+        check_not_empty();
+        T value(std::move(heap_[0]));
+        pop();
+        return value;
+    }
+
+    // заменяет вершину новым значением за одно просеивание (вместо
+    // pop + push)
+    void replace_top(T value) {
+        check_not_empty();
+        heap_detail::sift_down<Arity>(heap_, size_, 0, std::move(value),
+                                      less_, heap_detail::TIgnoreMove());
+    }
+
+    void clear() noexcept {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < size_; i++) {
+                heap_[i].~T();
+            }
+        }
+        size_ = 0;
+    }
+
+    void reserve(size_t capacity) {
+        if (capacity <= capacity_) {
+            return;
+        }
+        T* target = allocate(capacity);
+        size_t moved = 0;
+        try {
+            for (; moved < size_; moved++) {
+                new (target + moved) T(std::move_if_noexcept(heap_[moved]));
+            }
+        } catch (...) {
+            for (size_t i = 0; i < moved; i++) {
+                target[i].~T();
+            }
+            release(target);
+            throw;
+        }
+        size_t size = size_;
+        clear();
+        release(heap_);
+        heap_ = target;
+        capacity_ = capacity;
+        size_ = size;
+    }
+
+    void swap(TDaryHeap& other) noexcept {
+        std::swap(heap_, other.heap_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(less_, other.less_);
+    }
+
+ private:
+    static constexpr size_t kMinCapacity = 16;
+    static constexpr size_t kPadding = Arity - 1;
+    static constexpr size_t kAlignment =
+        alignof(T) > kHeapAlignment ? alignof(T) : kHeapAlignment;
+
+    // возвращает указатель на корень: перед ним kPadding пустых мест
+    static T* allocate(size_t capacity) {
+        T* storage = static_cast<T*>(::operator new(
+            (capacity + kPadding) * sizeof(T), std::align_val_t(kAlignment)));
+        return storage + kPadding;
+    }
+
+    static void release(T* heap) noexcept {
+        if (heap != nullptr) {
+            ::operator delete(heap - kPadding, std::align_val_t(kAlignment));
+        }
+    }
+
+    void check_not_empty() const {
+        if (size_ == 0) {
+            throw std::out_of_range("TDaryHeap: heap is empty");
+        }
+    }
+
+    T* heap_;  // корень; хранилище начинается на kPadding мест раньше
+    size_t capacity_;
+    size_t size_;
+    Less less_;
+};
+
+#endif  // LIB_HEAP_D_ARY_HEAP_H_
@@ -0,0 +1,5 @@
+// Copyright 2024 Marina Usova
+
+#include "../lib_heap/d_ary_heap.h"
+#include "../lib_heap/indexed_heap.h"
+#include "../lib_heap/pairing_heap.h"
@@ -0,0 +1,218 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_HEAP_INDEXED_HEAP_H_
+#define LIB_HEAP_INDEXED_HEAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../lib_heap/d_ary_heap.h"
+
+// Индексированная d-арная куча с минимумом на вершине: каждый элемент
+// помечен описателем (handle) - целым числом от 0, обычно номером вершины
+// графа или задачи. Для каждого описателя хранится позиция в куче,
+// поэтому значение элемента можно уменьшить (decrease_key), изменить или
+// удалить за O(log n), а не класть в кучу дубликаты, как приходится
+// делать с std::priority_queue. Таблица позиций растёт до наибольшего
+// использованного описателя (4 байта на описатель).
+template <class T, size_t Arity = 4, class Less = std::less<T>>
+class TIndexedHeap {
+    static_assert(Arity >= 2, "heap arity must be at least 2");
+
+ public:
+    using value_type = T;
+    using Handle = uint32_t;
+
+    // handles - ожидаемое число описателей (таблица позиций резервируется)
+    explicit TIndexedHeap(size_t handles = 0, Less less = Less())
+        : less_(std::move(less)) {
+        positions_.reserve(handles);
+    }
+
+    size_t size() const noexcept { return heap_.size(); }
+    bool empty() const noexcept { return heap_.empty(); }
+
+    bool contains(Handle handle) const noexcept {
+        return handle < positions_.size() && positions_[handle] != kAbsent;
+    }
+
+    const T& value(Handle handle) const {
+        return heap_[position(handle)].value;
+    }
+
+    const T& top() const {
+        check_not_empty();
+        return heap_[0].value;
+    }
+    Handle top_handle() const {
+        check_not_empty();
+        return heap_[0].handle;
+    }
+
+    void push(Handle handle, T value) {
+        if (handle == kAbsent) {
+            throw std::out_of_range("TIndexedHeap: handle is too large");
+        }
+        if (contains(handle)) {
+            throw std::invalid_argument(
+                "TIndexedHeap: handle is already in heap");
+        }
+        if (handle >= positions_.size()) {
+            positions_.resize(static_cast<size_t>(handle) + 1, kAbsent);
+        }
+        heap_.push_back({ std::move(value), handle });
+        TEntry entry(std::move(heap_.back()));
+        heap_detail::sift_up<Arity>(heap_.data(), heap_.size() - 1,
+                                    std::move(entry), less_,
+                                    TTrackMove(this));
+    }
+
+    void pop() {
+        check_not_empty();
+        erase_at(0);
+    }
+
+    // снимает вершину и возвращает её описатель
+    Handle take() {
+        Handle handle = top_handle();
+        erase_at(0);
+        return handle;
+    }
+
+    // уменьшает значение элемента; новое значение не должно быть больше
+    // текущего (иначе std::invalid_argument)
+    void decrease_key(Handle handle, T value) {
+        size_t index = position(handle);
+        if (less_.less(heap_[index].value, value)) {
+            throw std::invalid_argument(
+                "TIndexedHeap: new key is greater than current");
+        }
+        sift_up_at(index, std::move(value));
+    }
+
+    // увеличивает значение элемента; новое значение не должно быть меньше
+    // текущего (иначе std::invalid_argument)
+    void increase_key(Handle handle, T value) {
+        size_t index = position(handle);
+        if (less_.less(value, heap_[index].value)) {
+            throw std::invalid_argument(
+                "TIndexedHeap: new key is less than current");
+        }
+        sift_down_at(index, std::move(value));
+    }
+
+    // меняет значение элемента в любую сторону
+    void update(Handle handle, T value) {
+        size_t index = position(handle);
+        if (less_.less(value, heap_[index].value)) {
+            sift_up_at(index, std::move(value));
+        } else {
+            sift_down_at(index, std::move(value));
+        }
+    }
+
+    // релаксация из алгоритма Дейкстры: добавляет элемент или уменьшает
+    // его значение, если новое меньше. Возвращает true, если куча
+    // изменилась
+    bool push_or_decrease(Handle handle, T value) {
+        if (!contains(handle)) {
+            push(handle, std::move(value));
+            return true;
+        }
+        size_t index = positions_[handle];
+        if (!less_.less(value, heap_[index].value)) {
+            return false;
+        }
+        sift_up_at(index, std::move(value));
+        return true;
+    }
+
+    void erase(Handle handle) { erase_at(position(handle)); }
+
+    void clear() noexcept {
+        for (const TEntry& entry : heap_) {
+            positions_[entry.handle] = kAbsent;
+        }
+        heap_.clear();
+    }
+
+ private:
+    static constexpr Handle kAbsent = UINT32_MAX;
+
+    struct TEntry {
+        T value;
+        Handle handle;
+    };
+
+    // сравнение элементов кучи по значению
+    struct TEntryLess {
+        explicit TEntryLess(Less value) : less(std::move(value)) {}
+        bool operator()(const TEntry& a, const TEntry& b) const {
+            return less(a.value, b.value);
+        }
+        Less less;
+    };
+
+    // при каждом перемещении элемента обновляет таблицу позиций
+    struct TTrackMove {
+        explicit TTrackMove(TIndexedHeap* heap) noexcept : heap_(heap) {}
+        void operator()(const TEntry& entry, size_t position) const noexcept {
+            heap_->positions_[entry.handle] = static_cast<Handle>(position);
+        }
+        TIndexedHeap* heap_;
+    };
+
+    size_t position(Handle handle) const {
+        if (!contains(handle)) {
+            throw std::out_of_range("TIndexedHeap: handle is not in heap");
+        }
+        return positions_[handle];
+    }
+
+    void check_not_empty() const {
+        if (heap_.empty()) {
+            throw std::out_of_range("TIndexedHeap: heap is empty");
+        }
+    }
+
+    void sift_up_at(size_t index, T value) {
+        TEntry entry{ std::move(value), heap_[index].handle };
+        heap_detail::sift_up<Arity>(heap_.data(), index, std::move(entry),
+                                    less_, TTrackMove(this));
+    }
+
+    void sift_down_at(size_t index, T value) {
+        TEntry entry{ std::move(value), heap_[index].handle };
+        heap_detail::sift_down<Arity>(heap_.data(), heap_.size(), index,
+                                      std::move(entry), less_,
+                                      TTrackMove(this));
+    }
+
+    // на место index ставится последний элемент и просеивается в нужную
+    // сторону
+    void erase_at(size_t index) {
+        positions_[heap_[index].handle] = kAbsent;
+        TEntry last(std::move(heap_.back()));
+        heap_.pop_back();
+        if (index == heap_.size()) {
+            return;
+        }
+        if (less_.less(last.value, heap_[index].value)) {
+            heap_detail::sift_up<Arity>(heap_.data(), index, std::move(last),
+                                        less_, TTrackMove(this));
+        } else {
+            heap_detail::sift_down<Arity>(heap_.data(), heap_.size(), index,
+                                          std::move(last), less_,
+                                          TTrackMove(this));
+        }
+    }
+
+    std::vector<TEntry> heap_;
+    std::vector<Handle> positions_;  // позиция в heap_ или kAbsent
+    TEntryLess less_;
+};
+
+#endif  // LIB_HEAP_INDEXED_HEAP_H_
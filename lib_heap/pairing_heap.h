@@ -0,0 +1,282 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_HEAP_PAIRING_HEAP_H_
+#define LIB_HEAP_PAIRING_HEAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "../lib_memory/pool.h"
+
+// Спаривающаяся куча (pairing heap) с минимумом на вершине - для
+// сравнения с d-арными кучами. Каждый элемент - отдельный узел из пула
+// TObjectPool; push возвращает описатель узла, по которому за
+// амортизированное O(log n) выполняются decrease_key и erase (сам
+// decrease_key - O(1) плюс отложенная работа в pop). Кучи с общим
+// пулом (make_pool() и конструктор от пула) сливаются за O(1);
+// слияние куч с разными пулами бросает std::invalid_argument.
+template <class T, class Less = std::less<T>>
+class TPairingHeap {
+    // prev - родитель для первого ребёнка, иначе предыдущий брат
+    struct TNode {
+        template <class... Args>
+        explicit TNode(Args&&... args)
+            : value(std::forward<Args>(args)...), child(nullptr),
+              next(nullptr), prev(nullptr) {}
+
+        T value;
+        TNode* child;
+        TNode* next;
+        TNode* prev;
+    };
+
+ public:
+    using value_type = T;
+    using node_pool = TObjectPool<TNode>;
+
+    // описатель элемента; действителен, пока элемент в куче
+    class THandle {
+     public:
+        THandle() noexcept : node_(nullptr) {}
+        const T& value() const noexcept { return node_->value; }
+        friend bool operator==(THandle a, THandle b) noexcept {
+            return a.node_ == b.node_;
+        }
+        friend bool operator!=(THandle a, THandle b) noexcept {
+            return a.node_ != b.node_;
+        }
+
+     private:
+        friend class TPairingHeap;
+        explicit THandle(TNode* node) noexcept : node_(node) {}
+        TNode* node_;
+    };
+
+    static std::shared_ptr<node_pool> make_pool(size_t nodes_per_slab = 256) {
+        return std::make_shared<node_pool>(nodes_per_slab);
+    }
+
+    explicit TPairingHeap(Less less = Less())
+        : TPairingHeap(make_pool(), std::move(less)) {}
+
+    explicit TPairingHeap(std::shared_ptr<node_pool> pool,
+                          Less less = Less())
+        : pool_(std::move(pool)), root_(nullptr), size_(0),
+          less_(std::move(less)) {
+        if (pool_ == nullptr) {
+            throw std::invalid_argument("TPairingHeap: node pool is null");
+        }
+    }
+
+    TPairingHeap(const TPairingHeap&) = delete;
+    TPairingHeap& operator=(const TPairingHeap&) = delete;
+
+    // перемещённая куча пуста и пользуется тем же пулом
+    TPairingHeap(TPairingHeap&& other) noexcept
+        : pool_(other.pool_), root_(other.root_), size_(other.size_),
+          less_(other.less_) {
+        other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    TPairingHeap& operator=(TPairingHeap&& other) noexcept {
+        if (this != &other) {
+            clear();
+            pool_ = other.pool_;
+            root_ = other.root_;
+            size_ = other.size_;
+            less_ = other.less_;
+            other.root_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    ~TPairingHeap() { clear(); }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const T& top() const {
+        check_not_empty();
+        return root_->value;
+    }
+
+    THandle push(const T& value) { return emplace(value); }
+    THandle push(T&& value) { return emplace(std::move(value)); }
+
+    template <class... Args>
+    THandle emplace(Args&&... args) {
+        TNode* node = pool_->create(std::forward<Args>(args)...);
+        root_ = root_ == nullptr ? node : meld(root_, node);
+        size_++;
+        return THandle(node);
+    }
+
+    void pop() {
+        check_not_empty();
+        TNode* root = root_;
+        root_ = merge_pairs(root->child);
+        pool_->destroy(root);
+        size_--;
+    }
+
+    // снимает вершину и возвращает её значение
+    T take() {
+        check_not_empty();
+        T value(std::move(root_->value));
+        pop();
+        return value;
+    }
+
+    // уменьшает значение элемента: узел отрезается от родителя и
+    // сливается с корнем. Большее значение - std::invalid_argument
+    void decrease_key(THandle handle, T value) {
+        TNode* node = handle.node_;
+        if (less_(node->value, value)) {
+            throw std::invalid_argument(
+                "TPairingHeap: new key is greater than current");
+        }
+        node->value = std::move(value);
+        if (node != root_) {
+            cut(node);
+            root_ = meld(root_, node);
+        }
+    }
+
+    void erase(THandle handle) {
+        TNode* node = handle.node_;
+        if (node == root_) {
+            pop();
+            return;
+        }
+        cut(node);
+        TNode* children = merge_pairs(node->child);
+        if (children != nullptr) {
+            root_ = meld(root_, children);
+        }
+        pool_->destroy(node);
+        size_--;
+    }
+
+    // переносит все элементы other в эту кучу за O(1); описатели
+    // элементов other остаются действительными
+    void merge(TPairingHeap& other) {
+        if (other.pool_ != pool_) {
+            throw std::invalid_argument(
+                "TPairingHeap: heaps use different node pools");
+        }
+        if (&other == this || other.root_ == nullptr) {
+            return;
+        }
+        root_ = root_ == nullptr ? other.root_ : meld(root_, other.root_);
+        size_ += other.size_;
+        other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    // удаляет все элементы обходом без рекурсии: дети узла
+    // подвешиваются в цепочку братьев перед его удалением
+    void clear() noexcept {
+        TNode* node = root_;
+        while (node != nullptr) {
+            if (node->child != nullptr) {
+                TNode* last = node->child;
+                while (last->next != nullptr) {
+                    last = last->next;
+                }
+                last->next = node->next;
+                node->next = node->child;
+                node->child = nullptr;
+            }
+            TNode* next = node->next;
+            pool_->destroy(node);
+            node = next;
+        }
+        root_ = nullptr;
+        size_ = 0;
+    }
+
+ private:
+    void check_not_empty() const {
+        if (size_ == 0) {
+            throw std::out_of_range("TPairingHeap: heap is empty");
+        }
+    }
+
+    // слияние двух корней: больший становится первым ребёнком меньшего
+    TNode* meld(TNode* a, TNode* b) {
+        if (less_(b->value, a->value)) {
+            std::swap(a, b);
+        }
+        b->prev = a;
+        b->next = a->child;
+        if (a->child != nullptr) {
+            a->child->prev = b;
+        }
+        a->child = b;
+        a->next = nullptr;
+        a->prev = nullptr;
+        return a;
+    }
+
+    // отрезает поддерево node от родителя и братьев
+    void cut(TNode* node) noexcept {
+        if (node->prev->child == node) {
+            node->prev->child = node->next;
+        } else {
+            node->prev->next = node->next;
+        }
+        if (node->next != nullptr) {
+            node->next->prev = node->prev;
+        }
+        node->next = nullptr;
+        node->prev = nullptr;
+    }
+
+    // двухпроходное слияние списка братьев: слева направо сливаются
+    // пары (результаты складываются в стек через next), затем справа
+    // налево всё сливается в одно дерево
+    TNode* merge_pairs(TNode* first) {
+        TNode* pairs = nullptr;
+        while (first != nullptr) {
+            TNode* a = first;
+            TNode* b = a->next;
+            if (b == nullptr) {
+                a->prev = nullptr;
+                a->next = pairs;
+                pairs = a;
+                break;
+            }
+            first = b->next;
+            a->next = nullptr;
+            b->next = nullptr;
+            TNode* merged = meld(a, b);
+            merged->next = pairs;
+            pairs = merged;
+        }
+        if (pairs == nullptr) {
+            return nullptr;
+        }
+        TNode* result = pairs;
+        pairs = pairs->next;
+        result->next = nullptr;
+        while (pairs != nullptr) {
+            TNode* node = pairs;
+            pairs = pairs->next;
+            node->next = nullptr;
+            result = meld(result, node);
+        }
+        result->prev = nullptr;
+        return result;
+    }
+
+    std::shared_ptr<node_pool> pool_;
+    TNode* root_;
+    size_t size_;
+    Less less_;
+};
+
+#endif  // LIB_HEAP_PAIRING_HEAP_H_
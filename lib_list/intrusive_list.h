@@ -0,0 +1,256 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_LIST_INTRUSIVE_LIST_H_
+#define LIB_LIST_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "../lib_list/list_links.h"
+
+// Звено интрузивного списка, встраиваемое в объект наследованием:
+//     struct TTask : TListHook<> { ... };
+// Объект, который должен одновременно состоять в нескольких списках,
+// наследует несколько звеньев с разными тегами:
+//     struct TEntry : TListHook<TLruTag>, TListHook<TBucketTag> { ... };
+// При копировании объекта звено не копируется - копия не состоит ни в
+// одном списке. Объект нужно исключить из списка до его уничтожения.
+template <class Tag = void>
+class TListHook {
+ public:
+    TListHook() noexcept : links_{ nullptr, nullptr } {}
+    TListHook(const TListHook&) noexcept : TListHook() {}
+    TListHook& operator=(const TListHook&) noexcept { return *this; }
+
+    bool is_linked() const noexcept { return links_.next != nullptr; }
+
+ private:
+    template <class T, class ListTag>
+    friend class TIntrusiveList;
+
+    list_detail::TLinks links_;
+};
+
+// Интрузивный двусвязный список: узлами служат звенья TListHook<Tag>
+// внутри самих объектов, поэтому вставка и удаление не выделяют память,
+// а объект можно удалить из списка за O(1), зная только его адрес.
+// Список не владеет объектами. Обращение к концам пустого списка и
+// вставка объекта, уже состоящего в списке, бросают исключения.
+template <class T, class Tag = void>
+class TIntrusiveList {
+    static_assert(std::is_base_of<TListHook<Tag>, T>::value,
+                  "T must derive from TListHook<Tag>");
+
+    struct TTraits {
+        using value_type = T;
+        static T* value_of(list_detail::TLinks* links) noexcept {
+            // links_ - единственное поле звена, адреса совпадают
+            return static_cast<T*>(reinterpret_cast<TListHook<Tag>*>(links));
+        }
+    };
+
+ public:
+    using value_type = T;
+    using iterator = list_detail::TListIterator<TTraits, false>;
+    using const_iterator = list_detail::TListIterator<TTraits, true>;
+
+    TIntrusiveList() noexcept : size_(0) { list_detail::init_empty(&head_); }
+
+    TIntrusiveList(const TIntrusiveList&) = delete;
+    TIntrusiveList& operator=(const TIntrusiveList&) = delete;
+
+    TIntrusiveList(TIntrusiveList&& other) noexcept : TIntrusiveList() {
+        swap(other);
+    }
+
+    TIntrusiveList& operator=(TIntrusiveList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~TIntrusiveList() { clear(); }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    iterator begin() noexcept { return iterator(head_.next); }
+    iterator end() noexcept { return iterator(&head_); }
+    const_iterator begin() const noexcept {
+        return const_iterator(head_.next);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(const_cast<list_detail::TLinks*>(&head_));
+    }
+
+    T& front() {
+        check_not_empty();
+        return *TTraits::value_of(head_.next);
+    }
+    const T& front() const {
+        check_not_empty();
+        return *TTraits::value_of(head_.next);
+    }
+    T& back() {
+        check_not_empty();
+        return *TTraits::value_of(head_.prev);
+    }
+    const T& back() const {
+        check_not_empty();
+        return *TTraits::value_of(head_.prev);
+    }
+
+    // итератор на объект, который состоит в этом списке
+    static iterator iterator_to(T& value) noexcept {
+        return iterator(links_of(value));
+    }
+    static const_iterator iterator_to(const T& value) noexcept {
+        return const_iterator(links_of(const_cast<T&>(value)));
+    }
+
+    void push_front(T& value) { insert(begin(), value); }
+    void push_back(T& value) { insert(end(), value); }
+
+    // вставляет value перед position
+    iterator insert(const_iterator position, T& value) {
+        list_detail::TLinks* links = links_of(value);
+        if (links->next != nullptr) {
+            throw std::invalid_argument(
+                "TIntrusiveList: element is already linked");
+        }
+        list_detail::link_before(position.links(), links);
+        size_++;
+        return iterator(links);
+    }
+
+    void pop_front() {
+        check_not_empty();
+        erase(begin());
+    }
+    void pop_back() {
+        check_not_empty();
+        erase(iterator(head_.prev));
+    }
+
+    // исключает элемент из списка, возвращает итератор на следующий
+    iterator erase(const_iterator position) noexcept {
+        list_detail::TLinks* links = position.links();
+        list_detail::TLinks* next = links->next;
+        list_detail::unlink(links);
+        links->prev = links->next = nullptr;
+        size_--;
+        return iterator(next);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        while (first != last) {
+            first = erase(first);
+        }
+        return iterator(last.links());
+    }
+
+    // исключает value, которое состоит в этом списке
+    void remove(T& value) noexcept { erase(iterator_to(value)); }
+
+    // исключает все элементы (их звенья становятся свободными)
+    void clear() noexcept {
+        list_detail::TLinks* links = head_.next;
+        while (links != &head_) {
+            list_detail::TLinks* next = links->next;
+            links->prev = links->next = nullptr;
+            links = next;
+        }
+        list_detail::init_empty(&head_);
+        size_ = 0;
+    }
+
+    // переносит все элементы other перед position за O(1)
+    void splice(const_iterator position, TIntrusiveList& other) noexcept {
+        if (&other == this || other.empty()) {
+            return;
+        }
+        list_detail::transfer(position.links(), other.head_.next,
+                              &other.head_);
+        size_ += other.size_;
+        other.size_ = 0;
+    }
+
+    // переносит один элемент element из other перед position за O(1)
+    void splice(const_iterator position, TIntrusiveList& other,
+                const_iterator element) noexcept {
+        list_detail::TLinks* links = element.links();
+        if (position.links() == links || position.links() == links->next) {
+            return;
+        }
+        list_detail::transfer(position.links(), links, links->next);
+        other.size_--;
+        size_++;
+    }
+
+    // переносит [first, last) из other перед position. Между разными
+    // списками - за O(длины диапазона) из-за пересчёта размеров, внутри
+    // одного списка - за O(1)
+    void splice(const_iterator position, TIntrusiveList& other,
+                const_iterator first, const_iterator last) noexcept {
+        if (&other != this) {
+            size_t count = 0;
+            for (const_iterator it = first; it != last; ++it) {
+                count++;
+            }
+            other.size_ -= count;
+            size_ += count;
+        }
+        list_detail::transfer(position.links(), first.links(), last.links());
+    }
+
+    // устойчивая сортировка слиянием; элементы не перемещаются в памяти
+    template <class Less = std::less<T>>
+    void sort(Less less = Less()) {
+        list_detail::sort(&head_, [&less](list_detail::TLinks* a,
+                                          list_detail::TLinks* b) {
+            return less(*TTraits::value_of(a), *TTraits::value_of(b));
+        });
+    }
+
+    // слияние с упорядоченным other (other становится пустым)
+    template <class Less = std::less<T>>
+    void merge(TIntrusiveList& other, Less less = Less()) {
+        if (&other == this) {
+            return;
+        }
+        list_detail::merge(&head_, &other.head_,
+                           [&less](list_detail::TLinks* a,
+                                   list_detail::TLinks* b) {
+            return less(*TTraits::value_of(a), *TTraits::value_of(b));
+        });
+        size_ += other.size_;
+        other.size_ = 0;
+    }
+
+    void reverse() noexcept { list_detail::reverse(&head_); }
+
+    void swap(TIntrusiveList& other) noexcept {
+        list_detail::swap_lists(&head_, &other.head_);
+        std::swap(size_, other.size_);
+    }
+
+ private:
+    static list_detail::TLinks* links_of(T& value) noexcept {
+        return &static_cast<TListHook<Tag>&>(value).links_;
+    }
+
+    void check_not_empty() const {
+        if (size_ == 0) {
+            throw std::out_of_range("TIntrusiveList: list is empty");
+        }
+    }
+
+    list_detail::TLinks head_;
+    size_t size_;
+};
+
+#endif  // LIB_LIST_INTRUSIVE_LIST_H_
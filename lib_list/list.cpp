@@ -0,0 +1,4 @@
+// Copyright 2024 Marina Usova
+
+#include "../lib_list/intrusive_list.h"
+#include "../lib_list/pool_list.h"
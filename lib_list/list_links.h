@@ -0,0 +1,239 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_LIST_LIST_LINKS_H_
+#define LIB_LIST_LIST_LINKS_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// Общая часть TIntrusiveList и TPoolList: кольцевой двусвязный список
+// со служебным узлом (sentinel), у которого next - первый элемент, а
+// prev - последний. Все операции только перевешивают указатели, поэтому
+// итераторы и ссылки на элементы остаются действительными при вставке,
+// удалении других элементов, splice, sort и merge.
+namespace list_detail {
+
+struct TLinks {
+    TLinks* prev;
+    TLinks* next;
+};
+
+inline void init_empty(TLinks* head) noexcept {
+    head->prev = head;
+    head->next = head;
+}
+
+// вставляет node перед position
+inline void link_before(TLinks* position, TLinks* node) noexcept {
+    node->prev = position->prev;
+    node->next = position;
+    position->prev->next = node;
+    position->prev = node;
+}
+
+inline void unlink(TLinks* node) noexcept {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+}
+
+// переносит [first, last) перед position за O(1); position не должен
+// лежать внутри диапазона
+inline void transfer(TLinks* position, TLinks* first,
+                     TLinks* last) noexcept {
+    if (first == last || position == last) {
+        return;
+    }
+    TLinks* tail = last->prev;
+    first->prev->next = last;
+    last->prev = first->prev;
+
+    TLinks* before = position->prev;
+    before->next = first;
+    first->prev = before;
+    tail->next = position;
+    position->prev = tail;
+}
+
+// меняет местами содержимое двух списков (служебные узлы остаются на
+// своих местах, перевешиваются только соседи)
+inline void swap_lists(TLinks* a, TLinks* b) noexcept {
+    TLinks saved = *a;
+    bool a_empty = a->next == a;
+    bool b_empty = b->next == b;
+    if (b_empty) {
+        init_empty(a);
+    } else {
+        *a = *b;
+        a->next->prev = a;
+        a->prev->next = a;
+    }
+    if (a_empty) {
+        init_empty(b);
+    } else {
+        *b = saved;
+        b->next->prev = b;
+        b->prev->next = b;
+    }
+}
+
+// слияние двух упорядоченных цепочек, связанных только по next и
+// завершённых nullptr; при равенстве первым идёт узел из a (устойчивость)
+template <class Less>
+TLinks* merge_chains(TLinks* a, TLinks* b, Less& less) {
+    TLinks head;
+    TLinks* tail = &head;
+    while (a != nullptr && b != nullptr) {
+        if (less(b, a)) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = a != nullptr ? a : b;
+    return head.next;
+}
+
+// устойчивая сортировка слиянием снизу вверх за O(n log n) и O(1)
+// памяти: bins[i] - уже отсортированная цепочка из 2^i узлов, новый узел
+// сливается с ними, как при прибавлении единицы к двоичному счётчику.
+// Элементы не копируются, меняются только связи.
+template <class Less>
+void sort(TLinks* head, Less less) {
+    if (head->next == head || head->next->next == head) {
+        return;
+    }
+    const size_t kBins = 64;
+    TLinks* bins[kBins] = {};
+    head->prev->next = nullptr;
+    TLinks* chain = head->next;
+    while (chain != nullptr) {
+        TLinks* node = chain;
+        chain = chain->next;
+        node->next = nullptr;
+        size_t i = 0;
+        for (; bins[i] != nullptr; i++) {
+            // в bins[i] узлы, стоявшие раньше, поэтому они - первый аргумент
+            node = merge_chains(bins[i], node, less);
+            bins[i] = nullptr;
+        }
+        bins[i] = node;
+    }
+    TLinks* result = nullptr;
+    for (size_t i = 0; i < kBins; i++) {
+        if (bins[i] != nullptr) {
+            result = result == nullptr ? bins[i]
+                                       : merge_chains(bins[i], result, less);
+        }
+    }
+    // восстановление обратных связей и кольца
+    TLinks* previous = head;
+    for (TLinks* node = result; node != nullptr; node = node->next) {
+        node->prev = previous;
+        previous->next = node;
+        previous = node;
+    }
+    previous->next = head;
+    head->prev = previous;
+}
+
+// слияние упорядоченного списка source в упорядоченный target; из
+// source переносятся целые серии узлов. При равенстве узлы target
+// остаются впереди
+template <class Less>
+void merge(TLinks* target, TLinks* source, Less less) {
+    TLinks* position = target->next;
+    while (source->next != source) {
+        TLinks* first = source->next;
+        while (position != target && !less(first, position)) {
+            position = position->next;
+        }
+        if (position == target) {
+            transfer(target, first, source);
+            return;
+        }
+        TLinks* last = first->next;
+        while (last != source && less(last, position)) {
+            last = last->next;
+        }
+        transfer(position, first, last);
+    }
+}
+
+inline void reverse(TLinks* head) noexcept {
+    TLinks* node = head;
+    do {
+        TLinks* next = node->next;
+        node->next = node->prev;
+        node->prev = next;
+        node = next;
+    } while (node != head);
+}
+
+// двунаправленный итератор; Traits::value_of(TLinks*) возвращает
+// указатель на элемент, которому принадлежат связи
+template <class Traits, bool IsConst>
+class TListIterator {
+    using Value = typename Traits::value_type;
+
+ public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer =
+        typename std::conditional<IsConst, const Value*, Value*>::type;
+    using reference =
+        typename std::conditional<IsConst, const Value&, Value&>::type;
+
+    TListIterator() noexcept : links_(nullptr) {}
+    explicit TListIterator(TLinks* links) noexcept : links_(links) {}
+    // iterator -> const_iterator
+    template <bool OtherConst,
+              class = typename std::enable_if<IsConst && !OtherConst>::type>
+    TListIterator(const TListIterator<Traits, OtherConst>& other) noexcept
+        : links_(other.links()) {}
+
+    reference operator*() const noexcept { return *Traits::value_of(links_); }
+    pointer operator->() const noexcept { return Traits::value_of(links_); }
+
+    TListIterator& operator++() noexcept {
+        links_ = links_->next;
+        return *this;
+    }
+    TListIterator operator++(int) noexcept {
+        TListIterator copy(*this);
+        links_ = links_->next;
+        return copy;
+    }
+    TListIterator& operator--() noexcept {
+        links_ = links_->prev;
+        return *this;
+    }
+    TListIterator operator--(int) noexcept {
+        TListIterator copy(*this);
+        links_ = links_->prev;
+        return copy;
+    }
+
+    friend bool operator==(const TListIterator& left,
+                           const TListIterator& right) noexcept {
+        return left.links_ == right.links_;
+    }
+    friend bool operator!=(const TListIterator& left,
+                           const TListIterator& right) noexcept {
+        return left.links_ != right.links_;
+    }
+
+    // связи узла, на который указывает итератор (для реализации списков)
+    TLinks* links() const noexcept { return links_; }
+
+ private:
+    TLinks* links_;
+};
+
+}  // namespace list_detail
+
+#endif  // LIB_LIST_LIST_LINKS_H_
@@ -0,0 +1,327 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_LIST_POOL_LIST_H_
+#define LIB_LIST_POOL_LIST_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "../lib_list/list_links.h"
+#include "../lib_memory/pool.h"
+
+// Двусвязный список, узлы которого выделяются из пула TObjectPool:
+// узлы лежат подряд в крупных слябах, а не разбросаны по куче, как у
+// std::list, и создание узла не обращается к malloc. Пул может быть
+// общим для нескольких списков (make_pool() и конструктор от пула) -
+// только между такими списками splice переносит узлы за O(1); для
+// списков с разными пулами splice бросает std::invalid_argument.
+// Обращение к концам пустого списка бросает std::out_of_range.
+template <class T>
+class TPoolList {
+    struct TNode : list_detail::TLinks {
+        template <class... Args>
+        explicit TNode(Args&&... args)
+            : list_detail::TLinks{ nullptr, nullptr },
+              value(std::forward<Args>(args)...) {}
+
+        T value;
+    };
+
+    struct TTraits {
+        using value_type = T;
+        static T* value_of(list_detail::TLinks* links) noexcept {
+            return &static_cast<TNode*>(links)->value;
+        }
+    };
+
+ public:
+    using value_type = T;
+    using iterator = list_detail::TListIterator<TTraits, false>;
+    using const_iterator = list_detail::TListIterator<TTraits, true>;
+    using node_pool = TObjectPool<TNode>;
+
+    static constexpr size_t kDefaultNodesPerSlab = 256;
+
+    static std::shared_ptr<node_pool> make_pool(
+        size_t nodes_per_slab = kDefaultNodesPerSlab) {
+        return std::make_shared<node_pool>(nodes_per_slab);
+    }
+
+    TPoolList() : TPoolList(make_pool()) {}
+
+    // список, выделяющий узлы из общего пула
+    explicit TPoolList(std::shared_ptr<node_pool> pool)
+        : pool_(std::move(pool)), size_(0) {
+        if (pool_ == nullptr) {
+            throw std::invalid_argument("TPoolList: node pool is null");
+        }
+        list_detail::init_empty(&head_);
+    }
+
+    TPoolList(std::initializer_list<T> values) : TPoolList() {
+        for (const T& value : values) {
+            push_back(value);
+        }
+    }
+
+    // копия получает собственный пул
+    TPoolList(const TPoolList& other) : TPoolList() {
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+
+    // перемещённый список остаётся пустым и продолжает пользоваться
+    // тем же пулом
+    TPoolList(TPoolList&& other) noexcept : pool_(other.pool_), size_(0) {
+        list_detail::init_empty(&head_);
+        list_detail::swap_lists(&head_, &other.head_);
+        std::swap(size_, other.size_);
+    }
+
+    TPoolList& operator=(const TPoolList& other) {
+        if (this != &other) {
+            TPoolList copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    TPoolList& operator=(TPoolList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~TPoolList() { clear(); }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    const std::shared_ptr<node_pool>& pool() const noexcept { return pool_; }
+
+    iterator begin() noexcept { return iterator(head_.next); }
+    iterator end() noexcept { return iterator(&head_); }
+    const_iterator begin() const noexcept {
+        return const_iterator(head_.next);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(const_cast<list_detail::TLinks*>(&head_));
+    }
+
+    T& front() {
+        check_not_empty();
+        return *TTraits::value_of(head_.next);
+    }
+    const T& front() const {
+        check_not_empty();
+        return *TTraits::value_of(head_.next);
+    }
+    T& back() {
+        check_not_empty();
+        return *TTraits::value_of(head_.prev);
+    }
+    const T& back() const {
+        check_not_empty();
+        return *TTraits::value_of(head_.prev);
+    }
+
+    void push_front(const T& value) { emplace(begin(), value); }
+    void push_front(T&& value) { emplace(begin(), std::move(value)); }
+    void push_back(const T& value) { emplace(end(), value); }
+    void push_back(T&& value) { emplace(end(), std::move(value)); }
+
+    template <class... Args>
+    T& emplace_front(Args&&... args) {
+        return *emplace(begin(), std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    T& emplace_back(Args&&... args) {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+
+    // создаёт элемент перед position
+    template <class... Args>
+    iterator emplace(const_iterator position, Args&&... args) {
+        TNode* node = pool_->create(std::forward<Args>(args)...);
+        list_detail::link_before(position.links(), node);
+        size_++;
+        return iterator(node);
+    }
+
+    iterator insert(const_iterator position, const T& value) {
+        return emplace(position, value);
+    }
+    iterator insert(const_iterator position, T&& value) {
+        return emplace(position, std::move(value));
+    }
+
+    void pop_front() {
+        check_not_empty();
+        erase(begin());
+    }
+    void pop_back() {
+        check_not_empty();
+        erase(iterator(head_.prev));
+    }
+
+    iterator erase(const_iterator position) noexcept {
+        list_detail::TLinks* links = position.links();
+        list_detail::TLinks* next = links->next;
+        list_detail::unlink(links);
+        pool_->destroy(static_cast<TNode*>(links));
+        size_--;
+        return iterator(next);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        while (first != last) {
+            first = erase(first);
+        }
+        return iterator(last.links());
+    }
+
+    // удаляет элементы, для которых predicate истинен; возвращает их число
+    template <class Predicate>
+    size_t remove_if(Predicate predicate) {
+        size_t removed = 0;
+        for (const_iterator it = begin(); it != end();) {
+            if (predicate(*it)) {
+                it = erase(it);
+                removed++;
+            } else {
+                ++it;
+            }
+        }
+        return removed;
+    }
+
+    void clear() noexcept {
+        list_detail::TLinks* links = head_.next;
+        while (links != &head_) {
+            list_detail::TLinks* next = links->next;
+            pool_->destroy(static_cast<TNode*>(links));
+            links = next;
+        }
+        list_detail::init_empty(&head_);
+        size_ = 0;
+    }
+
+    // переносит все элементы other перед position за O(1)
+    void splice(const_iterator position, TPoolList& other) {
+        check_same_pool(other);
+        if (&other == this || other.empty()) {
+            return;
+        }
+        list_detail::transfer(position.links(), other.head_.next,
+                              &other.head_);
+        size_ += other.size_;
+        other.size_ = 0;
+    }
+
+    // переносит один элемент element из other перед position за O(1)
+    void splice(const_iterator position, TPoolList& other,
+                const_iterator element) {
+        check_same_pool(other);
+        list_detail::TLinks* links = element.links();
+        if (position.links() == links || position.links() == links->next) {
+            return;
+        }
+        list_detail::transfer(position.links(), links, links->next);
+        other.size_--;
+        size_++;
+    }
+
+    // переносит [first, last) из other перед position. Между разными
+    // списками - за O(длины диапазона) из-за пересчёта размеров, внутри
+    // одного списка - за O(1)
+    void splice(const_iterator position, TPoolList& other,
+                const_iterator first, const_iterator last) {
+        check_same_pool(other);
+        if (&other != this) {
+            size_t count = 0;
+            for (const_iterator it = first; it != last; ++it) {
+                count++;
+            }
+            other.size_ -= count;
+            size_ += count;
+        }
+        list_detail::transfer(position.links(), first.links(), last.links());
+    }
+
+    // устойчивая сортировка слиянием: меняются только связи, поэтому
+    // итераторы и ссылки на элементы остаются действительными
+    template <class Less = std::less<T>>
+    void sort(Less less = Less()) {
+        list_detail::sort(&head_, [&less](list_detail::TLinks* a,
+                                          list_detail::TLinks* b) {
+            return less(*TTraits::value_of(a), *TTraits::value_of(b));
+        });
+    }
+
+    // слияние с упорядоченным other из того же пула (other становится
+    // пустым)
+    template <class Less = std::less<T>>
+    void merge(TPoolList& other, Less less = Less()) {
+        check_same_pool(other);
+        if (&other == this) {
+            return;
+        }
+        list_detail::merge(&head_, &other.head_,
+                           [&less](list_detail::TLinks* a,
+                                   list_detail::TLinks* b) {
+            return less(*TTraits::value_of(a), *TTraits::value_of(b));
+        });
+        size_ += other.size_;
+        other.size_ = 0;
+    }
+
+    void reverse() noexcept { list_detail::reverse(&head_); }
+
+    void swap(TPoolList& other) noexcept {
+        pool_.swap(other.pool_);
+        list_detail::swap_lists(&head_, &other.head_);
+        std::swap(size_, other.size_);
+    }
+
+    friend bool operator==(const TPoolList& a, const TPoolList& b) {
+        if (a.size_ != b.size_) {
+            return false;
+        }
+        const_iterator it = b.begin();
+        for (const T& value : a) {
+            if (!(value == *it)) {
+                return false;
+            }
+            ++it;
+        }
+        return true;
+    }
+    friend bool operator!=(const TPoolList& a, const TPoolList& b) {
+        return !(a == b);
+    }
+
+ private:
+    void check_not_empty() const {
+        if (size_ == 0) {
+            throw std::out_of_range("TPoolList: list is empty");
+        }
+    }
+
+    void check_same_pool(const TPoolList& other) const {
+        if (other.pool_ != pool_) {
+            throw std::invalid_argument(
+                "TPoolList: lists use different node pools");
+        }
+    }
+
+    std::shared_ptr<node_pool> pool_;
+    list_detail::TLinks head_;
+    size_t size_;
+};
+
+#endif  // LIB_LIST_POOL_LIST_H_
@@ -0,0 +1,330 @@
+// Copyright 2024 Marina Usova
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+#define MATRIX_X86
+#endif
+
+#ifdef MATRIX_X86
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <new>
+#include "../lib_cpu_features/cpu_features.h"
+#include "../lib_matrix/gemm.h"
+
+#if defined(MATRIX_X86) && (defined(__GNUC__) || defined(__clang__))
+#define TARGET_AVX2_FMA __attribute__((target("avx2,fma")))
+#else
+#define TARGET_AVX2_FMA
+#endif
+
+namespace {
+
+// размеры блоков: плитка микроядра kMr x kNr занимает 12 регистров ymm,
+// упакованная панель a (kMc x kKc) помещается в L2, панель b (kKc x kNc) -
+// в L3; kMc кратно kMr, kNc кратно kNr
+template <class T>
+struct TGemmBlocking;
+
+template <>
+struct TGemmBlocking<float> {
+    static constexpr size_t kMr = 6;
+    static constexpr size_t kNr = 16;
+    static constexpr size_t kMc = 120;
+    static constexpr size_t kKc = 256;
+    static constexpr size_t kNc = 2048;
+};
+
+template <>
+struct TGemmBlocking<double> {
+    static constexpr size_t kMr = 6;
+    static constexpr size_t kNr = 8;
+    static constexpr size_t kMc = 96;
+    static constexpr size_t kKc = 256;
+    static constexpr size_t kNc = 1024;
+};
+
+// выровненный буфер для упакованных панелей
+template <class T>
+class TPackBuffer {
+ public:
+    explicit TPackBuffer(size_t count)
+        : data_(static_cast<T*>(::operator new(
+              count * sizeof(T), std::align_val_t(kMatrixAlignment)))) {}
+    ~TPackBuffer() {
+        ::operator delete(data_, std::align_val_t(kMatrixAlignment));
+    }
+
+    TPackBuffer(const TPackBuffer&) = delete;
+    TPackBuffer& operator=(const TPackBuffer&) = delete;
+
+    T* data() const { return data_; }
+
+ private:
+    T* data_;
+};
+
+// упаковывает блок a (mc x kc) в панели по kMr строк: внутри панели
+// элементы идут столбец за столбцом, недостающие строки заполняются нулями
+template <class T>
+void pack_a(size_t mc, size_t kc, const T* a, size_t lda, T* packed) {
+    const size_t kMr = TGemmBlocking<T>::kMr;
+    for (size_t i = 0; i < mc; i += kMr) {
+        size_t rows = std::min(kMr, mc - i);
+        for (size_t p = 0; p < kc; p++) {
+            for (size_t r = 0; r < rows; r++) {
+                packed[r] = a[(i + r) * lda + p];
+            }
+            for (size_t r = rows; r < kMr; r++) {
+                packed[r] = T(0);
+            }
+            packed += kMr;
+        }
+    }
+}
+
+// упаковывает блок b (kc x nc) в панели по kNr столбцов: внутри панели
+// элементы идут строка за строкой, недостающие столбцы - нули
+template <class T>
+void pack_b(size_t kc, size_t nc, const T* b, size_t ldb, T* packed) {
+    const size_t kNr = TGemmBlocking<T>::kNr;
+    for (size_t j = 0; j < nc; j += kNr) {
+        size_t cols = std::min(kNr, nc - j);
+        for (size_t p = 0; p < kc; p++) {
+            const T* b_row = b + p * ldb + j;
+            for (size_t c = 0; c < cols; c++) {
+                packed[c] = b_row[c];
+            }
+            for (size_t c = cols; c < kNr; c++) {
+                packed[c] = T(0);
+            }
+            packed += kNr;
+        }
+    }
+}
+
+// микроядро: плитка c (kMr x kNr, шаг ldc) += панель a * панель b
+template <class T>
+using MicroKernel = void (*)(size_t kc, const T* a, const T* b,
+                             T* c, size_t ldc);
+
+template <class T>
+void micro_kernel_scalar(size_t kc, const T* a, const T* b,
+                         T* c, size_t ldc) {
+    const size_t kMr = TGemmBlocking<T>::kMr;
+    const size_t kNr = TGemmBlocking<T>::kNr;
+    T acc[kMr][kNr] = {};
+    for (size_t p = 0; p < kc; p++) {
+        for (size_t r = 0; r < kMr; r++) {
+            T a_rp = a[r];
+            for (size_t j = 0; j < kNr; j++) {
+                acc[r][j] += a_rp * b[j];
+            }
+        }
+        a += kMr;
+        b += kNr;
+    }
+    for (size_t r = 0; r < kMr; r++) {
+        for (size_t j = 0; j < kNr; j++) {
+            c[r * ldc + j] += acc[r][j];
+        }
+    }
+}
+
+#ifdef MATRIX_X86
+
+// 6 x 16 float: 12 аккумуляторов ymm, на каждом шаге по k - две загрузки
+// b, шесть broadcast из a и 12 FMA
+TARGET_AVX2_FMA
+void micro_kernel_avx2_float(size_t kc, const float* a, const float* b,
+                             float* c, size_t ldc) {
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+    __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+    for (size_t p = 0; p < kc; p++) {
+        __m256 b0 = _mm256_load_ps(b);
+        __m256 b1 = _mm256_load_ps(b + 8);
+        __m256 ar = _mm256_broadcast_ss(a);
+        c00 = _mm256_fmadd_ps(ar, b0, c00);
+        c01 = _mm256_fmadd_ps(ar, b1, c01);
+        ar = _mm256_broadcast_ss(a + 1);
+        c10 = _mm256_fmadd_ps(ar, b0, c10);
+        c11 = _mm256_fmadd_ps(ar, b1, c11);
+        ar = _mm256_broadcast_ss(a + 2);
+        c20 = _mm256_fmadd_ps(ar, b0, c20);
+        c21 = _mm256_fmadd_ps(ar, b1, c21);
+        ar = _mm256_broadcast_ss(a + 3);
+        c30 = _mm256_fmadd_ps(ar, b0, c30);
+        c31 = _mm256_fmadd_ps(ar, b1, c31);
+        ar = _mm256_broadcast_ss(a + 4);
+        c40 = _mm256_fmadd_ps(ar, b0, c40);
+        c41 = _mm256_fmadd_ps(ar, b1, c41);
+        ar = _mm256_broadcast_ss(a + 5);
+        c50 = _mm256_fmadd_ps(ar, b0, c50);
+        c51 = _mm256_fmadd_ps(ar, b1, c51);
+        a += 6;
+        b += 16;
+    }
+    const __m256 rows[6][2] = { { c00, c01 }, { c10, c11 }, { c20, c21 },
+                                { c30, c31 }, { c40, c41 }, { c50, c51 } };
+    for (size_t r = 0; r < 6; r++) {
+        float* c_row = c + r * ldc;
+        _mm256_storeu_ps(c_row,
+                         _mm256_add_ps(_mm256_loadu_ps(c_row), rows[r][0]));
+        _mm256_storeu_ps(c_row + 8, _mm256_add_ps(_mm256_loadu_ps(c_row + 8),
+                                                  rows[r][1]));
+    }
+}
+
+// 6 x 8 double: та же раскладка регистров, по 4 элемента в ymm
+TARGET_AVX2_FMA
+void micro_kernel_avx2_double(size_t kc, const double* a, const double* b,
+                              double* c, size_t ldc) {
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+    for (size_t p = 0; p < kc; p++) {
+        __m256d b0 = _mm256_load_pd(b);
+        __m256d b1 = _mm256_load_pd(b + 4);
+        __m256d ar = _mm256_broadcast_sd(a);
+        c00 = _mm256_fmadd_pd(ar, b0, c00);
+        c01 = _mm256_fmadd_pd(ar, b1, c01);
+        ar = _mm256_broadcast_sd(a + 1);
+        c10 = _mm256_fmadd_pd(ar, b0, c10);
+        c11 = _mm256_fmadd_pd(ar, b1, c11);
+        ar = _mm256_broadcast_sd(a + 2);
+        c20 = _mm256_fmadd_pd(ar, b0, c20);
+        c21 = _mm256_fmadd_pd(ar, b1, c21);
+        ar = _mm256_broadcast_sd(a + 3);
+        c30 = _mm256_fmadd_pd(ar, b0, c30);
+        c31 = _mm256_fmadd_pd(ar, b1, c31);
+        ar = _mm256_broadcast_sd(a + 4);
+        c40 = _mm256_fmadd_pd(ar, b0, c40);
+        c41 = _mm256_fmadd_pd(ar, b1, c41);
+        ar = _mm256_broadcast_sd(a + 5);
+        c50 = _mm256_fmadd_pd(ar, b0, c50);
+        c51 = _mm256_fmadd_pd(ar, b1, c51);
+        a += 6;
+        b += 8;
+    }
+    const __m256d rows[6][2] = { { c00, c01 }, { c10, c11 }, { c20, c21 },
+                                 { c30, c31 }, { c40, c41 }, { c50, c51 } };
+    for (size_t r = 0; r < 6; r++) {
+        double* c_row = c + r * ldc;
+        _mm256_storeu_pd(c_row,
+                         _mm256_add_pd(_mm256_loadu_pd(c_row), rows[r][0]));
+        _mm256_storeu_pd(c_row + 4, _mm256_add_pd(_mm256_loadu_pd(c_row + 4),
+                                                  rows[r][1]));
+    }
+}
+
+GemmKernel query_gemm_kernel() {
+    return detect_simd_level() == SimdLevel::kAvx2 && detect_fma()
+               ? GemmKernel::kAvx2Fma
+               : GemmKernel::kScalar;
+}
+
+MicroKernel<float> select_kernel(GemmKernel kernel, const float*) {
+    return kernel == GemmKernel::kAvx2Fma ? micro_kernel_avx2_float
+                                          : micro_kernel_scalar<float>;
+}
+
+MicroKernel<double> select_kernel(GemmKernel kernel, const double*) {
+    return kernel == GemmKernel::kAvx2Fma ? micro_kernel_avx2_double
+                                          : micro_kernel_scalar<double>;
+}
+
+#else
+
+GemmKernel query_gemm_kernel() {
+    return GemmKernel::kScalar;
+}
+
+template <class T>
+MicroKernel<T> select_kernel(GemmKernel, const T*) {
+    return micro_kernel_scalar<T>;
+}
+
+#endif  // MATRIX_X86
+
+template <class T>
+void gemm_blocked(size_t m, size_t n, size_t k,
+                  const T* a, size_t lda, const T* b, size_t ldb,
+                  T* c, size_t ldc, GemmKernel kernel) {
+    using B = TGemmBlocking<T>;
+    if (m == 0 || n == 0 || k == 0) {
+        return;
+    }
+    if (kernel == GemmKernel::kAvx2Fma && detect_gemm_kernel() != kernel) {
+        kernel = GemmKernel::kScalar;
+    }
+    MicroKernel<T> micro_kernel = select_kernel(kernel, a);
+
+    size_t kc_max = std::min(B::kKc, k);
+    size_t mc_max = std::min(B::kMc, (m + B::kMr - 1) / B::kMr * B::kMr);
+    size_t nc_max = std::min(B::kNc, (n + B::kNr - 1) / B::kNr * B::kNr);
+    TPackBuffer<T> packed_a(mc_max * kc_max);
+    TPackBuffer<T> packed_b(kc_max * nc_max);
+    // крайние плитки, не занимающие kMr x kNr целиком, считаются во
+    // временный буфер и затем прибавляются к c
+    T edge[B::kMr * B::kNr];
+
+    for (size_t jc = 0; jc < n; jc += B::kNc) {
+        size_t nc = std::min(B::kNc, n - jc);
+        for (size_t pc = 0; pc < k; pc += B::kKc) {
+            size_t kc = std::min(B::kKc, k - pc);
+            pack_b(kc, nc, b + pc * ldb + jc, ldb, packed_b.data());
+            for (size_t ic = 0; ic < m; ic += B::kMc) {
+                size_t mc = std::min(B::kMc, m - ic);
+                pack_a(mc, kc, a + ic * lda + pc, lda, packed_a.data());
+                for (size_t jr = 0; jr < nc; jr += B::kNr) {
+                    size_t cols = std::min(B::kNr, nc - jr);
+                    const T* b_panel = packed_b.data() + jr * kc;
+                    for (size_t ir = 0; ir < mc; ir += B::kMr) {
+                        size_t rows = std::min(B::kMr, mc - ir);
+                        const T* a_panel = packed_a.data() + ir * kc;
+                        T* c_tile = c + (ic + ir) * ldc + jc + jr;
+                        if (rows == B::kMr && cols == B::kNr) {
+                            micro_kernel(kc, a_panel, b_panel, c_tile, ldc);
+                            continue;
+                        }
+                        std::fill(edge, edge + B::kMr * B::kNr, T(0));
+                        micro_kernel(kc, a_panel, b_panel, edge, B::kNr);
+                        for (size_t r = 0; r < rows; r++) {
+                            for (size_t j = 0; j < cols; j++) {
+                                c_tile[r * ldc + j] += edge[r * B::kNr + j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+GemmKernel detect_gemm_kernel() {
+    static const GemmKernel kernel = query_gemm_kernel();
+    return kernel;
+}
+
+void gemm(size_t m, size_t n, size_t k,
+          const float* a, size_t lda, const float* b, size_t ldb,
+          float* c, size_t ldc, GemmKernel kernel) {
+    gemm_blocked(m, n, k, a, lda, b, ldb, c, ldc, kernel);
+}
+
+void gemm(size_t m, size_t n, size_t k,
+          const double* a, size_t lda, const double* b, size_t ldb,
+          double* c, size_t ldc, GemmKernel kernel) {
+    gemm_blocked(m, n, k, a, lda, b, ldb, c, ldc, kernel);
+}
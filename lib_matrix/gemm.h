@@ -0,0 +1,32 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_MATRIX_GEMM_H_
+#define LIB_MATRIX_GEMM_H_
+
+#include <cstddef>
+
+// выравнивание хранилища матриц и буферов упаковки (строка кэша)
+const size_t kMatrixAlignment = 64;
+
+// микроядро, которым выполняется умножение
+enum class GemmKernel { kScalar, kAvx2Fma };
+
+// лучшее микроядро для текущего процессора (AVX2 и FMA одновременно);
+// определяется один раз при первом вызове
+GemmKernel detect_gemm_kernel();
+
+// c += a * b для матриц, хранящихся по строкам:
+// a - m x k с шагом строки lda, b - k x n с шагом ldb, c - m x n с шагом ldc.
+// Умножение разбито на блоки по кэшам (схема GotoBLAS/BLIS): панель b
+// размером kc x nc упаковывается для L3/L2, блок a размером mc x kc - для
+// L2, а микроядро считает плитку mr x nr в регистрах, читая упакованные
+// данные подряд. Если kernel не поддерживается процессором, используется
+// скалярное ядро.
+void gemm(size_t m, size_t n, size_t k,
+          const float* a, size_t lda, const float* b, size_t ldb,
+          float* c, size_t ldc, GemmKernel kernel = detect_gemm_kernel());
+void gemm(size_t m, size_t n, size_t k,
+          const double* a, size_t lda, const double* b, size_t ldb,
+          double* c, size_t ldc, GemmKernel kernel = detect_gemm_kernel());
+
+#endif  // LIB_MATRIX_GEMM_H_
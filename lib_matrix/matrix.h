@@ -0,0 +1,244 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_MATRIX_MATRIX_H_
+#define LIB_MATRIX_MATRIX_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "../lib_matrix/gemm.h"
+
+// Плотная матрица, элементы хранятся по строкам в одном непрерывном блоке,
+// выровненном на kMatrixAlignment байт (удобно для векторных загрузок).
+// Матрица владеет памятью; копирование глубокое, перемещение - O(1).
+template <class T>
+class TMatrix {
+    static_assert(std::is_arithmetic<T>::value,
+                  "TMatrix supports arithmetic types only");
+
+ public:
+    using value_type = T;
+
+    TMatrix() noexcept : data_(nullptr), rows_(0), cols_(0) {}
+
+    // матрица rows x cols, заполненная value
+    TMatrix(size_t rows, size_t cols, T value = T())
+        : data_(allocate(rows * cols)), rows_(rows), cols_(cols) {
+        std::fill(data_, data_ + size(), value);
+    }
+
+    TMatrix(std::initializer_list<std::initializer_list<T>> rows)
+        : TMatrix(rows.size(), rows.size() == 0 ? 0 : rows.begin()->size()) {
+        size_t i = 0;
+        for (const auto& row : rows) {
+            if (row.size() != cols_) {
+                release();
+                throw std::invalid_argument("TMatrix: rows differ in size");
+            }
+            std::copy(row.begin(), row.end(), data_ + i * cols_);
+            i++;
+        }
+    }
+
+    TMatrix(const TMatrix& other)
+        : data_(allocate(other.size())), rows_(other.rows_),
+          cols_(other.cols_) {
+        std::copy(other.data_, other.data_ + size(), data_);
+    }
+
+    TMatrix(TMatrix&& other) noexcept
+        : data_(other.data_), rows_(other.rows_), cols_(other.cols_) {
+        other.data_ = nullptr;
+        other.rows_ = 0;
+        other.cols_ = 0;
+    }
+
+    ~TMatrix() { release(); }
+
+    TMatrix& operator=(const TMatrix& other) {
+        if (this != &other) {
+            TMatrix copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    TMatrix& operator=(TMatrix&& other) noexcept {
+        if (this != &other) {
+            release();
+            data_ = other.data_;
+            rows_ = other.rows_;
+            cols_ = other.cols_;
+            other.data_ = nullptr;
+            other.rows_ = 0;
+            other.cols_ = 0;
+        }
+        return *this;
+    }
+
+    static TMatrix identity(size_t n) {
+        TMatrix result(n, n);
+        for (size_t i = 0; i < n; i++) {
+            result(i, i) = T(1);
+        }
+        return result;
+    }
+
+    size_t rows() const noexcept { return rows_; }
+    size_t cols() const noexcept { return cols_; }
+    size_t size() const noexcept { return rows_ * cols_; }
+    bool empty() const noexcept { return size() == 0; }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+    T* row(size_t i) noexcept { return data_ + i * cols_; }
+    const T* row(size_t i) const noexcept { return data_ + i * cols_; }
+
+    T& operator()(size_t i, size_t j) noexcept {
+        return data_[i * cols_ + j];
+    }
+    const T& operator()(size_t i, size_t j) const noexcept {
+        return data_[i * cols_ + j];
+    }
+
+    T& at(size_t i, size_t j) {
+        check_index(i, j);
+        return data_[i * cols_ + j];
+    }
+    const T& at(size_t i, size_t j) const {
+        check_index(i, j);
+        return data_[i * cols_ + j];
+    }
+
+    void fill(T value) { std::fill(data_, data_ + size(), value); }
+
+    TMatrix transposed() const {
+        TMatrix result(cols_, rows_);
+        for (size_t i = 0; i < rows_; i++) {
+            for (size_t j = 0; j < cols_; j++) {
+                result(j, i) = (*this)(i, j);
+            }
+        }
+        return result;
+    }
+
+    TMatrix& operator+=(const TMatrix& other) {
+        check_same_shape(other);
+        for (size_t i = 0; i < size(); i++) {
+            data_[i] += other.data_[i];
+        }
+        return *this;
+    }
+
+    TMatrix& operator-=(const TMatrix& other) {
+        check_same_shape(other);
+        for (size_t i = 0; i < size(); i++) {
+            data_[i] -= other.data_[i];
+        }
+        return *this;
+    }
+
+    friend TMatrix operator+(TMatrix left, const TMatrix& right) {
+        return left += right;
+    }
+    friend TMatrix operator-(TMatrix left, const TMatrix& right) {
+        return left -= right;
+    }
+
+    friend bool operator==(const TMatrix& left, const TMatrix& right) {
+        return left.rows_ == right.rows_ && left.cols_ == right.cols_ &&
+               std::equal(left.data_, left.data_ + left.size(), right.data_);
+    }
+    friend bool operator!=(const TMatrix& left, const TMatrix& right) {
+        return !(left == right);
+    }
+
+    void swap(TMatrix& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(rows_, other.rows_);
+        std::swap(cols_, other.cols_);
+    }
+
+ private:
+    static T* allocate(size_t count) {
+        if (count == 0) {
+            return nullptr;
+        }
+        return static_cast<T*>(::operator new(
+            count * sizeof(T), std::align_val_t(kMatrixAlignment)));
+    }
+
+    void release() noexcept {
+        if (data_ != nullptr) {
+            ::operator delete(data_, std::align_val_t(kMatrixAlignment));
+            data_ = nullptr;
+        }
+    }
+
+    void check_index(size_t i, size_t j) const {
+        if (i >= rows_ || j >= cols_) {
+            throw std::out_of_range("TMatrix: index is out of range");
+        }
+    }
+
+    void check_same_shape(const TMatrix& other) const {
+        if (rows_ != other.rows_ || cols_ != other.cols_) {
+            throw std::invalid_argument("TMatrix: shapes do not match");
+        }
+    }
+
+    T* data_;
+    size_t rows_;
+    size_t cols_;
+};
+
+// эталонное умножение тройным циклом (порядок i-k-j), для проверки
+// и для типов, у которых нет оптимизированного ядра
+template <class T>
+TMatrix<T> multiply_naive(const TMatrix<T>& a, const TMatrix<T>& b) {
+    if (a.cols() != b.rows()) {
+        throw std::invalid_argument("multiply: inner dimensions differ");
+    }
+    TMatrix<T> c(a.rows(), b.cols());
+    for (size_t i = 0; i < a.rows(); i++) {
+        T* c_row = c.row(i);
+        for (size_t p = 0; p < a.cols(); p++) {
+            T a_ip = a(i, p);
+            const T* b_row = b.row(p);
+            for (size_t j = 0; j < b.cols(); j++) {
+                c_row[j] += a_ip * b_row[j];
+            }
+        }
+    }
+    return c;
+}
+
+// c = a * b; для float и double - блочное умножение gemm() с векторным
+// микроядром, для остальных типов - multiply_naive()
+template <class T>
+TMatrix<T> multiply(const TMatrix<T>& a, const TMatrix<T>& b,
+                    GemmKernel kernel = detect_gemm_kernel()) {
+    if (a.cols() != b.rows()) {
+        throw std::invalid_argument("multiply: inner dimensions differ");
+    }
+    if constexpr (std::is_same<T, float>::value ||
+                  std::is_same<T, double>::value) {
+        TMatrix<T> c(a.rows(), b.cols());
+        gemm(a.rows(), b.cols(), a.cols(), a.data(), a.cols(),
+             b.data(), b.cols(), c.data(), c.cols(), kernel);
+        return c;
+    } else {
+        return multiply_naive(a, b);
+    }
+}
+
+template <class T>
+TMatrix<T> operator*(const TMatrix<T>& a, const TMatrix<T>& b) {
+    return multiply(a, b);
+}
+
+#endif  // LIB_MATRIX_MATRIX_H_
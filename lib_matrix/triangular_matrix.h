@@ -0,0 +1,149 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_MATRIX_TRIANGULAR_MATRIX_H_
+#define LIB_MATRIX_TRIANGULAR_MATRIX_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "../lib_matrix/matrix.h"
+
+// Верхнетреугольная матрица n x n: хранятся только элементы с j >= i,
+// всего n(n+1)/2 штук, подряд по строкам (строка i занимает n - i
+// элементов). Элементы под диагональю всегда равны нулю и не изменяются.
+template <class T>
+class TUpperTriangularMatrix {
+ public:
+    using value_type = T;
+
+    TUpperTriangularMatrix() noexcept : n_(0) {}
+
+    explicit TUpperTriangularMatrix(size_t n, T value = T())
+        : n_(n), data_(n * (n + 1) / 2, value) {}
+
+    // берёт верхний треугольник квадратной матрицы
+    explicit TUpperTriangularMatrix(const TMatrix<T>& matrix)
+        : TUpperTriangularMatrix(matrix.rows()) {
+        if (matrix.rows() != matrix.cols()) {
+            throw std::invalid_argument(
+                "TUpperTriangularMatrix: matrix is not square");
+        }
+        for (size_t i = 0; i < n_; i++) {
+            std::copy(matrix.row(i) + i, matrix.row(i) + n_, row(i));
+        }
+    }
+
+    size_t size() const noexcept { return n_; }
+    // число хранимых элементов
+    size_t stored_elements() const noexcept { return data_.size(); }
+
+    // начало строки i: элемент (i, i); в строке n - i элементов
+    T* row(size_t i) noexcept { return data_.data() + offset(i); }
+    const T* row(size_t i) const noexcept {
+        return data_.data() + offset(i);
+    }
+
+    // доступ к хранимому элементу, требуется j >= i
+    T& operator()(size_t i, size_t j) noexcept { return row(i)[j - i]; }
+    const T& operator()(size_t i, size_t j) const noexcept {
+        return row(i)[j - i];
+    }
+
+    // значение любого элемента, под диагональю - ноль
+    T get(size_t i, size_t j) const {
+        check_index(i, j);
+        return j < i ? T(0) : (*this)(i, j);
+    }
+
+    // изменяемый элемент; под диагональю бросает std::out_of_range
+    T& at(size_t i, size_t j) {
+        check_index(i, j);
+        if (j < i) {
+            throw std::out_of_range(
+                "TUpperTriangularMatrix: element below the diagonal");
+        }
+        return (*this)(i, j);
+    }
+
+    TMatrix<T> to_dense() const {
+        TMatrix<T> result(n_, n_);
+        for (size_t i = 0; i < n_; i++) {
+            std::copy(row(i), row(i) + (n_ - i), result.row(i) + i);
+        }
+        return result;
+    }
+
+    friend bool operator==(const TUpperTriangularMatrix& left,
+                           const TUpperTriangularMatrix& right) {
+        return left.n_ == right.n_ && left.data_ == right.data_;
+    }
+    friend bool operator!=(const TUpperTriangularMatrix& left,
+                           const TUpperTriangularMatrix& right) {
+        return !(left == right);
+    }
+
+ private:
+    // до строки i лежат строки длиной n, n - 1, ..., n - i + 1
+    size_t offset(size_t i) const noexcept {
+        return i * n_ - i * (i - 1) / 2;
+    }
+
+    void check_index(size_t i, size_t j) const {
+        if (i >= n_ || j >= n_) {
+            throw std::out_of_range(
+                "TUpperTriangularMatrix: index is out of range");
+        }
+    }
+
+    size_t n_;
+    std::vector<T> data_;
+};
+
+// произведение верхнетреугольных матриц тоже верхнетреугольное:
+// c(i, j) = сумма a(i, p) * b(p, j) по p из [i, j]
+template <class T>
+TUpperTriangularMatrix<T> multiply(const TUpperTriangularMatrix<T>& a,
+                                   const TUpperTriangularMatrix<T>& b) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("multiply: sizes differ");
+    }
+    size_t n = a.size();
+    TUpperTriangularMatrix<T> c(n);
+    for (size_t i = 0; i < n; i++) {
+        T* c_row = c.row(i);
+        for (size_t p = i; p < n; p++) {
+            T a_ip = a(i, p);
+            const T* b_row = b.row(p);
+            // b(p, j) для j >= p лежат подряд начиная с b.row(p)
+            for (size_t j = p; j < n; j++) {
+                c_row[j - i] += a_ip * b_row[j - p];
+            }
+        }
+    }
+    return c;
+}
+
+// произведение верхнетреугольной матрицы на плотную: нули под диагональю
+// не читаются и не умножаются
+template <class T>
+TMatrix<T> multiply(const TUpperTriangularMatrix<T>& a, const TMatrix<T>& b) {
+    if (a.size() != b.rows()) {
+        throw std::invalid_argument("multiply: inner dimensions differ");
+    }
+    size_t n = a.size();
+    TMatrix<T> c(n, b.cols());
+    for (size_t i = 0; i < n; i++) {
+        T* c_row = c.row(i);
+        for (size_t p = i; p < n; p++) {
+            T a_ip = a(i, p);
+            const T* b_row = b.row(p);
+            for (size_t j = 0; j < b.cols(); j++) {
+                c_row[j] += a_ip * b_row[j];
+            }
+        }
+    }
+    return c;
+}
+
+#endif  // LIB_MATRIX_TRIANGULAR_MATRIX_H_
@@ -0,0 +1,96 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include "../lib_memory/arena.h"
+
+namespace {
+
+char* allocate_block(size_t size) {
+    return static_cast<char*>(::operator new(size));
+}
+
+void free_block(char* data) noexcept {
+    ::operator delete(data);
+}
+
+}  // namespace
+
+TArena::TArena(size_t block_size)
+    : block_size_(block_size), current_(0), pointer_(nullptr),
+      end_(nullptr), allocated_(0), reserved_(0) {
+    if (block_size == 0) {
+        throw std::invalid_argument("TArena: block size must be positive");
+    }
+}
+
+TArena::~TArena() {
+    release();
+}
+
+void TArena::throw_bad_alignment() {
+    throw std::invalid_argument("TArena: alignment must be power of 2");
+}
+
+void TArena::push_block(std::vector<TBlock>* blocks, TBlock block) {
+    // если список не смог вырасти, блок ещё ничей и освобождается здесь
+    try {
+        blocks->push_back(block);
+    } catch (...) {
+        free_block(block.data);
+        throw;
+    }
+}
+
+void* TArena::allocate_slow(size_t size, size_t alignment) {
+    if (size > SIZE_MAX - alignment) {
+        throw std::bad_alloc();
+    }
+    // крупный запрос не должен тратить впустую обычный блок
+    if (size + alignment > block_size_ / 2) {
+        TBlock block = { allocate_block(size + alignment),
+                         size + alignment };
+        push_block(&large_blocks_, block);
+        reserved_ += block.size;
+        size_t address = reinterpret_cast<size_t>(block.data);
+        size_t padding = (0 - address) & (alignment - 1);
+        allocated_ += size + padding;
+        return block.data + padding;
+    }
+
+    // переходим к следующему сохранённому блоку или заводим новый
+    size_t next = (pointer_ == nullptr) ? 0 : current_ + 1;
+    if (next == blocks_.size()) {
+        TBlock block = { allocate_block(block_size_), block_size_ };
+        push_block(&blocks_, block);
+        reserved_ += block.size;
+    }
+    current_ = next;
+    pointer_ = blocks_[current_].data;
+    end_ = pointer_ + blocks_[current_].size;
+    return allocate(size, alignment);
+}
+
+void TArena::reset() noexcept {
+    for (const TBlock& block : large_blocks_) {
+        free_block(block.data);
+        reserved_ -= block.size;
+    }
+    large_blocks_.clear();
+    current_ = 0;
+    pointer_ = blocks_.empty() ? nullptr : blocks_[0].data;
+    end_ = blocks_.empty() ? nullptr : blocks_[0].data + blocks_[0].size;
+    allocated_ = 0;
+}
+
+void TArena::release() noexcept {
+    reset();
+    for (const TBlock& block : blocks_) {
+        free_block(block.data);
+    }
+    blocks_.clear();
+    pointer_ = nullptr;
+    end_ = nullptr;
+    reserved_ = 0;
+}
@@ -0,0 +1,123 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_MEMORY_ARENA_H_
+#define LIB_MEMORY_ARENA_H_
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Арена (монотонный аллокатор): память выдаётся сдвигом указателя внутри
+// крупных блоков, отдельные объекты не освобождаются. reset() разом
+// «освобождает» всё выданное, сохраняя блоки для повторного использования,
+// поэтому цикл «много выделений - сброс» не обращается к malloc.
+// Деструкторы объектов, созданных через create(), не вызываются.
+class TArena {
+ public:
+    static const size_t kDefaultBlockSize = 64 * 1024;
+
+    explicit TArena(size_t block_size = kDefaultBlockSize);
+    ~TArena();
+
+    TArena(const TArena&) = delete;
+    TArena& operator=(const TArena&) = delete;
+
+    // выделяет size байт, выровненных на alignment (степень двойки)
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template <class T, class... Args>
+    T* create(Args&&... args) {
+        void* memory = allocate(sizeof(T), alignof(T));
+        return new (memory) T(std::forward<Args>(args)...);
+    }
+
+    // делает всю выданную память снова свободной;
+    // блоки обычного размера остаются за ареной
+    void reset() noexcept;
+    // возвращает все блоки системе
+    void release() noexcept;
+
+    // сколько байт выдано с последнего reset()
+    size_t bytes_allocated() const noexcept { return allocated_; }
+    // сколько байт арена держит в блоках
+    size_t bytes_reserved() const noexcept { return reserved_; }
+    size_t block_size() const noexcept { return block_size_; }
+
+ private:
+    struct TBlock {
+        char* data;
+        size_t size;
+    };
+
+    void* allocate_slow(size_t size, size_t alignment);
+    static void push_block(std::vector<TBlock>* blocks, TBlock block);
+    [[noreturn]] static void throw_bad_alignment();
+
+    size_t block_size_;
+    std::vector<TBlock> blocks_;        // блоки обычного размера
+    std::vector<TBlock> large_blocks_;  // отдельные блоки под крупные запросы
+    size_t current_;                    // индекс текущего блока в blocks_
+    char* pointer_;
+    char* end_;
+    size_t allocated_;
+    size_t reserved_;
+};
+
+inline void* TArena::allocate(size_t size, size_t alignment) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        throw_bad_alignment();
+    }
+    size_t address = reinterpret_cast<size_t>(pointer_);
+    size_t padding = (0 - address) & (alignment - 1);
+    size_t available = static_cast<size_t>(end_ - pointer_);
+    // size + padding не вычисляется: при size около SIZE_MAX сумма
+    // переполнилась бы
+    if (pointer_ != nullptr && padding <= available &&
+        size <= available - padding) {
+        char* result = pointer_ + padding;
+        pointer_ = result + size;
+        allocated_ += size + padding;
+        return result;
+    }
+    return allocate_slow(size, alignment);
+}
+
+// Адаптер арены к интерфейсу аллокаторов стандартной библиотеки:
+// позволяет хранить в арене элементы контейнеров (std::vector, std::list,
+// контейнеров этого проекта). deallocate ничего не делает - память
+// возвращается при reset() арены. Арена должна пережить контейнер.
+template <class T>
+class TArenaAllocator {
+ public:
+    using value_type = T;
+
+    explicit TArenaAllocator(TArena* arena) noexcept : arena_(arena) {}
+
+    template <class U>
+    TArenaAllocator(const TArenaAllocator<U>& other) noexcept  // NOLINT
+        : arena_(other.arena()) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(arena_->allocate(count * sizeof(T),
+                                                alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    TArena* arena() const noexcept { return arena_; }
+
+    template <class U>
+    bool operator==(const TArenaAllocator<U>& other) const noexcept {
+        return arena_ == other.arena();
+    }
+    template <class U>
+    bool operator!=(const TArenaAllocator<U>& other) const noexcept {
+        return arena_ != other.arena();
+    }
+
+ private:
+    TArena* arena_;
+};
+
+#endif  // LIB_MEMORY_ARENA_H_
@@ -0,0 +1,67 @@
+// Copyright 2024 Marina Usova
+
+#include <stdexcept>
+#include "../lib_memory/pool.h"
+
+TFixedPool::TFixedPool(size_t object_size, size_t alignment,
+                       size_t objects_per_slab)
+    : object_size_(object_size), alignment_(alignment),
+      objects_per_slab_(objects_per_slab), free_list_(nullptr),
+      current_slab_(0), pointer_(nullptr), end_(nullptr), in_use_(0) {
+    if ((alignment & (alignment - 1)) != 0 || alignment == 0) {
+        throw std::invalid_argument(
+            "TFixedPool: alignment must be power of 2");
+    }
+    if (objects_per_slab == 0) {
+        throw std::invalid_argument(
+            "TFixedPool: slab must hold at least one object");
+    }
+    // в свободном блоке хранится указатель на следующий
+    if (object_size_ < sizeof(TFreeNode)) {
+        object_size_ = sizeof(TFreeNode);
+    }
+    if (alignment_ < alignof(TFreeNode)) {
+        alignment_ = alignof(TFreeNode);
+    }
+    object_size_ = (object_size_ + alignment_ - 1) & ~(alignment_ - 1);
+}
+
+TFixedPool::~TFixedPool() {
+    release();
+}
+
+void* TFixedPool::allocate_slow() {
+    // состояние пула меняется только после успешного выделения
+    size_t next = (pointer_ == nullptr) ? current_slab_ : current_slab_ + 1;
+    if (next == slabs_.size()) {
+        void* slab = ::operator new(object_size_ * objects_per_slab_,
+                                    std::align_val_t(alignment_));
+        try {
+            slabs_.push_back(static_cast<char*>(slab));
+        } catch (...) {
+            ::operator delete(slab, std::align_val_t(alignment_));
+            throw;
+        }
+    }
+    current_slab_ = next;
+    pointer_ = slabs_[current_slab_];
+    end_ = pointer_ + object_size_ * objects_per_slab_;
+    return allocate();
+}
+
+void TFixedPool::reset() noexcept {
+    free_list_ = nullptr;
+    current_slab_ = 0;
+    pointer_ = slabs_.empty() ? nullptr : slabs_[0];
+    end_ = slabs_.empty() ? nullptr
+                          : slabs_[0] + object_size_ * objects_per_slab_;
+    in_use_ = 0;
+}
+
+void TFixedPool::release() noexcept {
+    for (char* slab : slabs_) {
+        ::operator delete(slab, std::align_val_t(alignment_));
+    }
+    slabs_.clear();
+    reset();
+}
@@ -0,0 +1,109 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_MEMORY_POOL_H_
+#define LIB_MEMORY_POOL_H_
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Пул блоков фиксированного размера: память нарезается из крупных
+// «слябов», освобождённые блоки попадают в односвязный список свободных
+// (указатель на следующий хранится прямо в свободном блоке), поэтому
+// allocate и deallocate выполняются за O(1) без обращения к malloc.
+class TFixedPool {
+ public:
+    TFixedPool(size_t object_size, size_t alignment,
+               size_t objects_per_slab = 256);
+    ~TFixedPool();
+
+    TFixedPool(const TFixedPool&) = delete;
+    TFixedPool& operator=(const TFixedPool&) = delete;
+
+    void* allocate();
+    // pointer должен быть получен из этого же пула
+    void deallocate(void* pointer) noexcept;
+
+    // делает все блоки свободными, слябы остаются за пулом
+    void reset() noexcept;
+    // возвращает все слябы системе
+    void release() noexcept;
+
+    size_t object_size() const noexcept { return object_size_; }
+    size_t objects_in_use() const noexcept { return in_use_; }
+    size_t capacity() const noexcept {
+        return slabs_.size() * objects_per_slab_;
+    }
+
+ private:
+    struct TFreeNode {
+        TFreeNode* next;
+    };
+
+    void* allocate_slow();
+
+    size_t object_size_;
+    size_t alignment_;
+    size_t objects_per_slab_;
+    std::vector<char*> slabs_;
+    TFreeNode* free_list_;
+    size_t current_slab_;   // сляб, из которого ещё не выдавались блоки
+    char* pointer_;         // следующий ни разу не выданный блок
+    char* end_;
+    size_t in_use_;
+};
+
+inline void* TFixedPool::allocate() {
+    if (free_list_ != nullptr) {
+        TFreeNode* node = free_list_;
+        free_list_ = node->next;
+        in_use_++;
+        return node;
+    }
+    if (pointer_ != end_) {
+        void* result = pointer_;
+        pointer_ += object_size_;
+        in_use_++;
+        return result;
+    }
+    return allocate_slow();
+}
+
+inline void TFixedPool::deallocate(void* pointer) noexcept {
+    TFreeNode* node = static_cast<TFreeNode*>(pointer);
+    node->next = free_list_;
+    free_list_ = node;
+    in_use_--;
+}
+
+// Типизированный пул объектов T поверх TFixedPool
+template <class T>
+class TObjectPool {
+ public:
+    explicit TObjectPool(size_t objects_per_slab = 256)
+        : pool_(sizeof(T), alignof(T), objects_per_slab) {}
+
+    template <class... Args>
+    T* create(Args&&... args) {
+        void* memory = pool_.allocate();
+        try {
+            return new (memory) T(std::forward<Args>(args)...);
+        } catch (...) {
+            pool_.deallocate(memory);
+            throw;
+        }
+    }
+
+    void destroy(T* object) noexcept {
+        object->~T();
+        pool_.deallocate(object);
+    }
+
+    size_t objects_in_use() const noexcept { return pool_.objects_in_use(); }
+
+ private:
+    TFixedPool pool_;
+};
+
+#endif  // LIB_MEMORY_POOL_H_
@@ -0,0 +1,17 @@
+// Copyright 2024 Marina Usova
+
+#include "../lib_easy_example/easy_example.h"
+#include "../lib_parallel/parallel_division.h"
+
+size_t parallel_division(TThreadPool* pool, const int* a, const int* b,
+                         float* result, size_t count, uint8_t* zero_mask,
+                         size_t grain) {
+    return pool->parallel_reduce(
+        0, count, grain, static_cast<size_t>(0),
+        [=](size_t lo, size_t hi) {
+            return division_batch(a + lo, b + lo, result + lo, hi - lo,
+                                  zero_mask != nullptr ? zero_mask + lo
+                                                       : nullptr);
+        },
+        [](size_t left, size_t right) { return left + right; });
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_PARALLEL_PARALLEL_DIVISION_H_
+#define LIB_PARALLEL_PARALLEL_DIVISION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "../lib_parallel/thread_pool.h"
+
+// многопоточный вариант division_batch(): массив делится на куски по
+// grain элементов, каждый кусок обрабатывается векторным ядром.
+// Семантика результата, zero_mask и возвращаемого значения та же.
+size_t parallel_division(TThreadPool* pool, const int* a, const int* b,
+                         float* result, size_t count,
+                         uint8_t* zero_mask = nullptr,
+                         size_t grain = 16 * 1024);
+
+#endif  // LIB_PARALLEL_PARALLEL_DIVISION_H_
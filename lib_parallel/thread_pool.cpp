@@ -0,0 +1,190 @@
+// Copyright 2024 Marina Usova
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define PARALLEL_CPU_RELAX() _mm_pause()
+#else
+#define PARALLEL_CPU_RELAX()
+#endif
+
+#include <chrono>  // NOLINT [build/c++11]
+#include <exception>
+#include "../lib_parallel/thread_pool.h"
+
+struct TThreadPool::TTaskGroup {
+    std::atomic<size_t> pending{ 0 };
+    std::mutex error_mutex;
+    std::exception_ptr error;
+};
+
+struct TThreadPool::TTask {
+    size_t begin;
+    size_t end;
+    size_t grain;
+    const std::function<void(size_t, size_t)>* body;
+    TTaskGroup* group;
+};
+
+namespace {
+
+// пул и номер участника, которыми сейчас занят текущий поток
+thread_local const TThreadPool* tls_pool = nullptr;
+thread_local size_t tls_index = 0;
+
+const int kSpinRounds = 64;
+const int kYieldRounds = 64;
+
+}  // namespace
+
+size_t TThreadPool::default_thread_count() {
+    size_t threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : threads;
+}
+
+TThreadPool::TThreadPool(size_t threads) : stop_(false), sleeping_(0) {
+    threads = std::max<size_t>(threads, 1);
+    for (size_t i = 0; i < threads; i++) {
+        deques_.emplace_back(new TWorkStealingDeque<TTask*>());
+    }
+    for (size_t i = 1; i < threads; i++) {
+        workers_.emplace_back(&TThreadPool::worker_loop, this, i);
+    }
+}
+
+TThreadPool::~TThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stop_.store(true);
+    }
+    wake_up_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+void TThreadPool::worker_loop(size_t index) {
+    tls_pool = this;
+    tls_index = index;
+    int idle = 0;
+    while (!stop_.load(std::memory_order_acquire)) {
+        TTask* task = find_task(index);
+        if (task != nullptr) {
+            run_task(task, index);
+            idle = 0;
+        } else if (idle < kSpinRounds) {
+            PARALLEL_CPU_RELAX();
+            idle++;
+        } else if (idle < kSpinRounds + kYieldRounds) {
+            std::this_thread::yield();
+            idle++;
+        } else {
+            wait_for_work();
+            idle = 0;
+        }
+    }
+}
+
+void TThreadPool::wait_for_work() {
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleeping_.fetch_add(1);
+    // таймаут страхует от пропущенного пробуждения между проверкой
+    // sleeping_ в push и засыпанием здесь
+    wake_up_.wait_for(lock, std::chrono::milliseconds(1));
+    sleeping_.fetch_sub(1);
+}
+
+void TThreadPool::push(size_t index, TTask* task) {
+    deques_[index]->push(task);
+    if (sleeping_.load(std::memory_order_relaxed) != 0) {
+        wake_up_.notify_one();
+    }
+}
+
+TThreadPool::TTask* TThreadPool::find_task(size_t index) {
+    TTask* task = nullptr;
+    if (deques_[index]->take(&task)) {
+        return task;
+    }
+    // обходим чужие деки, начиная с псевдослучайной жертвы
+    thread_local uint32_t seed = static_cast<uint32_t>(index) * 2654435761u;
+    seed = seed * 1664525u + 1013904223u;
+    size_t count = deques_.size();
+    size_t start = (seed >> 8) % count;
+    for (size_t i = 0; i < count; i++) {
+        size_t victim = (start + i) % count;
+        if (victim != index && deques_[victim]->steal(&task)) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void TThreadPool::run_task(TTask* task, size_t index) {
+    while (task->end - task->begin > task->grain) {
+        size_t middle = task->begin + (task->end - task->begin) / 2;
+        TTask* right = new TTask{ middle, task->end, task->grain, task->body,
+                                  task->group };
+        task->group->pending.fetch_add(1, std::memory_order_relaxed);
+        push(index, right);
+        task->end = middle;
+    }
+    try {
+        (*task->body)(task->begin, task->end);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(task->group->error_mutex);
+        if (!task->group->error) {
+            task->group->error = std::current_exception();
+        }
+    }
+    task->group->pending.fetch_sub(1, std::memory_order_acq_rel);
+    delete task;
+}
+
+void TThreadPool::parallel_for(
+    size_t begin, size_t end, size_t grain,
+    const std::function<void(size_t, size_t)>& body) {
+    if (begin >= end) {
+        return;
+    }
+    grain = std::max<size_t>(grain, 1);
+
+    // поток вне пула становится участником 0 на время вызова
+    bool external = (tls_pool != this);
+    std::unique_lock<std::mutex> lock(external_mutex_, std::defer_lock);
+    const TThreadPool* saved_pool = tls_pool;
+    size_t saved_index = tls_index;
+    if (external) {
+        lock.lock();
+        tls_pool = this;
+        tls_index = 0;
+    }
+    size_t index = tls_index;
+
+    TTaskGroup group;
+    group.pending.store(1, std::memory_order_relaxed);
+    run_task(new TTask{ begin, end, grain, &body, &group }, index);
+
+    // пока ждём свои куски, выполняем любую доступную работу
+    int idle = 0;
+    while (group.pending.load(std::memory_order_acquire) != 0) {
+        TTask* task = find_task(index);
+        if (task != nullptr) {
+            run_task(task, index);
+            idle = 0;
+        } else if (idle < kSpinRounds) {
+            PARALLEL_CPU_RELAX();
+            idle++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    if (external) {
+        tls_pool = saved_pool;
+        tls_index = saved_index;
+    }
+    if (group.error) {
+        std::rethrow_exception(group.error);
+    }
+}
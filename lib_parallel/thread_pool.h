@@ -0,0 +1,95 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_PARALLEL_THREAD_POOL_H_
+#define LIB_PARALLEL_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>  // NOLINT [build/c++11]
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>  // NOLINT [build/c++11]
+#include <thread>  // NOLINT [build/c++11]
+#include <vector>
+#include "../lib_parallel/work_stealing_deque.h"
+
+// гранулярность по умолчанию: столько индексов обрабатывается одним
+// вызовом тела цикла без дальнейшего дробления
+const size_t kDefaultGrain = 1024;
+
+// Пул потоков с кражей работы. У каждого участника свой дек Чейза-Лева:
+// диапазон parallel_for рекурсивно делится пополам, правая половина
+// кладётся в свой дек, левая обрабатывается дальше; простаивающие потоки
+// крадут крупные куски из чужих деков. Поток, вызвавший parallel_for,
+// участвует в работе наравне с рабочими (как участник с номером 0),
+// поэтому TThreadPool(1) выполняет всё последовательно без потоков.
+// Простаивающие потоки сначала крутятся, затем уступают процессор
+// и в конце засыпают до появления новой работы.
+class TThreadPool {
+ public:
+    // threads - общее число участников, включая вызывающий поток
+    explicit TThreadPool(size_t threads = default_thread_count());
+    ~TThreadPool();
+
+    TThreadPool(const TThreadPool&) = delete;
+    TThreadPool& operator=(const TThreadPool&) = delete;
+
+    size_t thread_count() const noexcept { return deques_.size(); }
+
+    static size_t default_thread_count();
+
+    // вызывает body(lo, hi) для непересекающихся кусков [begin, end)
+    // длиной не более grain и ждёт завершения всех кусков. Исключение из
+    // body пробрасывается вызывающему (первое из возникших).
+    // Допускаются вложенные вызовы из body.
+    void parallel_for(size_t begin, size_t end, size_t grain,
+                      const std::function<void(size_t, size_t)>& body);
+
+    // map(lo, hi) считает частичный результат по куску [lo, hi) длиной
+    // не более grain, combine сворачивает частичные результаты слева
+    // направо - результат не зависит от числа потоков
+    template <class T, class Map, class Combine>
+    T parallel_reduce(size_t begin, size_t end, size_t grain, T identity,
+                      Map map, Combine combine) {
+        if (begin >= end) {
+            return identity;
+        }
+        grain = std::max<size_t>(grain, 1);
+        size_t chunks = (end - begin + grain - 1) / grain;
+        std::vector<T> partial(chunks, identity);
+        parallel_for(0, chunks, 1, [&](size_t lo, size_t hi) {
+            for (size_t chunk = lo; chunk < hi; chunk++) {
+                size_t from = begin + chunk * grain;
+                partial[chunk] = map(from, std::min(end, from + grain));
+            }
+        });
+        T result = identity;
+        for (const T& value : partial) {
+            result = combine(result, value);
+        }
+        return result;
+    }
+
+ private:
+    struct TTaskGroup;
+    struct TTask;
+
+    void worker_loop(size_t index);
+    void push(size_t index, TTask* task);
+    TTask* find_task(size_t index);
+    void run_task(TTask* task, size_t index);
+    void wait_for_work();
+
+    std::vector<std::unique_ptr<TWorkStealingDeque<TTask*>>> deques_;
+    std::vector<std::thread> workers_;
+    std::atomic<bool> stop_;
+    std::atomic<size_t> sleeping_;
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_up_;
+    // внешние вызовы parallel_for делят дек участника 0 и выполняются
+    // по очереди
+    std::mutex external_mutex_;
+};
+
+#endif  // LIB_PARALLEL_THREAD_POOL_H_
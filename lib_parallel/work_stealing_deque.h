@@ -0,0 +1,146 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_PARALLEL_WORK_STEALING_DEQUE_H_
+#define LIB_PARALLEL_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../lib_cpu_features/cpu_features.h"
+
+// Дек Чейза-Лева (Chase-Lev) для планировщика с кражей работы
+// (вариант Lê et al., «Correct and Efficient Work-Stealing for Weak Memory
+// Models», 2013). Владелец кладёт и забирает задачи с «нижнего» конца
+// (push/take, LIFO - горячие данные в кэше), остальные потоки крадут с
+// «верхнего» (steal, FIFO - крупные куски работы). Массив растёт вдвое
+// при переполнении; старые массивы хранятся до разрушения дека, потому что
+// вор может ещё читать из них.
+// T - тривиально копируемый тип (обычно указатель на задачу).
+template <class T>
+class TWorkStealingDeque {
+ public:
+    explicit TWorkStealingDeque(size_t capacity = 1024)
+        : top_(0), bottom_(0) {
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        TArray* array = new TArray(rounded);
+        arrays_.push_back(array);
+        array_.store(array, std::memory_order_relaxed);
+    }
+
+    ~TWorkStealingDeque() {
+        for (TArray* array : arrays_) {
+            delete array;
+        }
+    }
+
+    TWorkStealingDeque(const TWorkStealingDeque&) = delete;
+    TWorkStealingDeque& operator=(const TWorkStealingDeque&) = delete;
+
+    // только владелец
+    void push(T item) {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_acquire);
+        TArray* array = array_.load(std::memory_order_relaxed);
+        if (b - t > static_cast<int64_t>(array->capacity) - 1) {
+            array = grow(array, t, b);
+        }
+        array->put(b, item);
+        // публикуем элемент: release-запись вместо пары
+        // «release-барьер + relaxed-запись» из статьи
+        bottom_.store(b + 1, std::memory_order_release);
+    }
+
+    // только владелец; false, если дек пуст
+    bool take(T* item) {
+        int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        TArray* array = array_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        T result = array->get(b);
+        if (t == b) {
+            // последний элемент: соревнуемся с ворами
+            bool won = top_.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst,
+                std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            if (!won) {
+                return false;
+            }
+        }
+        *item = result;
+        return true;
+    }
+
+    // любой поток; false, если дек пуст или элемент перехватили
+    bool steal(T* item) {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) {
+            return false;
+        }
+        TArray* array = array_.load(std::memory_order_acquire);
+        T result = array->get(t);
+        if (!top_.compare_exchange_strong(t, t + 1,
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+            return false;
+        }
+        *item = result;
+        return true;
+    }
+
+    // приблизительное число элементов
+    size_t size_approx() const {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+
+ private:
+    struct TArray {
+        explicit TArray(size_t size)
+            : capacity(size), mask(size - 1),
+              slots(new std::atomic<T>[size]) {}
+        ~TArray() { delete[] slots; }
+
+        T get(int64_t index) const {
+            return slots[static_cast<size_t>(index) & mask].load(
+                std::memory_order_relaxed);
+        }
+        void put(int64_t index, T item) {
+            slots[static_cast<size_t>(index) & mask].store(
+                item, std::memory_order_relaxed);
+        }
+
+        size_t capacity;
+        size_t mask;
+        std::atomic<T>* slots;
+    };
+
+    TArray* grow(TArray* array, int64_t top, int64_t bottom) {
+        TArray* bigger = new TArray(array->capacity * 2);
+        for (int64_t i = top; i < bottom; i++) {
+            bigger->put(i, array->get(i));
+        }
+        arrays_.push_back(bigger);
+        array_.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+    alignas(kCacheLineSize) std::atomic<int64_t> top_;
+    alignas(kCacheLineSize) std::atomic<int64_t> bottom_;
+    std::atomic<TArray*> array_;
+    std::vector<TArray*> arrays_;  // все массивы, меняется только владельцем
+};
+
+#endif  // LIB_PARALLEL_WORK_STEALING_DEQUE_H_
@@ -0,0 +1,88 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_POLYNOMIAL_MOD_INT_H_
+#define LIB_POLYNOMIAL_MOD_INT_H_
+
+#include <cstdint>
+#include <stdexcept>
+#include "../lib_easy_example/easy_example.h"
+
+// Вычет по простому модулю 998244353 = 119 * 2^23 + 1: в этом поле есть
+// корни из единицы степени до 2^23, что позволяет умножать многочлены
+// точным числовым преобразованием (NTT) без ошибок округления.
+class TModInt {
+ public:
+    static constexpr uint32_t kModulus = 998244353;
+    // первообразный корень по модулю kModulus
+    static constexpr uint32_t kPrimitiveRoot = 3;
+
+    constexpr TModInt() noexcept : value_(0) {}
+    constexpr TModInt(int64_t value) noexcept  // NOLINT(runtime/explicit)
+        : value_(static_cast<uint32_t>(
+              value % kModulus < 0 ? value % kModulus + kModulus
+                                   : value % kModulus)) {}
+
+    constexpr uint32_t value() const noexcept { return value_; }
+
+    TModInt& operator+=(TModInt other) noexcept {
+        value_ += other.value_;
+        if (value_ >= kModulus) {
+            value_ -= kModulus;
+        }
+        return *this;
+    }
+    TModInt& operator-=(TModInt other) noexcept {
+        value_ += kModulus - other.value_;
+        if (value_ >= kModulus) {
+            value_ -= kModulus;
+        }
+        return *this;
+    }
+    TModInt& operator*=(TModInt other) noexcept {
+        value_ = static_cast<uint32_t>(
+            static_cast<uint64_t>(value_) * other.value_ % kModulus);
+        return *this;
+    }
+    // деление на ноль бросает std::invalid_argument, как division()
+    TModInt& operator/=(TModInt other) { return *this *= other.inverse(); }
+
+    friend TModInt operator+(TModInt a, TModInt b) noexcept { return a += b; }
+    friend TModInt operator-(TModInt a, TModInt b) noexcept { return a -= b; }
+    friend TModInt operator*(TModInt a, TModInt b) noexcept { return a *= b; }
+    friend TModInt operator/(TModInt a, TModInt b) { return a /= b; }
+    TModInt operator-() const noexcept { return TModInt() - *this; }
+
+    friend bool operator==(TModInt a, TModInt b) noexcept {
+        return a.value_ == b.value_;
+    }
+    friend bool operator!=(TModInt a, TModInt b) noexcept {
+        return a.value_ != b.value_;
+    }
+
+    TModInt pow(uint64_t exponent) const noexcept {
+        TModInt result = 1;
+        TModInt base = *this;
+        while (exponent != 0) {
+            if (exponent & 1) {
+                result *= base;
+            }
+            base *= base;
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+    // обратный по малой теореме Ферма: a^(p - 2)
+    TModInt inverse() const {
+        if (value_ == 0) {
+            throw std::invalid_argument(
+                error_message(ErrorCode::kDivisionByZero));
+        }
+        return pow(kModulus - 2);
+    }
+
+ private:
+    uint32_t value_;
+};
+
+#endif  // LIB_POLYNOMIAL_MOD_INT_H_
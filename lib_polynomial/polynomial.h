@@ -0,0 +1,212 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_POLYNOMIAL_POLYNOMIAL_H_
+#define LIB_POLYNOMIAL_POLYNOMIAL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../lib_easy_example/easy_example.h"
+#include "../lib_easy_example/expected.h"
+#include "../lib_polynomial/mod_int.h"
+#include "../lib_polynomial/polynomial_multiply.h"
+
+// Многочлен с плотным массивом коэффициентов: coefficient(i) - при x^i.
+// Старший коэффициент всегда ненулевой (нулевой многочлен хранит пустой
+// массив и имеет степень -1). T - double или TModInt.
+template <class T>
+class TPolynomial {
+ public:
+    TPolynomial() = default;
+
+    // коэффициенты начиная с младшего
+    explicit TPolynomial(std::vector<T> coefficients)
+        : coefficients_(std::move(coefficients)) {
+        normalize();
+    }
+
+    TPolynomial(std::initializer_list<T> coefficients)
+        : coefficients_(coefficients) {
+        normalize();
+    }
+
+    // одночлен coefficient * x^power
+    static TPolynomial monomial(T coefficient, size_t power) {
+        std::vector<T> coefficients(power + 1);
+        coefficients[power] = coefficient;
+        return TPolynomial(std::move(coefficients));
+    }
+
+    int64_t degree() const noexcept {
+        return static_cast<int64_t>(coefficients_.size()) - 1;
+    }
+    bool is_zero() const noexcept { return coefficients_.empty(); }
+
+    T coefficient(size_t power) const {
+        return power < coefficients_.size() ? coefficients_[power] : T();
+    }
+    T leading() const { return is_zero() ? T() : coefficients_.back(); }
+    const std::vector<T>& coefficients() const noexcept {
+        return coefficients_;
+    }
+
+    // значение в точке x по схеме Горнера
+    T evaluate(T x) const {
+        T result = T();
+        for (size_t i = coefficients_.size(); i-- > 0;) {
+            result = result * x + coefficients_[i];
+        }
+        return result;
+    }
+
+    // значения во многих точках. Схема Горнера для одной точки - цепочка
+    // зависимых умножений, поэтому точки обрабатываются пачками по
+    // kBatch: kBatch независимых цепочек идут параллельно на конвейере
+    // процессора, а каждый коэффициент читается из памяти один раз на пачку
+    std::vector<T> evaluate(const std::vector<T>& points) const {
+        const size_t kBatch = 8;
+        std::vector<T> values(points.size());
+        size_t i = 0;
+        for (; i + kBatch <= points.size(); i += kBatch) {
+            T x[kBatch];
+            T acc[kBatch];
+            for (size_t j = 0; j < kBatch; j++) {
+                x[j] = points[i + j];
+                acc[j] = T();
+            }
+            for (size_t k = coefficients_.size(); k-- > 0;) {
+                T c = coefficients_[k];
+                for (size_t j = 0; j < kBatch; j++) {
+                    acc[j] = acc[j] * x[j] + c;
+                }
+            }
+            std::copy(acc, acc + kBatch, values.begin() + i);
+        }
+        for (; i < points.size(); i++) {
+            values[i] = evaluate(points[i]);
+        }
+        return values;
+    }
+
+    TPolynomial& operator+=(const TPolynomial& other) {
+        if (other.coefficients_.size() > coefficients_.size()) {
+            coefficients_.resize(other.coefficients_.size());
+        }
+        for (size_t i = 0; i < other.coefficients_.size(); i++) {
+            coefficients_[i] += other.coefficients_[i];
+        }
+        normalize();
+        return *this;
+    }
+
+    TPolynomial& operator-=(const TPolynomial& other) {
+        if (other.coefficients_.size() > coefficients_.size()) {
+            coefficients_.resize(other.coefficients_.size());
+        }
+        for (size_t i = 0; i < other.coefficients_.size(); i++) {
+            coefficients_[i] -= other.coefficients_[i];
+        }
+        normalize();
+        return *this;
+    }
+
+    friend TPolynomial operator+(TPolynomial a, const TPolynomial& b) {
+        return a += b;
+    }
+    friend TPolynomial operator-(TPolynomial a, const TPolynomial& b) {
+        return a -= b;
+    }
+
+    // алгоритм выбирается по порогам из polynomial_multiply.h
+    friend TPolynomial multiply(
+        const TPolynomial& a, const TPolynomial& b,
+        MultiplyAlgorithm algorithm = MultiplyAlgorithm::kAuto) {
+        return TPolynomial(
+            multiply_coefficients(a.coefficients_, b.coefficients_,
+                                  algorithm));
+    }
+    friend TPolynomial operator*(const TPolynomial& a, const TPolynomial& b) {
+        return multiply(a, b);
+    }
+
+    friend bool operator==(const TPolynomial& a, const TPolynomial& b) {
+        return a.coefficients_ == b.coefficients_;
+    }
+    friend bool operator!=(const TPolynomial& a, const TPolynomial& b) {
+        return !(a == b);
+    }
+
+ private:
+    void normalize() {
+        while (!coefficients_.empty() && coefficients_.back() == T()) {
+            coefficients_.pop_back();
+        }
+    }
+
+    std::vector<T> coefficients_;
+};
+
+// частное и остаток: a = quotient * b + remainder,
+// deg remainder < deg b
+template <class T>
+struct TPolynomialDivision {
+    TPolynomial<T> quotient;
+    TPolynomial<T> remainder;
+};
+
+// деление многочленов «уголком» без исключений, как try_division():
+// при нулевом делителе возвращает ErrorCode::kDivisionByZero
+template <class T>
+TExpected<TPolynomialDivision<T>, ErrorCode> try_divide(
+    const TPolynomial<T>& a, const TPolynomial<T>& b) {
+    if (b.is_zero()) {
+        return make_unexpected(ErrorCode::kDivisionByZero);
+    }
+    if (a.degree() < b.degree()) {
+        return TPolynomialDivision<T>{ TPolynomial<T>(), a };
+    }
+    const std::vector<T>& divisor = b.coefficients();
+    std::vector<T> remainder = a.coefficients();
+    size_t nb = divisor.size();
+    std::vector<T> quotient(remainder.size() - nb + 1);
+    T inverse_leading = T(1) / divisor.back();
+    for (size_t i = quotient.size(); i-- > 0;) {
+        T factor = remainder[i + nb - 1] * inverse_leading;
+        quotient[i] = factor;
+        for (size_t j = 0; j + 1 < nb; j++) {
+            remainder[i + j] -= factor * divisor[j];
+        }
+        // старший член сокращается точно, без погрешности округления
+        remainder[i + nb - 1] = T();
+    }
+    return TPolynomialDivision<T>{ TPolynomial<T>(std::move(quotient)),
+                                   TPolynomial<T>(std::move(remainder)) };
+}
+
+// деление с исключением std::invalid_argument при нулевом делителе,
+// с тем же сообщением, что у division()
+template <class T>
+TPolynomialDivision<T> divide(const TPolynomial<T>& a,
+                              const TPolynomial<T>& b) {
+    TExpected<TPolynomialDivision<T>, ErrorCode> result = try_divide(a, b);
+    if (!result) {
+        throw std::invalid_argument(error_message(result.error()));
+    }
+    return std::move(result).value();
+}
+
+template <class T>
+TPolynomial<T> operator/(const TPolynomial<T>& a, const TPolynomial<T>& b) {
+    return divide(a, b).quotient;
+}
+
+template <class T>
+TPolynomial<T> operator%(const TPolynomial<T>& a, const TPolynomial<T>& b) {
+    return divide(a, b).remainder;
+}
+
+#endif  // LIB_POLYNOMIAL_POLYNOMIAL_H_
@@ -0,0 +1,253 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include "../lib_polynomial/polynomial_multiply.h"
+
+namespace {
+
+// result[i + j] += a[i] * b[j]
+template <class T>
+void schoolbook(const T* a, size_t na, const T* b, size_t nb, T* result) {
+    for (size_t i = 0; i < na; i++) {
+        T a_i = a[i];
+        for (size_t j = 0; j < nb; j++) {
+            result[i + j] += a_i * b[j];
+        }
+    }
+}
+
+// result[0 .. 2n - 1) += a * b для множителей одинаковой длины n:
+// a = a0 + x^h a1, b = b0 + x^h b1,
+// a * b = z0 + x^h ((a0 + a1)(b0 + b1) - z0 - z2) + x^2h z2
+template <class T>
+void karatsuba(const T* a, const T* b, size_t n, T* result) {
+    if (n <= kKaratsubaThreshold) {
+        schoolbook(a, n, b, n, result);
+        return;
+    }
+    size_t h = n / 2;
+    size_t hi = n - h;  // hi >= h
+    std::vector<T> z0(2 * h - 1), z1(2 * hi - 1), z2(2 * hi - 1);
+    std::vector<T> sum_a(a + h, a + n), sum_b(b + h, b + n);
+    for (size_t i = 0; i < h; i++) {
+        sum_a[i] += a[i];
+        sum_b[i] += b[i];
+    }
+    karatsuba(a, b, h, z0.data());
+    karatsuba(a + h, b + h, hi, z2.data());
+    karatsuba(sum_a.data(), sum_b.data(), hi, z1.data());
+    for (size_t i = 0; i < z0.size(); i++) {
+        z1[i] -= z0[i];
+        result[i] += z0[i];
+    }
+    for (size_t i = 0; i < z2.size(); i++) {
+        z1[i] -= z2[i];
+        result[i + 2 * h] += z2[i];
+    }
+    for (size_t i = 0; i < z1.size(); i++) {
+        result[i + h] += z1[i];
+    }
+}
+
+// Карацуба для множителей разной длины: длинный множитель режется на
+// куски длины короткого, каждый кусок умножается отдельно
+template <class T>
+std::vector<T> multiply_karatsuba(const std::vector<T>& a,
+                                  const std::vector<T>& b) {
+    const std::vector<T>& longer = a.size() >= b.size() ? a : b;
+    const std::vector<T>& shorter = a.size() >= b.size() ? b : a;
+    size_t m = shorter.size();
+    size_t chunks = (longer.size() + m - 1) / m;
+    std::vector<T> result(chunks * m + m - 1);
+    std::vector<T> chunk(m);
+    for (size_t c = 0; c < chunks; c++) {
+        size_t from = c * m;
+        size_t length = std::min(m, longer.size() - from);
+        std::copy(longer.begin() + from, longer.begin() + from + length,
+                  chunk.begin());
+        std::fill(chunk.begin() + length, chunk.end(), T());
+        karatsuba(chunk.data(), shorter.data(), m, result.data() + from);
+    }
+    result.resize(a.size() + b.size() - 1);
+    return result;
+}
+
+size_t transform_size(size_t length) {
+    size_t size = 1;
+    while (size < length) {
+        size <<= 1;
+    }
+    return size;
+}
+
+// перестановка элементов в бит-обратном порядке индексов
+template <class T>
+void bit_reverse(std::vector<T>* values) {
+    size_t n = values->size();
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap((*values)[i], (*values)[j]);
+        }
+    }
+}
+
+// итеративное БПФ (Кули-Тьюки по основанию 2) на месте; корни на каждом
+// уровне берутся из одной таблицы, посчитанной через cos/sin напрямую,
+// а не последовательным умножением, чтобы не накапливать погрешность
+void fft(std::vector<std::complex<double>>* values, bool inverse) {
+    const double kPi = std::acos(-1.0);
+    size_t n = values->size();
+    std::vector<std::complex<double>> roots(n / 2);
+    for (size_t k = 0; k < n / 2; k++) {
+        double angle = 2 * kPi * k / n * (inverse ? -1 : 1);
+        roots[k] = std::complex<double>(std::cos(angle), std::sin(angle));
+    }
+    bit_reverse(values);
+    std::complex<double>* data = values->data();
+    for (size_t length = 2; length <= n; length <<= 1) {
+        size_t half = length / 2;
+        size_t step = n / length;
+        for (size_t i = 0; i < n; i += length) {
+            for (size_t k = 0; k < half; k++) {
+                std::complex<double> u = data[i + k];
+                std::complex<double> v = data[i + k + half] * roots[k * step];
+                data[i + k] = u + v;
+                data[i + k + half] = u - v;
+            }
+        }
+    }
+}
+
+// Произведение вещественных многочленов за одно прямое и одно обратное
+// БПФ: (a + ib)^2 = a^2 - b^2 + 2i * ab, то есть ab - половина мнимой
+// части квадрата.
+std::vector<double> multiply_transform(const std::vector<double>& a,
+                                       const std::vector<double>& b) {
+    size_t length = a.size() + b.size() - 1;
+    size_t n = transform_size(length);
+    std::vector<std::complex<double>> values(n);
+    for (size_t i = 0; i < a.size(); i++) {
+        values[i].real(a[i]);
+    }
+    for (size_t i = 0; i < b.size(); i++) {
+        values[i].imag(b[i]);
+    }
+    fft(&values, false);
+    for (std::complex<double>& value : values) {
+        value *= value;
+    }
+    fft(&values, true);
+    std::vector<double> result(length);
+    for (size_t i = 0; i < length; i++) {
+        result[i] = values[i].imag() / (2.0 * n);
+    }
+    return result;
+}
+
+// числовое преобразование Фурье по модулю TModInt::kModulus
+void ntt(std::vector<TModInt>* values, bool inverse) {
+    size_t n = values->size();
+    bit_reverse(values);
+    TModInt* data = values->data();
+    std::vector<TModInt> roots(n / 2);
+    for (size_t length = 2; length <= n; length <<= 1) {
+        size_t half = length / 2;
+        TModInt root = TModInt(TModInt::kPrimitiveRoot)
+                           .pow((TModInt::kModulus - 1) / length);
+        if (inverse) {
+            root = root.inverse();
+        }
+        roots[0] = 1;
+        for (size_t k = 1; k < half; k++) {
+            roots[k] = roots[k - 1] * root;
+        }
+        for (size_t i = 0; i < n; i += length) {
+            for (size_t k = 0; k < half; k++) {
+                TModInt u = data[i + k];
+                TModInt v = data[i + k + half] * roots[k];
+                data[i + k] = u + v;
+                data[i + k + half] = u - v;
+            }
+        }
+    }
+    if (inverse) {
+        TModInt scale = TModInt(static_cast<int64_t>(n)).inverse();
+        for (size_t i = 0; i < n; i++) {
+            data[i] *= scale;
+        }
+    }
+}
+
+// наибольшая длина NTT для модуля 119 * 2^23 + 1
+const size_t kMaxNttSize = size_t(1) << 23;
+
+std::vector<TModInt> multiply_transform(const std::vector<TModInt>& a,
+                                        const std::vector<TModInt>& b) {
+    size_t length = a.size() + b.size() - 1;
+    size_t n = transform_size(length);
+    if (n > kMaxNttSize) {
+        return multiply_karatsuba(a, b);
+    }
+    std::vector<TModInt> fa(a), fb(b);
+    fa.resize(n);
+    fb.resize(n);
+    ntt(&fa, false);
+    ntt(&fb, false);
+    for (size_t i = 0; i < n; i++) {
+        fa[i] *= fb[i];
+    }
+    ntt(&fa, true);
+    fa.resize(length);
+    return fa;
+}
+
+template <class T>
+std::vector<T> multiply_dispatch(const std::vector<T>& a,
+                                 const std::vector<T>& b,
+                                 MultiplyAlgorithm algorithm) {
+    if (a.empty() || b.empty()) {
+        return std::vector<T>();
+    }
+    if (algorithm == MultiplyAlgorithm::kAuto) {
+        size_t shorter = std::min(a.size(), b.size());
+        if (shorter < kKaratsubaThreshold) {
+            algorithm = MultiplyAlgorithm::kSchoolbook;
+        } else if (shorter < kTransformThreshold) {
+            algorithm = MultiplyAlgorithm::kKaratsuba;
+        } else {
+            algorithm = MultiplyAlgorithm::kTransform;
+        }
+    }
+    switch (algorithm) {
+    case MultiplyAlgorithm::kKaratsuba:
+        return multiply_karatsuba(a, b);
+    case MultiplyAlgorithm::kTransform:
+        return multiply_transform(a, b);
+    default: {
+        std::vector<T> result(a.size() + b.size() - 1);
+        schoolbook(a.data(), a.size(), b.data(), b.size(), result.data());
+        return result;
+    }
+    }
+}
+
+}  // namespace
+
+std::vector<double> multiply_coefficients(const std::vector<double>& a,
+                                          const std::vector<double>& b,
+                                          MultiplyAlgorithm algorithm) {
+    return multiply_dispatch(a, b, algorithm);
+}
+
+std::vector<TModInt> multiply_coefficients(const std::vector<TModInt>& a,
+                                           const std::vector<TModInt>& b,
+                                           MultiplyAlgorithm algorithm) {
+    return multiply_dispatch(a, b, algorithm);
+}
@@ -0,0 +1,36 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_POLYNOMIAL_POLYNOMIAL_MULTIPLY_H_
+#define LIB_POLYNOMIAL_POLYNOMIAL_MULTIPLY_H_
+
+#include <cstddef>
+#include <vector>
+#include "../lib_polynomial/mod_int.h"
+
+// алгоритм умножения массивов коэффициентов
+enum class MultiplyAlgorithm {
+    kAuto,        // выбор по длине более короткого множителя
+    kSchoolbook,  // O(n * m)
+    kKaratsuba,   // O(n^1.58)
+    kTransform    // O(n log n): FFT для double, NTT для TModInt
+};
+
+// Пороги kAuto подобраны бенчмарком bm_polynomial_multiply (сравнение
+// трёх алгоритмов на длинах 8 .. 2^17): короче kKaratsubaThreshold -
+// школьное умножение, короче kTransformThreshold - Карацуба, иначе
+// быстрое преобразование. kKaratsubaThreshold также служит базой
+// рекурсии Карацубы.
+const size_t kKaratsubaThreshold = 32;
+const size_t kTransformThreshold = 128;
+
+// коэффициенты произведения многочленов (младшие - первыми); длина
+// результата a.size() + b.size() - 1, для пустого множителя - пусто.
+// Для double FFT даёт погрешность порядка 1e-15 * max|a| * max|b| * n.
+std::vector<double> multiply_coefficients(
+    const std::vector<double>& a, const std::vector<double>& b,
+    MultiplyAlgorithm algorithm = MultiplyAlgorithm::kAuto);
+std::vector<TModInt> multiply_coefficients(
+    const std::vector<TModInt>& a, const std::vector<TModInt>& b,
+    MultiplyAlgorithm algorithm = MultiplyAlgorithm::kAuto);
+
+#endif  // LIB_POLYNOMIAL_POLYNOMIAL_MULTIPLY_H_
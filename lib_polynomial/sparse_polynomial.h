@@ -0,0 +1,171 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_POLYNOMIAL_SPARSE_POLYNOMIAL_H_
+#define LIB_POLYNOMIAL_SPARSE_POLYNOMIAL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../lib_polynomial/polynomial.h"
+
+// Многочлен, хранящий только ненулевые одночлены по возрастанию
+// степеней: подходит для x^1000000 + 1, где плотный массив занял бы
+// миллион коэффициентов.
+template <class T>
+class TSparsePolynomial {
+ public:
+    struct TMonomial {
+        uint64_t power;
+        T coefficient;
+    };
+
+    TSparsePolynomial() = default;
+
+    explicit TSparsePolynomial(const TPolynomial<T>& dense) {
+        const std::vector<T>& coefficients = dense.coefficients();
+        for (size_t i = 0; i < coefficients.size(); i++) {
+            if (coefficients[i] != T()) {
+                terms_.push_back({ i, coefficients[i] });
+            }
+        }
+    }
+
+    // прибавляет coefficient * x^power
+    void add_term(uint64_t power, T coefficient) {
+        auto it = std::lower_bound(
+            terms_.begin(), terms_.end(), power,
+            [](const TMonomial& term, uint64_t value) {
+                return term.power < value;
+            });
+        if (it != terms_.end() && it->power == power) {
+            it->coefficient += coefficient;
+            if (it->coefficient == T()) {
+                terms_.erase(it);
+            }
+        } else if (coefficient != T()) {
+            terms_.insert(it, { power, coefficient });
+        }
+    }
+
+    const std::vector<TMonomial>& terms() const noexcept { return terms_; }
+    size_t term_count() const noexcept { return terms_.size(); }
+    bool is_zero() const noexcept { return terms_.empty(); }
+    int64_t degree() const noexcept {
+        return is_zero() ? -1 : static_cast<int64_t>(terms_.back().power);
+    }
+
+    T coefficient(uint64_t power) const {
+        auto it = std::lower_bound(
+            terms_.begin(), terms_.end(), power,
+            [](const TMonomial& term, uint64_t value) {
+                return term.power < value;
+            });
+        return it != terms_.end() && it->power == power ? it->coefficient
+                                                        : T();
+    }
+
+    // значение в точке x: степени растут, поэтому x^power получается из
+    // предыдущей степени домножением на x^(разность) быстрым возведением
+    T evaluate(T x) const {
+        T result = T();
+        T power_value = T(1);
+        uint64_t power = 0;
+        for (const TMonomial& term : terms_) {
+            power_value *= power_of(x, term.power - power);
+            power = term.power;
+            result += term.coefficient * power_value;
+        }
+        return result;
+    }
+
+    TPolynomial<T> to_dense() const {
+        std::vector<T> coefficients(static_cast<size_t>(degree() + 1));
+        for (const TMonomial& term : terms_) {
+            coefficients[term.power] = term.coefficient;
+        }
+        return TPolynomial<T>(std::move(coefficients));
+    }
+
+    // слияние двух упорядоченных списков одночленов
+    friend TSparsePolynomial operator+(const TSparsePolynomial& a,
+                                       const TSparsePolynomial& b) {
+        TSparsePolynomial result;
+        result.terms_.reserve(a.terms_.size() + b.terms_.size());
+        size_t i = 0;
+        size_t j = 0;
+        while (i < a.terms_.size() || j < b.terms_.size()) {
+            bool take_a = j == b.terms_.size() ||
+                          (i < a.terms_.size() &&
+                           a.terms_[i].power < b.terms_[j].power);
+            if (take_a) {
+                result.terms_.push_back(a.terms_[i++]);
+            } else if (i == a.terms_.size() ||
+                       b.terms_[j].power < a.terms_[i].power) {
+                result.terms_.push_back(b.terms_[j++]);
+            } else {
+                T sum = a.terms_[i].coefficient + b.terms_[j].coefficient;
+                if (sum != T()) {
+                    result.terms_.push_back({ a.terms_[i].power, sum });
+                }
+                i++;
+                j++;
+            }
+        }
+        return result;
+    }
+
+    // попарные произведения одночленов, затем сортировка по степени и
+    // сложение одночленов одинаковой степени
+    friend TSparsePolynomial operator*(const TSparsePolynomial& a,
+                                       const TSparsePolynomial& b) {
+        std::vector<TMonomial> products;
+        products.reserve(a.terms_.size() * b.terms_.size());
+        for (const TMonomial& left : a.terms_) {
+            for (const TMonomial& right : b.terms_) {
+                products.push_back({ left.power + right.power,
+                                     left.coefficient * right.coefficient });
+            }
+        }
+        std::sort(products.begin(), products.end(),
+                  [](const TMonomial& left, const TMonomial& right) {
+                      return left.power < right.power;
+                  });
+        TSparsePolynomial result;
+        for (const TMonomial& term : products) {
+            if (!result.terms_.empty() &&
+                result.terms_.back().power == term.power) {
+                result.terms_.back().coefficient += term.coefficient;
+            } else {
+                if (!result.terms_.empty() &&
+                    result.terms_.back().coefficient == T()) {
+                    result.terms_.pop_back();
+                }
+                result.terms_.push_back(term);
+            }
+        }
+        if (!result.terms_.empty() &&
+            result.terms_.back().coefficient == T()) {
+            result.terms_.pop_back();
+        }
+        return result;
+    }
+
+ private:
+    static T power_of(T x, uint64_t exponent) {
+        T result = T(1);
+        while (exponent != 0) {
+            if (exponent & 1) {
+                result *= x;
+            }
+            x *= x;
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+    std::vector<TMonomial> terms_;
+};
+
+#endif  // LIB_POLYNOMIAL_SPARSE_POLYNOMIAL_H_
@@ -0,0 +1,210 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_QUEUE_QUEUE_H_
+#define LIB_QUEUE_QUEUE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Очередь FIFO на кольцевом буфере в одном непрерывном блоке памяти.
+// Ёмкость - степень двойки, позиция элемента вычисляется маской; когда
+// буфер заполнен, он вдвое увеличивается и элементы переносятся по
+// порядку начиная с нулевой позиции. Как и в TSpscRingBuffer, head_
+// и tail_ - непрерывно растущие счётчики (размер - их разность), поэтому
+// push меняет только tail_, а pop - только head_. Память при снятии
+// элементов не освобождается (её можно вернуть shrink_to_fit()), поэтому
+// очередь с колеблющимся размером, как в обходе графа в ширину, не
+// обращается к аллокатору. Обращение к голове пустой очереди бросает
+// std::out_of_range.
+template <class T>
+class TQueue {
+ public:
+    using value_type = T;
+
+    TQueue() noexcept : data_(nullptr), capacity_(0), mask_(0), head_(0),
+                        tail_(0) {}
+
+    TQueue(const TQueue& other) : TQueue() {
+        reserve(other.size());
+        for (size_t i = 0; i < other.size(); i++) {
+            push(other[i]);
+        }
+    }
+
+    TQueue(TQueue&& other) noexcept : TQueue() { swap(other); }
+
+    ~TQueue() {
+        clear();
+        ::operator delete(data_);
+    }
+
+    TQueue& operator=(const TQueue& other) {
+        if (this != &other) {
+            TQueue copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    TQueue& operator=(TQueue&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    size_t size() const noexcept { return tail_ - head_; }
+    bool empty() const noexcept { return tail_ == head_; }
+    size_t capacity() const noexcept { return capacity_; }
+
+    // i-й элемент от головы
+    T& operator[](size_t index) noexcept {
+        return data_[(head_ + index) & mask_];
+    }
+    const T& operator[](size_t index) const noexcept {
+        return data_[(head_ + index) & mask_];
+    }
+
+    T& front() {
+        check_not_empty();
+        return data_[head_ & mask_];
+    }
+    const T& front() const {
+        check_not_empty();
+        return data_[head_ & mask_];
+    }
+    T& back() {
+        check_not_empty();
+        return data_[(tail_ - 1) & mask_];
+    }
+    const T& back() const {
+        check_not_empty();
+        return data_[(tail_ - 1) & mask_];
+    }
+
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    template <class... Args>
+    T& emplace(Args&&... args) {
+        if (tail_ - head_ == capacity_) {
+            // элемент строится до переноса: аргументы могут ссылаться на
+            // элементы самой очереди
+            T value(std::forward<Args>(args)...);
+            reallocate(std::max<size_t>(capacity_ * 2, kMinCapacity));
+            T* slot = new (data_ + (tail_ & mask_)) T(std::move(value));
+            tail_++;
+            return *slot;
+        }
+        // счётчик читается до записи элемента: запись через T* может
+        // указывать на tail_, и иначе компилятор перечитывает его из памяти
+        size_t tail = tail_;
+        T* slot = data_ + (tail & mask_);
+        new (slot) T(std::forward<Args>(args)...);
+        tail_ = tail + 1;
+        return *slot;
+    }
+
+    void pop() {
+        check_not_empty();
+        size_t head = head_;
+        data_[head & mask_].~T();
+        head_ = head + 1;
+    }
+
+    // снимает голову и возвращает её значение
+    T take() {
+        check_not_empty();
+        T value(std::move(data_[head_ & mask_]));
+        pop();
+        return value;
+    }
+
+    void clear() noexcept {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = head_; i != tail_; i++) {
+                data_[i & mask_].~T();
+            }
+        }
+        head_ = 0;
+        tail_ = 0;
+    }
+
+    // гарантирует capacity() >= capacity (ёмкость - степень двойки)
+    void reserve(size_t capacity) {
+        if (capacity > capacity_) {
+            size_t rounded = kMinCapacity;
+            while (rounded < capacity) {
+                rounded *= 2;
+            }
+            reallocate(rounded);
+        }
+    }
+
+    // уменьшает буфер до наименьшей подходящей степени двойки
+    void shrink_to_fit() {
+        size_t size = tail_ - head_;
+        size_t rounded = size == 0 ? 0 : kMinCapacity;
+        while (rounded < size) {
+            rounded *= 2;
+        }
+        if (rounded < capacity_) {
+            reallocate(rounded);
+        }
+    }
+
+    void swap(TQueue& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(mask_, other.mask_);
+        std::swap(head_, other.head_);
+        std::swap(tail_, other.tail_);
+    }
+
+ private:
+    static constexpr size_t kMinCapacity = 16;
+
+    void check_not_empty() const {
+        if (tail_ == head_) {
+            throw std::out_of_range("TQueue: queue is empty");
+        }
+    }
+
+    // переносит элементы в новый буфер начиная с позиции 0
+    void reallocate(size_t capacity) {
+        T* data = capacity == 0 ? nullptr : static_cast<T*>(
+            ::operator new(capacity * sizeof(T)));
+        size_t size = tail_ - head_;
+        size_t moved = 0;
+        try {
+            for (; moved < size; moved++) {
+                new (data + moved) T(std::move_if_noexcept((*this)[moved]));
+            }
+        } catch (...) {
+            for (size_t i = 0; i < moved; i++) {
+                data[i].~T();
+            }
+            ::operator delete(data);
+            throw;
+        }
+        clear();
+        ::operator delete(data_);
+        data_ = data;
+        capacity_ = capacity;
+        mask_ = capacity == 0 ? 0 : capacity - 1;
+        tail_ = size;
+    }
+
+    T* data_;
+    size_t capacity_;  // 0 или степень двойки
+    size_t mask_;      // capacity_ - 1
+    size_t head_;      // номер головы; позиция в буфере - head_ & mask_
+    size_t tail_;      // номер следующего элемента после хвоста
+};
+
+#endif  // LIB_QUEUE_QUEUE_H_
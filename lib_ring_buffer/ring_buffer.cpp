@@ -0,0 +1,11 @@
+// Copyright 2024 Marina Usova
+
+#include "../lib_ring_buffer/ring_buffer.h"
+
+size_t round_up_to_power_of_two(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
@@ -0,0 +1,154 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_RING_BUFFER_RING_BUFFER_H_
+#define LIB_RING_BUFFER_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "../lib_cpu_features/cpu_features.h"
+
+// округление вверх до степени двойки (0 -> 1)
+size_t round_up_to_power_of_two(size_t value);
+
+// Ограниченная очередь без блокировок для одного потока-производителя и
+// одного потока-потребителя. Ёмкость округляется вверх до степени двойки,
+// чтобы индекс в буфере получался маской, а не делением.
+// Индексы head_ (потребитель) и tail_ (производитель) лежат в разных
+// кэш-линиях и синхронизируются парой acquire/release; каждый поток держит
+// кэшированную копию чужого индекса и перечитывает атомик, только когда
+// по копии очередь кажется пустой (полной).
+// try_push/push_batch можно вызывать только из одного потока,
+// try_pop/pop_batch - только из другого.
+template <class T>
+class TSpscRingBuffer {
+ public:
+    explicit TSpscRingBuffer(size_t capacity)
+        : head_(0), cached_tail_(0), tail_(0), cached_head_(0) {
+        if (capacity == 0) {
+            throw std::invalid_argument(
+                "TSpscRingBuffer: capacity must be positive");
+        }
+        capacity_ = round_up_to_power_of_two(capacity);
+        mask_ = capacity_ - 1;
+        buffer_ = static_cast<T*>(::operator new(capacity_ * sizeof(T)));
+    }
+
+    ~TSpscRingBuffer() {
+        size_t tail = tail_.load(std::memory_order_acquire);
+        for (size_t i = head_.load(std::memory_order_acquire); i != tail;
+             i++) {
+            buffer_[i & mask_].~T();
+        }
+        ::operator delete(buffer_);
+    }
+
+    TSpscRingBuffer(const TSpscRingBuffer&) = delete;
+    TSpscRingBuffer& operator=(const TSpscRingBuffer&) = delete;
+
+    size_t capacity() const noexcept { return capacity_; }
+
+    // приблизительный размер: точен, только если второй поток простаивает
+    size_t size_approx() const noexcept {
+        return tail_.load(std::memory_order_acquire) -
+               head_.load(std::memory_order_acquire);
+    }
+
+    // --- сторона производителя ---
+
+    template <class... Args>
+    bool try_emplace(Args&&... args) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ == capacity_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ == capacity_) {
+                return false;
+            }
+        }
+        new (buffer_ + (tail & mask_)) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& item) { return try_emplace(item); }
+    bool try_push(T&& item) { return try_emplace(std::move(item)); }
+
+    // кладёт столько элементов из items, сколько поместится (не более
+    // count), одной публикацией индекса; возвращает их число
+    size_t push_batch(const T* items, size_t count) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t free = capacity_ - (tail - cached_head_);
+        if (free < count) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            free = capacity_ - (tail - cached_head_);
+        }
+        size_t pushed = count < free ? count : free;
+        size_t i = 0;
+        try {
+            for (; i < pushed; i++) {
+                new (buffer_ + ((tail + i) & mask_)) T(items[i]);
+            }
+        } catch (...) {
+            // неопубликованные элементы потребитель не увидит - их
+            // разрушает производитель, tail_ не меняется
+            for (size_t j = 0; j < i; j++) {
+                buffer_[(tail + j) & mask_].~T();
+            }
+            throw;
+        }
+        tail_.store(tail + pushed, std::memory_order_release);
+        return pushed;
+    }
+
+    // --- сторона потребителя ---
+
+    bool try_pop(T* item) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_) {
+                return false;
+            }
+        }
+        T* slot = buffer_ + (head & mask_);
+        *item = std::move(*slot);
+        slot->~T();
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // забирает до max_count элементов одной публикацией индекса,
+    // возвращает их число
+    size_t pop_batch(T* items, size_t max_count) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t available = cached_tail_ - head;
+        if (available < max_count) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            available = cached_tail_ - head;
+        }
+        size_t popped = max_count < available ? max_count : available;
+        for (size_t i = 0; i < popped; i++) {
+            T* slot = buffer_ + ((head + i) & mask_);
+            items[i] = std::move(*slot);
+            slot->~T();
+        }
+        head_.store(head + popped, std::memory_order_release);
+        return popped;
+    }
+
+ private:
+    // данные потребителя
+    alignas(kCacheLineSize) std::atomic<size_t> head_;
+    size_t cached_tail_;
+    // данные производителя
+    alignas(kCacheLineSize) std::atomic<size_t> tail_;
+    size_t cached_head_;
+    // неизменяемые после создания поля, читаются обоими потоками
+    alignas(kCacheLineSize) size_t capacity_;
+    size_t mask_;
+    T* buffer_;
+};
+
+#endif  // LIB_RING_BUFFER_RING_BUFFER_H_
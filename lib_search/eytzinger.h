@@ -0,0 +1,109 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_SEARCH_EYTZINGER_H_
+#define LIB_SEARCH_EYTZINGER_H_
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "../lib_search/search.h"
+
+namespace search_detail {
+
+// число единиц в младших разрядах value (value != UINT64_MAX)
+inline int count_trailing_ones(uint64_t value) noexcept {
+#ifdef _MSC_VER
+    unsigned long index;  // NOLINT(runtime/int)
+    _BitScanForward64(&index, ~value);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(~value);
+#endif
+}
+
+}  // namespace search_detail
+
+// Отсортированный массив в порядке Эйтцингера (обход в ширину неявного
+// двоичного дерева поиска): корень - элемент 1, дети элемента k -
+// элементы 2k и 2k + 1. Спуск идёт по индексу без ветвлений, и первые
+// уровни дерева, к которым обращается каждый поиск, лежат рядом в
+// нескольких строках кэша. Массив выровнен на 64 байта, поэтому
+// потомки узла k на log2(64 / sizeof(T)) уровней ниже занимают одну
+// строку кэша: она запрашивается заранее, и на массивах больше кэша
+// промахи нескольких уровней перекрываются. lower_bound возвращает
+// индекс в исходном отсортированном массиве, для чего рядом хранится
+// таблица позиций (одно обращение в конце поиска)
+template <class T, class Less = std::less<T>>
+class TEytzingerArray {
+ public:
+    TEytzingerArray() : size_(0), offset_(0), less_(Less()) {}
+
+    // sorted[0 .. count) должен быть упорядочен по less
+    TEytzingerArray(const T* sorted, size_t count, Less less = Less())
+        : size_(count), offset_(0), ranks_(count + 1), less_(less) {
+        // запас на выравнивание начала на строку кэша
+        storage_.resize(count + 1 + kLineItems);
+        if (64 % sizeof(T) == 0) {
+            size_t address = reinterpret_cast<size_t>(storage_.data());
+            offset_ = ((0 - address) & 63) / sizeof(T);
+        }
+        fill(sorted, 0, 1);
+    }
+
+    // копия потеряла бы выравнивание, перемещение его сохраняет
+    TEytzingerArray(const TEytzingerArray&) = delete;
+    TEytzingerArray& operator=(const TEytzingerArray&) = delete;
+    TEytzingerArray(TEytzingerArray&&) = default;
+    TEytzingerArray& operator=(TEytzingerArray&&) = default;
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    // индекс первого не меньшего key элемента исходного массива
+    // (size(), если такого нет)
+    size_t lower_bound(const T& key) const {
+        const T* tree = storage_.data() + offset_;
+        size_t k = 1;
+        while (k <= size_) {
+            // адрес считается целым числом: за концом массива проба
+            // безвредна, а указатель за его пределы сформировать нельзя
+            search_detail::prefetch(reinterpret_cast<const void*>(
+                reinterpret_cast<uintptr_t>(tree) +
+                k * kLineItems * sizeof(T)));
+            k = 2 * k + (less_(tree[k], key) ? 1 : 0);
+        }
+        // подъём к последнему узлу, где спуск ушёл влево
+        k >>= search_detail::count_trailing_ones(k) + 1;
+        return k == 0 ? size_ : ranks_[k];
+    }
+
+ private:
+    // столько элементов в строке кэша, но не меньше двух (дети узла)
+    static const size_t kLineItems =
+        64 / sizeof(T) >= 2 ? 64 / sizeof(T) : 2;
+
+    // раскладка поддерева узла k обходом в глубину: следующий по
+    // порядку элемент sorted - с индексом next
+    size_t fill(const T* sorted, size_t next, size_t k) {
+        if (k <= size_) {
+            next = fill(sorted, next, 2 * k);
+            storage_[offset_ + k] = sorted[next];
+            ranks_[k] = next++;
+            next = fill(sorted, next, 2 * k + 1);
+        }
+        return next;
+    }
+
+    size_t size_;
+    size_t offset_;
+    std::vector<T> storage_;
+    std::vector<size_t> ranks_;
+    Less less_;
+};
+
+#endif  // LIB_SEARCH_EYTZINGER_H_
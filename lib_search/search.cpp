@@ -0,0 +1,4 @@
+// Copyright 2024 Marina Usova
+
+#include "../lib_search/eytzinger.h"
+#include "../lib_search/search.h"
@@ -0,0 +1,150 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_SEARCH_SEARCH_H_
+#define LIB_SEARCH_SEARCH_H_
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+// сколько запросов batch_lower_bound ведёт одновременно: столько
+// промахов кэша перекрываются на каждом шаге
+const size_t kSearchBatch = 16;
+// на отрезке короче interpolation_search переходит к двоичному поиску
+const size_t kInterpolationMin = 64;
+// после стольких шагов интерполяции без сужения отрезка до
+// kInterpolationMin поиск тоже становится двоичным (неравномерные ключи)
+const size_t kInterpolationSteps = 8;
+
+namespace search_detail {
+
+// подсказка процессору начать загрузку строки кэша с address
+inline void prefetch(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
+
+}  // namespace search_detail
+
+// То же, что std::lower_bound: индекс первого элемента data[0 .. count),
+// не меньшего key (count, если такого нет). Отрезок делится пополам
+// ровно floor(log2 count) + 1 раз независимо от данных, а выбор половины
+// - условная пересылка вместо перехода, поэтому предсказатель ветвлений
+// не ошибается на каждом уровне. Пока идёт сравнение, обе возможные
+// следующие середины запрашиваются заранее: на массивах больше кэша
+// задержка памяти частично скрывается
+template <class T, class Less = std::less<T>>
+size_t branchless_lower_bound(const T* data, size_t count, const T& key,
+                              Less less = Less()) {
+    if (count == 0) {
+        return 0;
+    }
+    const T* base = data;
+    while (count > 1) {
+        size_t half = count / 2;
+        size_t next = (count - half) / 2;
+        search_detail::prefetch(base + next);
+        search_detail::prefetch(base + half + next);
+        base = less(base[half], key) ? base + half : base;
+        count -= half;
+    }
+    return static_cast<size_t>(base - data) + (less(*base, key) ? 1 : 0);
+}
+
+// lower_bound для key_count запросов keys: results[i] - ответ для
+// keys[i]. Запросы идут группами по kSearchBatch; вся группа проходит
+// уровни двоичного поиска вместе (число шагов зависит только от count),
+// поэтому загрузки разных запросов независимы и их промахи кэша
+// перекрываются, а не следуют друг за другом
+template <class T, class Less = std::less<T>>
+void batch_lower_bound(const T* data, size_t count, const T* keys,
+                       size_t key_count, size_t* results,
+                       Less less = Less()) {
+    if (count == 0) {
+        std::fill(results, results + key_count, size_t(0));
+        return;
+    }
+    const T* bases[kSearchBatch];
+    for (size_t first = 0; first < key_count; first += kSearchBatch) {
+        size_t group = std::min(kSearchBatch, key_count - first);
+        const T* group_keys = keys + first;
+        for (size_t i = 0; i < group; i++) {
+            bases[i] = data;
+        }
+        for (size_t length = count; length > 1;) {
+            size_t half = length / 2;
+            size_t next = (length - half) / 2;
+            for (size_t i = 0; i < group; i++) {
+                const T* base = bases[i];
+                base = less(base[half], group_keys[i]) ? base + half : base;
+                search_detail::prefetch(base + next);
+                bases[i] = base;
+            }
+            length -= half;
+        }
+        for (size_t i = 0; i < group; i++) {
+            results[first + i] = static_cast<size_t>(bases[i] - data) +
+                                 (less(*bases[i], group_keys[i]) ? 1 : 0);
+        }
+    }
+}
+
+// lower_bound для чисел, распределённых примерно равномерно: позиция
+// пробы оценивается линейной интерполяцией между крайними элементами
+// отрезка, и на равномерных ключах отрезок сжимается до
+// kInterpolationMin за O(log log count) проб вместо log2 count.
+// Остаток ищется branchless_lower_bound; на неравномерных данных (где
+// интерполяция может сужать отрезок по одному элементу) после
+// kInterpolationSteps проб поиск тоже переходит к двоичному, так что
+// худший случай - O(log count). Результат совпадает с std::lower_bound
+template <class T>
+size_t interpolation_search(const T* data, size_t count, T key) {
+    static_assert(std::is_arithmetic<T>::value,
+                  "interpolation needs arithmetic keys");
+    // ответ лежит в [low, high]
+    size_t low = 0;
+    size_t high = count;
+    for (size_t step = 0;
+         step < kInterpolationSteps && high - low > kInterpolationMin;
+         step++) {
+        T first = data[low];
+        T last = data[high - 1];
+        if (!(first < key)) {
+            return low;
+        }
+        if (last < key) {
+            return high;
+        }
+        // first < key <= last
+        double span = static_cast<double>(last) - static_cast<double>(first);
+        double offset = (static_cast<double>(key) -
+                         static_cast<double>(first)) / span *
+                        static_cast<double>(high - 1 - low);
+        // защита от NaN, бесконечности и округления: проба внутри
+        // (low, high - 1]
+        size_t probe = low + 1;
+        if (offset >= 1) {
+            probe = low + static_cast<size_t>(std::min(
+                offset, static_cast<double>(high - 1 - low)));
+        }
+        if (data[probe] < key) {
+            low = probe + 1;
+        } else {
+            high = probe;
+        }
+    }
+    return low + branchless_lower_bound(data + low, high - low, key);
+}
+
+#endif  // LIB_SEARCH_SEARCH_H_
@@ -0,0 +1,221 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_SORT_PARALLEL_SORT_H_
+#define LIB_SORT_PARALLEL_SORT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+#include "../lib_parallel/thread_pool.h"
+#include "../lib_sort/pdq_sort.h"
+
+// короче этого массивы сортируются в вызывающем потоке
+const size_t kParallelSortMin = 1 << 15;
+
+namespace sort_detail {
+
+// корзин в сортировке выборкой на один поток и их предел (номер
+// корзины хранится в байте)
+const size_t kBucketsPerThread = 8;
+const size_t kMaxBuckets = 256;
+// элементов выборки на одну корзину
+const size_t kOversampling = 16;
+
+// i из [max(0, k - nb), min(k, na)]: первые k элементов устойчивого
+// слияния a и b - это a[0, i) и b[0, k - i); при равенстве первым идёт
+// элемент a
+template <class T, class Less>
+size_t co_rank(size_t k, const T* a, size_t na, const T* b, size_t nb,
+               Less less) {
+    size_t low = k > nb ? k - nb : 0;
+    size_t high = std::min(k, na);
+    while (low < high) {
+        size_t i = low + (high - low) / 2;
+        size_t j = k - i;
+        if (j == 0 || less(b[j - 1], a[i])) {
+            high = i;
+        } else {
+            low = i + 1;
+        }
+    }
+    return low;
+}
+
+// выход [from, to) слияния соседних серий src[begin, middle) и
+// src[middle, end) записывается в dst[begin + from, begin + to)
+template <class T, class Less>
+void merge_piece(T* src, T* dst, size_t begin, size_t middle, size_t end,
+                 size_t from, size_t to, Less less) {
+    const T* a = src + begin;
+    const T* b = src + middle;
+    size_t na = middle - begin;
+    size_t nb = end - middle;
+    size_t a_from = co_rank(from, a, na, b, nb, less);
+    size_t a_to = co_rank(to, a, na, b, nb, less);
+    std::merge(std::make_move_iterator(src + begin + a_from),
+               std::make_move_iterator(src + begin + a_to),
+               std::make_move_iterator(src + middle + (from - a_from)),
+               std::make_move_iterator(src + middle + (to - a_to)),
+               dst + begin + from, less);
+}
+
+}  // namespace sort_detail
+
+// Параллельная сортировка выборкой (sample sort), неустойчивая. По
+// случайной выборке выбираются границы корзин (kBucketsPerThread на
+// поток), затем в три параллельных прохода: номер корзины каждого
+// элемента двоичным спуском по дереву границ и счётчики по блокам,
+// перенос в буфер по префиксным суммам, сортировка корзин pdq_sort и
+// возврат в data. Все элементы переносятся дважды независимо от числа
+// потоков. Равные ключи попадают в одну корзину, поэтому при малом
+// числе различных значений корзины неравны, но pdq_sort разбирает
+// повторы за линейное время. T конструируется по умолчанию (буфер на
+// count элементов)
+template <class T, class Less = std::less<T>>
+void parallel_sort(TThreadPool* pool, T* data, size_t count,
+                   Less less = Less()) {
+    size_t threads = pool->thread_count();
+    if (threads == 1 || count < kParallelSortMin) {
+        pdq_sort(data, count, less);
+        return;
+    }
+    size_t buckets = 2;
+    while (buckets < threads * sort_detail::kBucketsPerThread &&
+           buckets < sort_detail::kMaxBuckets) {
+        buckets *= 2;
+    }
+
+    // границы корзин - в порядке обхода дерева в ширину: узел j, дети
+    // 2j и 2j + 1, номер корзины - лист после спуска
+    std::vector<T> sample;
+    sample.reserve(buckets * sort_detail::kOversampling);
+    std::mt19937_64 gen(count);
+    for (size_t i = 0; i < buckets * sort_detail::kOversampling; i++) {
+        sample.push_back(data[gen() % count]);
+    }
+    pdq_sort(sample.data(), sample.size(), less);
+    std::vector<T> tree(buckets);
+    for (size_t node = 1, level = 1; node < buckets; node++) {
+        if (node == 2 * level) {
+            level = node;
+        }
+        // узел делит пополам корзины своего поддерева
+        size_t span = buckets / level;
+        size_t middle = (node - level) * span + span / 2;
+        tree[node] = sample[middle * sort_detail::kOversampling];
+    }
+
+    size_t blocks = threads * 4;
+    size_t block_size = (count + blocks - 1) / blocks;
+    std::vector<uint8_t> ids(count);
+    std::vector<size_t> offsets(blocks * buckets, 0);
+    pool->parallel_for(0, blocks, 1, [&](size_t lo, size_t hi) {
+        for (size_t block = lo; block < hi; block++) {
+            size_t* counts = &offsets[block * buckets];
+            size_t end = std::min(count, (block + 1) * block_size);
+            for (size_t i = block * block_size; i < end; i++) {
+                size_t node = 1;
+                while (node < buckets) {
+                    node = 2 * node + (less(data[i], tree[node]) ? 0 : 1);
+                }
+                ids[i] = static_cast<uint8_t>(node - buckets);
+                counts[node - buckets]++;
+            }
+        }
+    });
+
+    // начало каждой корзины и место каждого блока внутри неё
+    std::vector<size_t> starts(buckets + 1, 0);
+    size_t sum = 0;
+    for (size_t bucket = 0; bucket < buckets; bucket++) {
+        starts[bucket] = sum;
+        for (size_t block = 0; block < blocks; block++) {
+            size_t bucket_count = offsets[block * buckets + bucket];
+            offsets[block * buckets + bucket] = sum;
+            sum += bucket_count;
+        }
+    }
+    starts[buckets] = count;
+
+    std::vector<T> buffer(count);
+    pool->parallel_for(0, blocks, 1, [&](size_t lo, size_t hi) {
+        for (size_t block = lo; block < hi; block++) {
+            size_t* positions = &offsets[block * buckets];
+            size_t end = std::min(count, (block + 1) * block_size);
+            for (size_t i = block * block_size; i < end; i++) {
+                buffer[positions[ids[i]]++] = std::move(data[i]);
+            }
+        }
+    });
+    pool->parallel_for(0, buckets, 1, [&](size_t lo, size_t hi) {
+        for (size_t bucket = lo; bucket < hi; bucket++) {
+            size_t begin = starts[bucket];
+            size_t size = starts[bucket + 1] - begin;
+            pdq_sort(buffer.data() + begin, size, less);
+            std::move(buffer.begin() + begin, buffer.begin() + begin + size,
+                      data + begin);
+        }
+    });
+}
+
+// Параллельная устойчивая сортировка слиянием. Массив делится на
+// степень двойки серий (не меньше двух на поток), серии сортируются
+// std::stable_sort параллельно, затем сливаются попарно за log2(серий)
+// раундов между data и буфером. Каждый раунд делит выход на куски
+// примерно поровну между потоками независимо от числа пар: границы
+// куска внутри пары находятся двоичным поиском по диагонали слияния
+// (co_rank), так что последний раунд с одной парой тоже параллелен
+template <class T, class Less = std::less<T>>
+void parallel_stable_sort(TThreadPool* pool, T* data, size_t count,
+                          Less less = Less()) {
+    size_t threads = pool->thread_count();
+    if (threads == 1 || count < kParallelSortMin) {
+        std::stable_sort(data, data + count, less);
+        return;
+    }
+    size_t runs = 1;
+    while (runs < threads * 2) {
+        runs *= 2;
+    }
+    size_t width = (count + runs - 1) / runs;
+    pool->parallel_for(0, runs, 1, [&](size_t lo, size_t hi) {
+        for (size_t run = lo; run < hi; run++) {
+            size_t begin = std::min(count, run * width);
+            size_t end = std::min(count, begin + width);
+            std::stable_sort(data + begin, data + end, less);
+        }
+    });
+
+    std::vector<T> buffer(count);
+    T* from = data;
+    T* to = buffer.data();
+    size_t grain = std::max<size_t>(count / (threads * 4), 1 << 12);
+    for (; width < count; width *= 2) {
+        pool->parallel_for(0, count, grain, [&](size_t lo, size_t hi) {
+            // кусок выхода [lo, hi) может задевать несколько пар
+            size_t pair = lo / (2 * width);
+            for (; pair * 2 * width < hi; pair++) {
+                size_t begin = pair * 2 * width;
+                size_t middle = std::min(count, begin + width);
+                size_t end = std::min(count, begin + 2 * width);
+                size_t piece_from = std::max(lo, begin) - begin;
+                size_t piece_to = std::min(hi, end) - begin;
+                sort_detail::merge_piece(from, to, begin, middle, end,
+                                         piece_from, piece_to, less);
+            }
+        });
+        std::swap(from, to);
+    }
+    if (from != data) {
+        pool->parallel_for(0, count, grain, [&](size_t lo, size_t hi) {
+            std::move(from + lo, from + hi, data + lo);
+        });
+    }
+}
+
+#endif  // LIB_SORT_PARALLEL_SORT_H_
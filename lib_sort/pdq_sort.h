@@ -0,0 +1,399 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_SORT_PDQ_SORT_H_
+#define LIB_SORT_PDQ_SORT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace sort_detail {
+
+// короче этого отрезки сортируются вставками
+const size_t kInsertionSortThreshold = 24;
+// длиннее этого опорный элемент - медиана трёх медиан (ninther)
+const size_t kNintherThreshold = 128;
+// сколько перемещений допускает попытка досортировать вставками
+// почти упорядоченный отрезок
+const size_t kPartialInsertionLimit = 8;
+// размер блока смещений в разбиении без ветвлений (BlockQuicksort)
+const size_t kPartitionBlock = 64;
+
+template <class T, class Less>
+void insertion_sort(T* begin, T* end, Less less) {
+    if (begin == end) {
+        return;
+    }
+    for (T* current = begin + 1; current != end; current++) {
+        T* sift = current;
+        if (less(*sift, *(sift - 1))) {
+            T moved(std::move(*sift));
+            do {
+                *sift = std::move(*(sift - 1));
+                sift--;
+            } while (sift != begin && less(moved, *(sift - 1)));
+            *sift = std::move(moved);
+        }
+    }
+}
+
+// то же без проверки левой границы: слева от begin лежит элемент, не
+// больший всех элементов отрезка
+template <class T, class Less>
+void unguarded_insertion_sort(T* begin, T* end, Less less) {
+    if (begin == end) {
+        return;
+    }
+    for (T* current = begin + 1; current != end; current++) {
+        T* sift = current;
+        if (less(*sift, *(sift - 1))) {
+            T moved(std::move(*sift));
+            do {
+                *sift = std::move(*(sift - 1));
+                sift--;
+            } while (less(moved, *(sift - 1)));
+            *sift = std::move(moved);
+        }
+    }
+}
+
+// сортировка вставками, которая сдаётся после kPartialInsertionLimit
+// перемещений; true - отрезок отсортирован
+template <class T, class Less>
+bool partial_insertion_sort(T* begin, T* end, Less less) {
+    if (begin == end) {
+        return true;
+    }
+    size_t moves = 0;
+    for (T* current = begin + 1; current != end; current++) {
+        if (moves > kPartialInsertionLimit) {
+            return false;
+        }
+        T* sift = current;
+        if (less(*sift, *(sift - 1))) {
+            T moved(std::move(*sift));
+            do {
+                *sift = std::move(*(sift - 1));
+                sift--;
+            } while (sift != begin && less(moved, *(sift - 1)));
+            *sift = std::move(moved);
+            moves += static_cast<size_t>(current - sift);
+        }
+    }
+    return true;
+}
+
+template <class T, class Less>
+void sort2(T* a, T* b, Less less) {
+    if (less(*b, *a)) {
+        std::iter_swap(a, b);
+    }
+}
+
+template <class T, class Less>
+void sort3(T* a, T* b, T* c, Less less) {
+    sort2(a, b, less);
+    sort2(b, c, less);
+    sort2(a, b, less);
+}
+
+// Разбиение по опорному *begin: слева элементы меньше опорного, справа
+// не меньше. Возвращает позицию опорного и признак того, что отрезок
+// уже был разбит (ни одного обмена). Справа от begin есть элемент не
+// меньше опорного (его ставит туда выбор медианы), поэтому первый
+// поиск слева не проверяет границу
+template <class T, class Less>
+std::pair<T*, bool> partition_right(T* begin, T* end, Less less) {
+    T pivot(std::move(*begin));
+    T* first = begin;
+    T* last = end;
+    while (less(*++first, pivot)) {
+    }
+    if (first - 1 == begin) {
+        while (first < last && !less(*--last, pivot)) {
+        }
+    } else {
+        while (!less(*--last, pivot)) {
+        }
+    }
+    bool already_partitioned = first >= last;
+    while (first < last) {
+        std::iter_swap(first, last);
+        while (less(*++first, pivot)) {
+        }
+        while (!less(*--last, pivot)) {
+        }
+    }
+    T* pivot_position = first - 1;
+    *begin = std::move(*pivot_position);
+    *pivot_position = std::move(pivot);
+    return std::make_pair(pivot_position, already_partitioned);
+}
+
+// обмен найденных пар «не на своей стороне»: при разном числе кандидатов
+// слева и справа - циклическим сдвигом (одно перемещение на элемент
+// вместо трёх)
+template <class T>
+void swap_offsets(T* first, T* last, const uint8_t* offsets_left,
+                  const uint8_t* offsets_right, size_t count,
+                  bool use_swaps) {
+    if (use_swaps) {
+        for (size_t i = 0; i < count; i++) {
+            std::iter_swap(first + offsets_left[i], last - offsets_right[i]);
+        }
+    } else if (count > 0) {
+        T* left = first + offsets_left[0];
+        T* right = last - offsets_right[0];
+        T moved(std::move(*left));
+        *left = std::move(*right);
+        for (size_t i = 1; i < count; i++) {
+            left = first + offsets_left[i];
+            *right = std::move(*left);
+            right = last - offsets_right[i];
+            *left = std::move(*right);
+        }
+        *right = std::move(moved);
+    }
+}
+
+// то же разбиение без ветвлений по результату сравнения (BlockQuicksort):
+// сравнения блока из kPartitionBlock элементов записывают смещения
+// кандидатов на обмен в буфер, счётчик растёт на результат сравнения.
+// Для дешёвых сравнений (числа со стандартным порядком) непредсказуемые
+// переходы обходятся дороже лишних записей
+template <class T, class Less>
+std::pair<T*, bool> partition_right_branchless(T* begin, T* end,
+                                               Less less) {
+    T pivot(std::move(*begin));
+    T* first = begin;
+    T* last = end;
+    while (less(*++first, pivot)) {
+    }
+    if (first - 1 == begin) {
+        while (first < last && !less(*--last, pivot)) {
+        }
+    } else {
+        while (!less(*--last, pivot)) {
+        }
+    }
+    bool already_partitioned = first >= last;
+    if (!already_partitioned) {
+        std::iter_swap(first, last);
+        first++;
+        alignas(64) uint8_t offsets_left[kPartitionBlock];
+        alignas(64) uint8_t offsets_right[kPartitionBlock];
+        T* base_left = first;
+        T* base_right = last;
+        size_t count_left = 0;
+        size_t count_right = 0;
+        size_t start_left = 0;
+        size_t start_right = 0;
+        while (first < last) {
+            // незаполненный буфер берёт половину оставшихся элементов
+            // (весь остаток, если другой буфер ещё не пуст)
+            size_t unknown = static_cast<size_t>(last - first);
+            size_t split_left = count_left == 0 ?
+                (count_right == 0 ? unknown / 2 : unknown) : 0;
+            size_t split_right = count_right == 0 ? unknown - split_left : 0;
+            size_t block_left = std::min(split_left, kPartitionBlock);
+            for (size_t i = 0; i < block_left; i++) {
+                offsets_left[count_left] = static_cast<uint8_t>(i);
+                count_left += !less(*first, pivot);
+                first++;
+            }
+            size_t block_right = std::min(split_right, kPartitionBlock);
+            for (size_t i = 0; i < block_right;) {
+                offsets_right[count_right] = static_cast<uint8_t>(++i);
+                count_right += less(*--last, pivot);
+            }
+            size_t count = std::min(count_left, count_right);
+            swap_offsets(base_left, base_right, offsets_left + start_left,
+                         offsets_right + start_right, count,
+                         count_left == count_right);
+            count_left -= count;
+            count_right -= count;
+            start_left += count;
+            start_right += count;
+            if (count_left == 0) {
+                start_left = 0;
+                base_left = first;
+            }
+            if (count_right == 0) {
+                start_right = 0;
+                base_right = last;
+            }
+        }
+        // остаток одного буфера переносится к границе
+        if (count_left > 0) {
+            while (count_left-- > 0) {
+                std::iter_swap(base_left + offsets_left[start_left +
+                                                        count_left],
+                               --last);
+            }
+            first = last;
+        }
+        if (count_right > 0) {
+            while (count_right-- > 0) {
+                std::iter_swap(base_right - offsets_right[start_right +
+                                                          count_right],
+                               first);
+                first++;
+            }
+            last = first;
+        }
+    }
+    T* pivot_position = first - 1;
+    *begin = std::move(*pivot_position);
+    *pivot_position = std::move(pivot);
+    return std::make_pair(pivot_position, already_partitioned);
+}
+
+// разбиение, при котором равные опорному уходят влево; вызывается, когда
+// опорный равен элементу слева от отрезка - тогда все равные ему
+// оказываются на месте и дальше не сортируются
+template <class T, class Less>
+T* partition_left(T* begin, T* end, Less less) {
+    T pivot(std::move(*begin));
+    T* first = begin;
+    T* last = end;
+    while (less(pivot, *--last)) {
+    }
+    if (last + 1 == end) {
+        while (first < last && !less(pivot, *++first)) {
+        }
+    } else {
+        while (!less(pivot, *++first)) {
+        }
+    }
+    while (first < last) {
+        std::iter_swap(first, last);
+        while (less(pivot, *--last)) {
+        }
+        while (!less(pivot, *++first)) {
+        }
+    }
+    T* pivot_position = last;
+    *begin = std::move(*pivot_position);
+    *pivot_position = std::move(pivot);
+    return pivot_position;
+}
+
+template <bool Branchless, class T, class Less>
+void pdq_sort_loop(T* begin, T* end, Less less, int bad_allowed,
+                   bool leftmost) {
+    while (true) {
+        size_t size = static_cast<size_t>(end - begin);
+        if (size < kInsertionSortThreshold) {
+            if (leftmost) {
+                insertion_sort(begin, end, less);
+            } else {
+                unguarded_insertion_sort(begin, end, less);
+            }
+            return;
+        }
+
+        // опорный ставится в begin
+        size_t half = size / 2;
+        if (size > kNintherThreshold) {
+            sort3(begin, begin + half, end - 1, less);
+            sort3(begin + 1, begin + (half - 1), end - 2, less);
+            sort3(begin + 2, begin + (half + 1), end - 3, less);
+            sort3(begin + (half - 1), begin + half, begin + (half + 1), less);
+            std::iter_swap(begin, begin + half);
+        } else {
+            sort3(begin + half, begin, end - 1, less);
+        }
+
+        // опорный равен элементу слева: все равные ему - на своих местах
+        if (!leftmost && !less(*(begin - 1), *begin)) {
+            begin = partition_left(begin, end, less) + 1;
+            continue;
+        }
+
+        std::pair<T*, bool> result =
+            Branchless ? partition_right_branchless(begin, end, less)
+                       : partition_right(begin, end, less);
+        T* pivot = result.first;
+        size_t left_size = static_cast<size_t>(pivot - begin);
+        size_t right_size = static_cast<size_t>(end - (pivot + 1));
+
+        if (left_size < size / 8 || right_size < size / 8) {
+            // плохое разбиение: после log2(n) таких - пирамидальная
+            // сортировка, иначе перестановка элементов ломает шаблон,
+            // на который попал выбор опорного
+            if (--bad_allowed == 0) {
+                std::make_heap(begin, end, less);
+                std::sort_heap(begin, end, less);
+                return;
+            }
+            if (left_size >= kInsertionSortThreshold) {
+                std::iter_swap(begin, begin + left_size / 4);
+                std::iter_swap(pivot - 1, pivot - left_size / 4);
+                if (left_size > kNintherThreshold) {
+                    std::iter_swap(begin + 1, begin + (left_size / 4 + 1));
+                    std::iter_swap(begin + 2, begin + (left_size / 4 + 2));
+                    std::iter_swap(pivot - 2, pivot - (left_size / 4 + 1));
+                    std::iter_swap(pivot - 3, pivot - (left_size / 4 + 2));
+                }
+            }
+            if (right_size >= kInsertionSortThreshold) {
+                std::iter_swap(pivot + 1, pivot + (1 + right_size / 4));
+                std::iter_swap(end - 1, end - right_size / 4);
+                if (right_size > kNintherThreshold) {
+                    std::iter_swap(pivot + 2, pivot + (2 + right_size / 4));
+                    std::iter_swap(pivot + 3, pivot + (3 + right_size / 4));
+                    std::iter_swap(end - 2, end - (1 + right_size / 4));
+                    std::iter_swap(end - 3, end - (2 + right_size / 4));
+                }
+            }
+        } else if (result.second &&
+                   partial_insertion_sort(begin, pivot, less) &&
+                   partial_insertion_sort(pivot + 1, end, less)) {
+            // уже разбитый отрезок почти отсортирован - досортирован
+            // вставками
+            return;
+        }
+
+        // левая часть - рекурсивно, правая - в этом же цикле
+        pdq_sort_loop<Branchless>(begin, pivot, less, bad_allowed, leftmost);
+        begin = pivot + 1;
+        leftmost = false;
+    }
+}
+
+template <class T, class Less>
+struct TIsDefaultOrder : std::integral_constant<bool,
+    std::is_arithmetic<T>::value &&
+    (std::is_same<Less, std::less<T>>::value ||
+     std::is_same<Less, std::greater<T>>::value)> {};
+
+}  // namespace sort_detail
+
+// Неустойчивая сортировка pattern-defeating quicksort (pdqsort):
+// быстрая сортировка с медианой трёх (или трёх медиан) в качестве
+// опорного, сортировкой вставками коротких отрезков и тремя защитами
+// от неудачных входов: отрезок, который уже был разбит, досортировывается
+// вставками (сортированные и почти сортированные входы - за O(n));
+// равные опорному, совпадающему с элементом слева, отделяются за один
+// проход (много повторов - O(n k) для k различных значений); несбалансированное
+// разбиение ломает шаблон перестановкой, а после log2(n) таких разбиений
+// отрезок досортировывается пирамидой (худший случай O(n log n)). Для
+// чисел со стандартным порядком (std::less, std::greater) разбиение
+// выполняется без ветвлений
+template <class T, class Less = std::less<T>>
+void pdq_sort(T* data, size_t count, Less less = Less()) {
+    if (count < 2) {
+        return;
+    }
+    int bad_allowed = 0;
+    for (size_t n = count; n > 1; n >>= 1) {
+        bad_allowed++;
+    }
+    sort_detail::pdq_sort_loop<sort_detail::TIsDefaultOrder<T, Less>::value>(
+        data, data + count, less, bad_allowed, true);
+}
+
+#endif  // LIB_SORT_PDQ_SORT_H_
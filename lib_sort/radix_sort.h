@@ -0,0 +1,191 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_SORT_RADIX_SORT_H_
+#define LIB_SORT_RADIX_SORT_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// до стольких элементов radix_sort сортирует вставками: на коротком
+// массиве гистограммы и буфер дороже самой сортировки
+const size_t kRadixSmallSort = 64;
+// с какого объёма массива (в байтах) radix_sort переносит элементы
+// через буфер строк кэша; пока массив в кэше, прямая запись быстрее
+const size_t kRadixBufferedBytes = 1 << 20;
+
+namespace sort_detail {
+
+// отображение ключа в беззнаковое целое того же размера с тем же
+// порядком: у знаковых целых инвертируется старший бит, у чисел с
+// плавающей точкой - старший бит у положительных и все биты у
+// отрицательных. -0.0 идёт перед +0.0, NaN со знаком минус - перед
+// всеми числами, без знака - после всех
+template <class Key, class Enable = void>
+struct TRadixTraits;
+
+template <class Key>
+struct TRadixTraits<Key, typename std::enable_if<
+                             std::is_integral<Key>::value &&
+                             !std::is_same<Key, bool>::value>::type> {
+    using Bits = typename std::make_unsigned<Key>::type;
+
+    static Bits encode(Key key) noexcept {
+        const Bits kSign = std::is_signed<Key>::value ?
+                           Bits(Bits(1) << (sizeof(Bits) * 8 - 1)) : 0;
+        return static_cast<Bits>(static_cast<Bits>(key) ^ kSign);
+    }
+};
+
+template <class Key>
+struct TRadixTraits<Key, typename std::enable_if<
+                             std::is_floating_point<Key>::value>::type> {
+    static_assert(sizeof(Key) == 4 || sizeof(Key) == 8,
+                  "only float and double keys are supported");
+    using Bits = typename std::conditional<sizeof(Key) == 4, uint32_t,
+                                           uint64_t>::type;
+
+    static Bits encode(Key key) noexcept {
+        const Bits kSign = Bits(1) << (sizeof(Bits) * 8 - 1);
+        Bits bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        return bits & kSign ? static_cast<Bits>(~bits) : bits | kSign;
+    }
+};
+
+// перенос элементов from в корзины to по байту ключа
+template <class Traits, class T, class KeyFn>
+void scatter(T* from, T* to, size_t count, size_t* offsets, size_t shift,
+             KeyFn key, std::false_type /* buffered */) {
+    for (size_t i = 0; i < count; i++) {
+        size_t bucket = (Traits::encode(key(from[i])) >> shift) & 0xFF;
+        to[offsets[bucket]++] = std::move(from[i]);
+    }
+}
+
+// то же для тривиально копируемых элементов: они идут через буфер из
+// строки кэша на корзину, и в to пишутся целые строки. При прямой
+// записи 256 потоков записи идут одновременно; если начала корзин
+// совпадают по модулю размера страницы (ключи 0 .. n - 1 при n -
+// степени двойки), потоки вытесняют друг друга из одних наборов кэша:
+// на таком входе буфер ускоряет проход вдвое
+template <class Traits, class T, class KeyFn>
+void scatter(T* from, T* to, size_t count, size_t* offsets, size_t shift,
+             KeyFn key, std::true_type /* buffered */) {
+    if (count * sizeof(T) < kRadixBufferedBytes) {
+        scatter<Traits>(from, to, count, offsets, shift, key,
+                        std::false_type());
+        return;
+    }
+    const size_t kLine = 64 / sizeof(T);
+    alignas(64) unsigned char staging[256 * kLine * sizeof(T)];
+    uint8_t filled[256] = {};
+    for (size_t i = 0; i < count; i++) {
+        size_t bucket = (Traits::encode(key(from[i])) >> shift) & 0xFF;
+        unsigned char* line = staging + bucket * kLine * sizeof(T);
+        std::memcpy(line + filled[bucket] * sizeof(T), from + i, sizeof(T));
+        if (++filled[bucket] == kLine) {
+            std::memcpy(to + offsets[bucket], line, kLine * sizeof(T));
+            offsets[bucket] += kLine;
+            filled[bucket] = 0;
+        }
+    }
+    for (size_t bucket = 0; bucket < 256; bucket++) {
+        std::memcpy(to + offsets[bucket], staging + bucket * kLine * sizeof(T),
+                    filled[bucket] * sizeof(T));
+        offsets[bucket] += filled[bucket];
+    }
+}
+
+}  // namespace sort_detail
+
+// Устойчивая поразрядная сортировка LSD по байтам ключа key(element).
+// Ключ - целое или float/double, порядок - естественный. Гистограммы
+// всех байтов считаются за один проход по данным; байт, у которого все
+// элементы попали в одну корзину (например, старшие байты небольших
+// чисел), пропускается без перестановки. Каждый выполненный проход
+// переносит элементы между data и буфером из count элементов, поэтому T
+// должен конструироваться по умолчанию и перемещаться; key вызывается
+// повторно на каждом проходе и должен быть дешёвым. Возвращает число
+// выполненных проходов перестановки (0 - массив короче kRadixSmallSort
+// или уже различается только в пропущенных байтах)
+template <class T, class KeyFn>
+size_t radix_sort(T* data, size_t count, KeyFn key) {
+    using Key = typename std::decay<decltype(key(*data))>::type;
+    using Traits = sort_detail::TRadixTraits<Key>;
+    using Bits = typename Traits::Bits;
+    const size_t kDigits = sizeof(Bits);
+    // элементы до 32 байт без нетривиального копирования переносятся
+    // через буфер строк кэша (sort_detail::scatter)
+    constexpr bool kBuffered =
+        std::is_trivially_copyable<T>::value && sizeof(T) <= 32;
+
+    if (count < kRadixSmallSort) {
+        for (size_t i = 1; i < count; i++) {
+            Bits bits = Traits::encode(key(data[i]));
+            size_t j = i;
+            if (bits < Traits::encode(key(data[j - 1]))) {
+                T moved(std::move(data[i]));
+                do {
+                    data[j] = std::move(data[j - 1]);
+                    j--;
+                } while (j > 0 && bits < Traits::encode(key(data[j - 1])));
+                data[j] = std::move(moved);
+            }
+        }
+        return 0;
+    }
+
+    std::array<std::array<size_t, 256>, kDigits> histograms{};
+    for (size_t i = 0; i < count; i++) {
+        Bits bits = Traits::encode(key(data[i]));
+        for (size_t digit = 0; digit < kDigits; digit++) {
+            histograms[digit][(bits >> (digit * 8)) & 0xFF]++;
+        }
+    }
+
+    std::vector<T> buffer;
+    T* from = data;
+    T* to = nullptr;
+    size_t passes = 0;
+    for (size_t digit = 0; digit < kDigits; digit++) {
+        std::array<size_t, 256>& offsets = histograms[digit];
+        size_t shift = digit * 8;
+        Bits first = Traits::encode(key(from[0]));
+        if (offsets[(first >> shift) & 0xFF] == count) {
+            continue;
+        }
+        if (to == nullptr) {
+            buffer.resize(count);
+            to = buffer.data();
+        }
+        size_t sum = 0;
+        for (size_t& offset : offsets) {
+            size_t bucket = offset;
+            offset = sum;
+            sum += bucket;
+        }
+        sort_detail::scatter<Traits>(
+            from, to, count, offsets.data(), shift, key,
+            std::integral_constant<bool, kBuffered>());
+        std::swap(from, to);
+        passes++;
+    }
+    if (from != data) {
+        std::move(from, from + count, data);
+    }
+    return passes;
+}
+
+// сортировка самих целых чисел или чисел с плавающей точкой
+template <class T>
+size_t radix_sort(T* data, size_t count) {
+    return radix_sort(data, count, [](const T& value) { return value; });
+}
+
+#endif  // LIB_SORT_RADIX_SORT_H_
@@ -0,0 +1,5 @@
+// Copyright 2024 Marina Usova
+
+#include "../lib_sort/parallel_sort.h"
+#include "../lib_sort/pdq_sort.h"
+#include "../lib_sort/radix_sort.h"
@@ -0,0 +1,29 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include "../lib_sparse/parallel_spmv.h"
+
+std::vector<size_t> partition_rows(const size_t* row_offsets, size_t rows,
+                                   size_t parts) {
+    parts = std::max<size_t>(parts, 1);
+    std::vector<size_t> bounds(parts + 1, rows);
+    bounds[0] = 0;
+    // суммарный вес строк [0, i) равен row_offsets[i] + i и возрастает
+    // по i, поэтому границу каждой части находим двоичным поиском
+    double total = static_cast<double>(row_offsets[rows] + rows);
+    for (size_t k = 1; k < parts; k++) {
+        double target = total * k / parts;
+        size_t lo = bounds[k - 1];
+        size_t hi = rows;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (static_cast<double>(row_offsets[mid] + mid) < target) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        bounds[k] = lo;
+    }
+    return bounds;
+}
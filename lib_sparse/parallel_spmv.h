@@ -0,0 +1,56 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_SPARSE_PARALLEL_SPMV_H_
+#define LIB_SPARSE_PARALLEL_SPMV_H_
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "../lib_parallel/thread_pool.h"
+#include "../lib_sparse/sparse_matrix.h"
+
+// делит строки CSR-матрицы на parts непрерывных диапазонов с примерно
+// равной работой: вес строки - число её ненулевых плюс один (пустые
+// строки тоже стоят записи в y). row_offsets - массив из rows + 1
+// смещений. Возвращает parts + 1 границ: часть k - строки
+// [bounds[k], bounds[k + 1]); части могут быть пустыми.
+std::vector<size_t> partition_rows(const size_t* row_offsets, size_t rows,
+                                   size_t parts);
+
+// многопоточное y = a * x. Деление по числу строк на матрицах со
+// степенным распределением отдаёт одному потоку строки-«хабы» со
+// львиной долей ненулевых, поэтому строки делятся по partition_rows()
+// на несколько частей на поток, а неравномерность остатка сглаживает
+// кража работы в пуле
+template <class T>
+void parallel_multiply(TThreadPool* pool, const TCsrMatrix<T>& a,
+                       const T* x, T* y) {
+    const size_t kPartsPerThread = 4;
+    std::vector<size_t> bounds = partition_rows(
+        a.row_offsets(), a.rows(), pool->thread_count() * kPartsPerThread);
+    const size_t* offsets = a.row_offsets();
+    const SparseIndex* cols = a.col_indices();
+    const T* values = a.values();
+    pool->parallel_for(0, bounds.size() - 1, 1, [&](size_t lo, size_t hi) {
+        for (size_t i = bounds[lo]; i < bounds[hi]; i++) {
+            T sum = T(0);
+            for (size_t p = offsets[i]; p < offsets[i + 1]; p++) {
+                sum += values[p] * x[cols[p]];
+            }
+            y[i] = sum;
+        }
+    });
+}
+
+template <class T>
+std::vector<T> parallel_multiply(TThreadPool* pool, const TCsrMatrix<T>& a,
+                                 const std::vector<T>& x) {
+    if (x.size() != a.cols()) {
+        throw std::invalid_argument("multiply: vector size differs");
+    }
+    std::vector<T> y(a.rows());
+    parallel_multiply(pool, a, x.data(), y.data());
+    return y;
+}
+
+#endif  // LIB_SPARSE_PARALLEL_SPMV_H_
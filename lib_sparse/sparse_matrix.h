@@ -0,0 +1,362 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_SPARSE_SPARSE_MATRIX_H_
+#define LIB_SPARSE_SPARSE_MATRIX_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../lib_matrix/matrix.h"
+
+// индексы строк и столбцов внутри разреженных форматов: 32 бита вдвое
+// экономят память по сравнению с size_t, смещения по ненулевым - size_t
+using SparseIndex = uint32_t;
+
+template <class T>
+class TCsrMatrix;
+template <class T>
+class TCscMatrix;
+
+// Построитель разреженной матрицы в координатном формате (COO): тройки
+// (строка, столбец, значение) в любом порядке, повторы допускаются и при
+// преобразовании в CSR/CSC складываются.
+template <class T>
+class TCooMatrix {
+ public:
+    struct TEntry {
+        SparseIndex row;
+        SparseIndex col;
+        T value;
+    };
+
+    TCooMatrix(size_t rows, size_t cols) : rows_(rows), cols_(cols) {
+        const size_t kMaxIndex = std::numeric_limits<SparseIndex>::max();
+        if (rows > kMaxIndex || cols > kMaxIndex) {
+            throw std::invalid_argument("TCooMatrix: matrix is too large");
+        }
+    }
+
+    size_t rows() const noexcept { return rows_; }
+    size_t cols() const noexcept { return cols_; }
+    size_t entries() const noexcept { return entries_.size(); }
+    const std::vector<TEntry>& data() const noexcept { return entries_; }
+
+    void reserve(size_t count) { entries_.reserve(count); }
+
+    void add(size_t row, size_t col, T value) {
+        if (row >= rows_ || col >= cols_) {
+            throw std::out_of_range("TCooMatrix: index is out of range");
+        }
+        entries_.push_back({ static_cast<SparseIndex>(row),
+                             static_cast<SparseIndex>(col), value });
+    }
+
+    TCsrMatrix<T> to_csr() const { return TCsrMatrix<T>(*this); }
+    TCscMatrix<T> to_csc() const { return TCscMatrix<T>(*this); }
+
+ private:
+    size_t rows_;
+    size_t cols_;
+    std::vector<TEntry> entries_;
+};
+
+namespace sparse_detail {
+
+// Сжатое хранение по «старшему» измерению: для CSR это строки, для CSC -
+// столбцы. Элементы старшей позиции i лежат в [offsets[i], offsets[i+1]),
+// внутри неё индексы младшего измерения возрастают и не повторяются.
+template <class T>
+struct TCompressed {
+    std::vector<size_t> offsets;
+    std::vector<SparseIndex> indices;
+    std::vector<T> values;
+
+    // сортировка подсчётом по старшему индексу, затем упорядочивание и
+    // сложение повторов внутри каждой позиции
+    template <class Entry, class Major, class Minor>
+    void build(size_t major_size, const std::vector<Entry>& entries,
+               Major major, Minor minor) {
+        offsets.assign(major_size + 1, 0);
+        for (const Entry& entry : entries) {
+            offsets[major(entry) + 1]++;
+        }
+        for (size_t i = 0; i < major_size; i++) {
+            offsets[i + 1] += offsets[i];
+        }
+        std::vector<std::pair<SparseIndex, T>> sorted(entries.size());
+        std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+        for (const Entry& entry : entries) {
+            sorted[next[major(entry)]++] = { minor(entry), entry.value };
+        }
+        indices.clear();
+        values.clear();
+        indices.reserve(entries.size());
+        values.reserve(entries.size());
+        size_t begin = 0;
+        for (size_t i = 0; i < major_size; i++) {
+            size_t end = offsets[i + 1];
+            std::sort(sorted.begin() + begin, sorted.begin() + end,
+                      [](const std::pair<SparseIndex, T>& left,
+                         const std::pair<SparseIndex, T>& right) {
+                          return left.first < right.first;
+                      });
+            offsets[i] = indices.size();
+            for (size_t p = begin; p < end; p++) {
+                if (p > begin && sorted[p].first == indices.back()) {
+                    values.back() += sorted[p].second;
+                } else {
+                    indices.push_back(sorted[p].first);
+                    values.push_back(sorted[p].second);
+                }
+            }
+            begin = end;
+        }
+        offsets[major_size] = indices.size();
+    }
+
+    // транспонирование сжатого хранения за O(nnz + размеры): результат
+    // сжат по бывшему младшему измерению, порядок индексов сохраняется
+    TCompressed transposed(size_t major_size, size_t minor_size) const {
+        TCompressed result;
+        result.offsets.assign(minor_size + 1, 0);
+        for (SparseIndex index : indices) {
+            result.offsets[index + 1]++;
+        }
+        for (size_t j = 0; j < minor_size; j++) {
+            result.offsets[j + 1] += result.offsets[j];
+        }
+        result.indices.resize(indices.size());
+        result.values.resize(values.size());
+        std::vector<size_t> next(result.offsets.begin(),
+                                 result.offsets.end() - 1);
+        for (size_t i = 0; i < major_size; i++) {
+            for (size_t p = offsets[i]; p < offsets[i + 1]; p++) {
+                size_t q = next[indices[p]]++;
+                result.indices[q] = static_cast<SparseIndex>(i);
+                result.values[q] = values[p];
+            }
+        }
+        return result;
+    }
+
+    // значение элемента (major, minor) или ноль
+    T get(size_t major, size_t minor) const {
+        auto first = indices.begin() + offsets[major];
+        auto last = indices.begin() + offsets[major + 1];
+        auto it = std::lower_bound(first, last, minor);
+        return it != last && *it == minor ? values[it - indices.begin()]
+                                          : T(0);
+    }
+
+    size_t memory_bytes() const noexcept {
+        return offsets.capacity() * sizeof(size_t) +
+               indices.capacity() * sizeof(SparseIndex) +
+               values.capacity() * sizeof(T);
+    }
+};
+
+}  // namespace sparse_detail
+
+// Разреженная матрица в формате CSR (сжатые строки): удобна для умножения
+// на вектор и построчного обхода.
+template <class T>
+class TCsrMatrix {
+ public:
+    TCsrMatrix() : rows_(0), cols_(0) { storage_.offsets.assign(1, 0); }
+
+    explicit TCsrMatrix(const TCooMatrix<T>& coo)
+        : rows_(coo.rows()), cols_(coo.cols()) {
+        using TEntry = typename TCooMatrix<T>::TEntry;
+        storage_.build(rows_, coo.data(),
+                       [](const TEntry& entry) { return entry.row; },
+                       [](const TEntry& entry) { return entry.col; });
+    }
+
+    size_t rows() const noexcept { return rows_; }
+    size_t cols() const noexcept { return cols_; }
+    size_t nonzeros() const noexcept { return storage_.values.size(); }
+
+    // элементы строки i: col_indices()[p], values()[p] для p из
+    // [row_offsets()[i], row_offsets()[i + 1])
+    const size_t* row_offsets() const noexcept {
+        return storage_.offsets.data();
+    }
+    const SparseIndex* col_indices() const noexcept {
+        return storage_.indices.data();
+    }
+    const T* values() const noexcept { return storage_.values.data(); }
+
+    T get(size_t row, size_t col) const {
+        if (row >= rows_ || col >= cols_) {
+            throw std::out_of_range("TCsrMatrix: index is out of range");
+        }
+        return storage_.get(row, col);
+    }
+
+    TCscMatrix<T> to_csc() const {
+        return TCscMatrix<T>(rows_, cols_,
+                             storage_.transposed(rows_, cols_));
+    }
+
+    TMatrix<T> to_dense() const {
+        TMatrix<T> result(rows_, cols_);
+        for (size_t i = 0; i < rows_; i++) {
+            for (size_t p = storage_.offsets[i];
+                 p < storage_.offsets[i + 1]; p++) {
+                result(i, storage_.indices[p]) = storage_.values[p];
+            }
+        }
+        return result;
+    }
+
+    // память под массивы формата
+    size_t memory_bytes() const noexcept { return storage_.memory_bytes(); }
+
+ private:
+    friend class TCscMatrix<T>;
+
+    TCsrMatrix(size_t rows, size_t cols,
+               sparse_detail::TCompressed<T>&& storage)
+        : rows_(rows), cols_(cols), storage_(std::move(storage)) {}
+
+    size_t rows_;
+    size_t cols_;
+    sparse_detail::TCompressed<T> storage_;
+};
+
+// Разреженная матрица в формате CSC (сжатые столбцы): удобна для обхода
+// по столбцам и умножения транспонированной матрицы.
+template <class T>
+class TCscMatrix {
+ public:
+    TCscMatrix() : rows_(0), cols_(0) { storage_.offsets.assign(1, 0); }
+
+    explicit TCscMatrix(const TCooMatrix<T>& coo)
+        : rows_(coo.rows()), cols_(coo.cols()) {
+        using TEntry = typename TCooMatrix<T>::TEntry;
+        storage_.build(cols_, coo.data(),
+                       [](const TEntry& entry) { return entry.col; },
+                       [](const TEntry& entry) { return entry.row; });
+    }
+
+    size_t rows() const noexcept { return rows_; }
+    size_t cols() const noexcept { return cols_; }
+    size_t nonzeros() const noexcept { return storage_.values.size(); }
+
+    // элементы столбца j: row_indices()[p], values()[p] для p из
+    // [col_offsets()[j], col_offsets()[j + 1])
+    const size_t* col_offsets() const noexcept {
+        return storage_.offsets.data();
+    }
+    const SparseIndex* row_indices() const noexcept {
+        return storage_.indices.data();
+    }
+    const T* values() const noexcept { return storage_.values.data(); }
+
+    T get(size_t row, size_t col) const {
+        if (row >= rows_ || col >= cols_) {
+            throw std::out_of_range("TCscMatrix: index is out of range");
+        }
+        return storage_.get(col, row);
+    }
+
+    TCsrMatrix<T> to_csr() const {
+        return TCsrMatrix<T>(rows_, cols_,
+                             storage_.transposed(cols_, rows_));
+    }
+
+    size_t memory_bytes() const noexcept { return storage_.memory_bytes(); }
+
+ private:
+    friend class TCsrMatrix<T>;
+
+    TCscMatrix(size_t rows, size_t cols,
+               sparse_detail::TCompressed<T>&& storage)
+        : rows_(rows), cols_(cols), storage_(std::move(storage)) {}
+
+    size_t rows_;
+    size_t cols_;
+    sparse_detail::TCompressed<T> storage_;
+};
+
+// y = a * x; x - вектор длины a.cols(), y - длины a.rows()
+template <class T>
+void multiply(const TCsrMatrix<T>& a, const T* x, T* y) {
+    const size_t* offsets = a.row_offsets();
+    const SparseIndex* cols = a.col_indices();
+    const T* values = a.values();
+    for (size_t i = 0; i < a.rows(); i++) {
+        T sum = T(0);
+        for (size_t p = offsets[i]; p < offsets[i + 1]; p++) {
+            sum += values[p] * x[cols[p]];
+        }
+        y[i] = sum;
+    }
+}
+
+// y = a * x для CSC: столбец j, умноженный на x[j], прибавляется к y
+template <class T>
+void multiply(const TCscMatrix<T>& a, const T* x, T* y) {
+    const size_t* offsets = a.col_offsets();
+    const SparseIndex* rows = a.row_indices();
+    const T* values = a.values();
+    std::fill(y, y + a.rows(), T(0));
+    for (size_t j = 0; j < a.cols(); j++) {
+        T x_j = x[j];
+        for (size_t p = offsets[j]; p < offsets[j + 1]; p++) {
+            y[rows[p]] += values[p] * x_j;
+        }
+    }
+}
+
+namespace sparse_detail {
+
+template <class Matrix, class T>
+std::vector<T> multiply_vector(const Matrix& a, const std::vector<T>& x) {
+    if (x.size() != a.cols()) {
+        throw std::invalid_argument("multiply: vector size differs");
+    }
+    std::vector<T> y(a.rows());
+    multiply(a, x.data(), y.data());
+    return y;
+}
+
+}  // namespace sparse_detail
+
+template <class T>
+std::vector<T> multiply(const TCsrMatrix<T>& a, const std::vector<T>& x) {
+    return sparse_detail::multiply_vector(a, x);
+}
+
+template <class T>
+std::vector<T> multiply(const TCscMatrix<T>& a, const std::vector<T>& x) {
+    return sparse_detail::multiply_vector(a, x);
+}
+
+// произведение разреженной и плотной матриц: строка i результата -
+// сумма строк b с весами из строки i матрицы a
+template <class T>
+TMatrix<T> multiply(const TCsrMatrix<T>& a, const TMatrix<T>& b) {
+    if (a.cols() != b.rows()) {
+        throw std::invalid_argument("multiply: inner dimensions differ");
+    }
+    TMatrix<T> c(a.rows(), b.cols());
+    const size_t* offsets = a.row_offsets();
+    for (size_t i = 0; i < a.rows(); i++) {
+        T* c_row = c.row(i);
+        for (size_t p = offsets[i]; p < offsets[i + 1]; p++) {
+            T a_ip = a.values()[p];
+            const T* b_row = b.row(a.col_indices()[p]);
+            for (size_t j = 0; j < b.cols(); j++) {
+                c_row[j] += a_ip * b_row[j];
+            }
+        }
+    }
+    return c;
+}
+
+#endif  // LIB_SPARSE_SPARSE_MATRIX_H_
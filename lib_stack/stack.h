@@ -0,0 +1,72 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_STACK_STACK_H_
+#define LIB_STACK_STACK_H_
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include "../lib_deque/chunked_deque.h"
+
+// Стек поверх блочной очереди TChunkedDeque: рост не копирует уже
+// лежащие элементы (в отличие от стека на векторе), ссылки на них
+// остаются действительными, а блоки, освобождённые при снятии элементов,
+// переиспользуются. Обращение к вершине пустого стека бросает
+// std::out_of_range.
+template <class T, class Container = TChunkedDeque<T>>
+class TStack {
+ public:
+    using value_type = T;
+    using container_type = Container;
+
+    TStack() = default;
+    explicit TStack(Container container) : items_(std::move(container)) {}
+
+    size_t size() const noexcept { return items_.size(); }
+    bool empty() const noexcept { return items_.empty(); }
+
+    T& top() {
+        check_not_empty();
+        return items_.back();
+    }
+    const T& top() const {
+        check_not_empty();
+        return items_.back();
+    }
+
+    void push(const T& value) { items_.push_back(value); }
+    void push(T&& value) { items_.push_back(std::move(value)); }
+
+    template <class... Args>
+    T& emplace(Args&&... args) {
+        return items_.emplace_back(std::forward<Args>(args)...);
+    }
+
+    void pop() {
+        check_not_empty();
+        items_.pop_back();
+    }
+
+    // снимает вершину и возвращает её значение
+    T take() {
+        check_not_empty();
+        T value(std::move(items_.back()));
+        items_.pop_back();
+        return value;
+    }
+
+    void clear() noexcept { items_.clear(); }
+
+    const Container& container() const noexcept { return items_; }
+
+ private:
+    void check_not_empty() const {
+        if (items_.empty()) {
+            throw std::out_of_range("TStack: stack is empty");
+        }
+    }
+
+    Container items_;
+};
+
+#endif  // LIB_STACK_STACK_H_
@@ -0,0 +1,164 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../lib_strings/aho_corasick.h"
+
+namespace {
+
+// коды байтов в двойном массиве - 1 .. 256, поэтому ячейка ребёнка
+// никогда не совпадает с ячейкой 0 (корнем)
+const int32_t kAlphabet = 256;
+
+struct TTrieNode {
+    // (код, узел) по возрастанию кода
+    std::vector<std::pair<int32_t, uint32_t>> children;
+    std::vector<uint32_t> patterns;
+};
+
+}  // namespace
+
+TAhoCorasick::TAhoCorasick(const std::vector<std::string>& patterns)
+    : state_count_(0) {
+    std::vector<TTrieNode> trie(1);
+    for (size_t index = 0; index < patterns.size(); index++) {
+        const std::string& pattern = patterns[index];
+        if (pattern.empty()) {
+            throw std::invalid_argument("TAhoCorasick: empty pattern");
+        }
+        uint32_t node = 0;
+        for (char symbol : pattern) {
+            int32_t code = static_cast<unsigned char>(symbol) + 1;
+            std::vector<std::pair<int32_t, uint32_t>>& children =
+                trie[node].children;
+            auto it = std::lower_bound(
+                children.begin(), children.end(), code,
+                [](const std::pair<int32_t, uint32_t>& child, int32_t key) {
+                    return child.first < key;
+                });
+            if (it == children.end() || it->first != code) {
+                if (trie.size() >= INT32_MAX / 2) {
+                    throw std::length_error("TAhoCorasick: too many states");
+                }
+                it = children.insert(
+                    it, std::make_pair(code,
+                                       static_cast<uint32_t>(trie.size())));
+                trie.emplace_back();
+            }
+            node = it->second;
+        }
+        trie[node].patterns.push_back(static_cast<uint32_t>(index));
+        lengths_.push_back(pattern.size());
+    }
+    state_count_ = trie.size();
+
+    // раскладка бора в двойной массив обходом в ширину: базе узла
+    // достаётся первое значение, при котором ячейки всех его детей
+    // свободны
+    std::vector<int32_t> cell_of(trie.size(), 0);
+    cells_.assign(kAlphabet + 1, TCell{0, -1});
+    std::vector<uint32_t> order(1, 0);
+    size_t first_free = 1;
+    for (size_t head = 0; head < order.size(); head++) {
+        uint32_t node = order[head];
+        const std::vector<std::pair<int32_t, uint32_t>>& children =
+            trie[node].children;
+        if (children.empty()) {
+            continue;
+        }
+        while (first_free < cells_.size() && cells_[first_free].check != -1) {
+            first_free++;
+        }
+        int32_t base = std::max<int32_t>(
+            0, static_cast<int32_t>(first_free) - children[0].first);
+        for (;; base++) {
+            size_t needed = static_cast<size_t>(base + kAlphabet + 1);
+            if (cells_.size() < needed) {
+                cells_.resize(needed, TCell{0, -1});
+            }
+            bool fits = true;
+            for (const auto& child : children) {
+                if (cells_[base + child.first].check != -1) {
+                    fits = false;
+                    break;
+                }
+            }
+            if (fits) {
+                break;
+            }
+        }
+        int32_t cell = cell_of[node];
+        cells_[cell].base = base;
+        for (const auto& child : children) {
+            cells_[base + child.first].check = cell;
+            cell_of[child.second] = base + child.first;
+            order.push_back(child.second);
+        }
+    }
+
+    // суффиксные и выходные ссылки в том же порядке: ссылки более
+    // мелких узлов уже известны
+    size_t size = cells_.size();
+    fail_.assign(size, 0);
+    report_.assign(size, -1);
+    for (uint32_t node : order) {
+        int32_t cell = cell_of[node];
+        if (node != 0) {
+            report_[cell] = trie[node].patterns.empty() ?
+                            report_[fail_[cell]] : cell;
+        }
+        for (const auto& child : trie[node].children) {
+            int32_t target = cell_of[child.second];
+            int32_t link = 0;
+            if (node != 0) {
+                for (int32_t state = fail_[cell];; state = fail_[state]) {
+                    int32_t next = cells_[state].base + child.first;
+                    if (cells_[next].check == state) {
+                        link = next;
+                        break;
+                    }
+                    if (state == 0) {
+                        break;
+                    }
+                }
+            }
+            fail_[target] = link;
+        }
+    }
+
+    output_begin_.assign(size + 1, 0);
+    for (size_t node = 0; node < trie.size(); node++) {
+        output_begin_[cell_of[node] + 1] =
+            static_cast<uint32_t>(trie[node].patterns.size());
+    }
+    for (size_t cell = 0; cell < size; cell++) {
+        output_begin_[cell + 1] += output_begin_[cell];
+    }
+    outputs_.resize(output_begin_[size]);
+    for (size_t node = 0; node < trie.size(); node++) {
+        std::copy(trie[node].patterns.begin(), trie[node].patterns.end(),
+                  outputs_.begin() + output_begin_[cell_of[node]]);
+    }
+}
+
+size_t TAhoCorasick::memory_bytes() const noexcept {
+    return cells_.size() * sizeof(TCell) +
+           fail_.size() * sizeof(int32_t) +
+           report_.size() * sizeof(int32_t) +
+           output_begin_.size() * sizeof(uint32_t) +
+           outputs_.size() * sizeof(uint32_t) +
+           lengths_.size() * sizeof(size_t);
+}
+
+std::vector<TPatternMatch> TAhoCorasick::find_all(
+    std::string_view text) const {
+    std::vector<TPatternMatch> result;
+    scan(text, [this, &result](size_t pattern, size_t end) {
+        result.push_back(TPatternMatch{pattern, end - lengths_[pattern]});
+    });
+    return result;
+}
@@ -0,0 +1,101 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_STRINGS_AHO_CORASICK_H_
+#define LIB_STRINGS_AHO_CORASICK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// вхождение образца с номером pattern, начинающееся в position
+struct TPatternMatch {
+    size_t pattern;
+    size_t position;
+
+    bool operator==(const TPatternMatch& other) const noexcept {
+        return pattern == other.pattern && position == other.position;
+    }
+};
+
+// Автомат Ахо - Корасик: все вхождения набора образцов за один проход
+// по тексту. Переходы бора хранятся двойным массивом: у состояния s
+// переход по байту c ведёт в ячейку base[s] + c + 1, если её check
+// равен s. Базы подбираются при построении так, чтобы ячейки детей
+// разных состояний не пересекались, поэтому таблица занимает немногим
+// больше ячеек, чем в боре переходов, а не 256 на состояние, и переход
+// - две загрузки из одной пары (base, check) без поиска по списку
+// детей. При отсутствии перехода автомат идёт по суффиксным ссылкам;
+// выходные ссылки ведут сразу к ближайшему состоянию, где кончается
+// образец. Состояние 0 - корень. Пустой образец - std::invalid_argument
+class TAhoCorasick {
+ public:
+    static const uint32_t kRoot = 0;
+
+    explicit TAhoCorasick(const std::vector<std::string>& patterns);
+
+    size_t pattern_count() const noexcept { return lengths_.size(); }
+    // состояний (узлов бора) и ячеек двойного массива
+    size_t state_count() const noexcept { return state_count_; }
+    size_t table_size() const noexcept { return cells_.size(); }
+    // байтов в таблицах автомата
+    size_t memory_bytes() const noexcept;
+
+    // Проход по text из состояния state; on_match(pattern, end)
+    // вызывается для каждого вхождения, end - позиция в text сразу за
+    // ним (вхождение могло начаться в предыдущем куске потока).
+    // Возвращает состояние после text - его передают в следующий вызов
+    template <class Callback>
+    uint32_t scan(std::string_view text, Callback on_match,
+                  uint32_t state = kRoot) const {
+        const TCell* cells = cells_.data();
+        int32_t current = static_cast<int32_t>(state);
+        for (size_t i = 0; i < text.size(); i++) {
+            int32_t code = static_cast<unsigned char>(text[i]) + 1;
+            for (;;) {
+                int32_t next = cells[current].base + code;
+                if (cells[next].check == current) {
+                    current = next;
+                    break;
+                }
+                if (current == 0) {
+                    break;
+                }
+                current = fail_[current];
+            }
+            for (int32_t report = report_[current]; report >= 0;
+                 report = report_[fail_[report]]) {
+                for (uint32_t k = output_begin_[report];
+                     k < output_begin_[report + 1]; k++) {
+                    on_match(static_cast<size_t>(outputs_[k]), i + 1);
+                }
+            }
+        }
+        return static_cast<uint32_t>(current);
+    }
+
+    // все вхождения в text по возрастанию конца
+    std::vector<TPatternMatch> find_all(std::string_view text) const;
+
+ private:
+    struct TCell {
+        int32_t base;
+        int32_t check;  // родитель или -1 (ячейка свободна)
+    };
+
+    std::vector<TCell> cells_;
+    // суффиксная ссылка
+    std::vector<int32_t> fail_;
+    // само состояние, если в нём кончается образец, иначе ближайшее
+    // такое по суффиксным ссылкам; -1 - таких нет
+    std::vector<int32_t> report_;
+    // номера образцов состояния s - outputs_[output_begin_[s] ..
+    // output_begin_[s + 1])
+    std::vector<uint32_t> output_begin_;
+    std::vector<uint32_t> outputs_;
+    std::vector<size_t> lengths_;
+    size_t state_count_;
+};
+
+#endif  // LIB_STRINGS_AHO_CORASICK_H_
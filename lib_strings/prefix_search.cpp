@@ -0,0 +1,94 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../lib_strings/prefix_search.h"
+
+std::vector<size_t> prefix_function(std::string_view text) {
+    std::vector<size_t> result(text.size(), 0);
+    for (size_t i = 1; i < text.size(); i++) {
+        size_t length = result[i - 1];
+        while (length > 0 && text[i] != text[length]) {
+            length = result[length - 1];
+        }
+        if (text[i] == text[length]) {
+            length++;
+        }
+        result[i] = length;
+    }
+    return result;
+}
+
+std::vector<size_t> z_function(std::string_view text) {
+    std::vector<size_t> result(text.size(), 0);
+    if (text.empty()) {
+        return result;
+    }
+    result[0] = text.size();
+    // [left, right) - самое правое найденное совпадение с префиксом
+    size_t left = 0;
+    size_t right = 0;
+    for (size_t i = 1; i < text.size(); i++) {
+        size_t length = i < right ? std::min(right - i, result[i - left]) : 0;
+        while (i + length < text.size() && text[length] == text[i + length]) {
+            length++;
+        }
+        if (i + length > right) {
+            left = i;
+            right = i + length;
+        }
+        result[i] = length;
+    }
+    return result;
+}
+
+std::vector<size_t> z_find_all(std::string_view text,
+                               std::string_view pattern) {
+    std::vector<size_t> result;
+    if (pattern.empty()) {
+        for (size_t i = 0; i <= text.size(); i++) {
+            result.push_back(i);
+        }
+        return result;
+    }
+    if (pattern.size() > text.size()) {
+        return result;
+    }
+    std::vector<size_t> z = z_function(pattern);
+    size_t count = pattern.size();
+    // text[left .. right) совпадает с pattern[0 .. right - left)
+    size_t left = 0;
+    size_t right = 0;
+    for (size_t i = 0; i + count <= text.size(); i++) {
+        size_t length = i < right ? std::min(right - i, z[i - left]) : 0;
+        while (length < count && text[i + length] == pattern[length]) {
+            length++;
+        }
+        if (i + length > right) {
+            left = i;
+            right = i + length;
+        }
+        if (length == count) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+TKmpMatcher::TKmpMatcher(std::string pattern)
+    : pattern_(std::move(pattern)), matched_(0), position_(0) {
+    if (pattern_.empty()) {
+        throw std::invalid_argument("TKmpMatcher: empty pattern");
+    }
+    failure_ = prefix_function(pattern_);
+}
+
+std::vector<uint64_t> TKmpMatcher::find_all(std::string_view text) {
+    reset();
+    std::vector<uint64_t> result;
+    feed(text, [&result](uint64_t start) { result.push_back(start); });
+    return result;
+}
@@ -0,0 +1,94 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_STRINGS_PREFIX_SEARCH_H_
+#define LIB_STRINGS_PREFIX_SEARCH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// префикс-функция: result[i] - длина наибольшего собственного префикса
+// text[0 .. i], который одновременно является его суффиксом
+std::vector<size_t> prefix_function(std::string_view text);
+
+// Z-функция: result[i] - длина наибольшего общего префикса text и
+// text[i ..); result[0] = text.size()
+std::vector<size_t> z_function(std::string_view text);
+
+// Позиции всех (в том числе перекрывающихся) вхождений pattern в text
+// по возрастанию. Строится Z-функция только образца, а текст проходится
+// один раз с окном последнего найденного совпадения [left, right):
+// внутри окна длина совпадения берётся из Z-функции образца, за окном
+// продлевается сравнением - O(text + pattern) без склейки строк и без
+// памяти под текст. Пустой образец входит в каждую позицию 0 .. size
+std::vector<size_t> z_find_all(std::string_view text,
+                               std::string_view pattern);
+
+// Алгоритм Кнута - Морриса - Пратта для потокового входа: текст
+// подаётся кусками произвольной длины (например, блоками, прочитанными
+// из файла), и вхождения, пересекающие границу кусков, тоже находятся -
+// между вызовами хранится только длина совпавшего префикса образца. На
+// каждый байт входа приходится амортизированно O(1) сравнений; пока
+// совпадения нет, следующий кандидат ищется memchr по первому байту
+// образца. Пустой образец - std::invalid_argument
+class TKmpMatcher {
+ public:
+    explicit TKmpMatcher(std::string pattern);
+
+    const std::string& pattern() const noexcept { return pattern_; }
+    // байтов подано с начала потока
+    uint64_t position() const noexcept { return position_; }
+    // начать новый поток
+    void reset() noexcept {
+        matched_ = 0;
+        position_ = 0;
+    }
+
+    // очередной кусок потока; on_match(start) вызывается для каждого
+    // вхождения (перекрывающиеся тоже), start - смещение его начала от
+    // начала потока
+    template <class Callback>
+    void feed(std::string_view chunk, Callback on_match) {
+        const char* text = chunk.data();
+        size_t size = chunk.size();
+        size_t i = 0;
+        while (i < size) {
+            if (matched_ == 0) {
+                const void* found = std::memchr(text + i, pattern_[0],
+                                                size - i);
+                if (found == nullptr) {
+                    break;
+                }
+                i = static_cast<size_t>(static_cast<const char*>(found) -
+                                        text);
+            }
+            char symbol = text[i++];
+            while (matched_ > 0 && pattern_[matched_] != symbol) {
+                matched_ = failure_[matched_ - 1];
+            }
+            if (pattern_[matched_] == symbol) {
+                matched_++;
+            }
+            if (matched_ == pattern_.size()) {
+                on_match(position_ + i - matched_);
+                matched_ = failure_[matched_ - 1];
+            }
+        }
+        position_ += size;
+    }
+
+    // все вхождения в text как в отдельный поток
+    std::vector<uint64_t> find_all(std::string_view text);
+
+ private:
+    std::string pattern_;
+    // префикс-функция образца
+    std::vector<size_t> failure_;
+    size_t matched_;
+    uint64_t position_;
+};
+
+#endif  // LIB_STRINGS_PREFIX_SEARCH_H_
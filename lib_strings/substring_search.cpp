@@ -0,0 +1,186 @@
+// Copyright 2024 Marina Usova
+
+#if defined(__x86_64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_IX86)
+#define STRINGS_X86
+#endif
+
+#ifdef STRINGS_X86
+#include <immintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include "../lib_strings/substring_search.h"
+
+#if defined(STRINGS_X86) && (defined(__GNUC__) || defined(__clang__))
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE41
+#define TARGET_AVX2
+#endif
+
+namespace {
+
+const size_t kNotFound = std::string_view::npos;
+
+// поиск в text[0 .. size) образца из count >= 2 байтов: memchr по
+// первому байту и проверка остальных
+size_t find_scalar(const char* text, size_t size, const char* pattern,
+                   size_t count) {
+    const char* position = text;
+    const char* last = text + size - count + 1;
+    while (position < last) {
+        const void* found = std::memchr(position, pattern[0],
+                                        static_cast<size_t>(last - position));
+        if (found == nullptr) {
+            return kNotFound;
+        }
+        position = static_cast<const char*>(found);
+        if (std::memcmp(position + 1, pattern + 1, count - 1) == 0) {
+            return static_cast<size_t>(position - text);
+        }
+        position++;
+    }
+    return kNotFound;
+}
+
+#ifdef STRINGS_X86
+
+inline int count_trailing_zeros(uint32_t mask) {
+#ifdef _MSC_VER
+    unsigned long index;  // NOLINT(runtime/int)
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+// кандидаты - установленные биты mask для позиций block, block + 1 ...;
+// первый и последний байты у них уже совпали
+inline size_t check_candidates(const char* text, size_t block,
+                               uint32_t mask, const char* pattern,
+                               size_t count) {
+    while (mask != 0) {
+        size_t position = block + count_trailing_zeros(mask);
+        if (std::memcmp(text + position + 1, pattern + 1, count - 2) == 0) {
+            return position;
+        }
+        mask &= mask - 1;
+    }
+    return kNotFound;
+}
+
+// остаток короче блока проверяется скалярно
+inline size_t finish_scalar(const char* text, size_t size, size_t block,
+                            const char* pattern, size_t count) {
+    size_t found = find_scalar(text + block, size - block, pattern, count);
+    return found == kNotFound ? kNotFound : block + found;
+}
+
+TARGET_AVX2
+size_t find_avx2(const char* text, size_t size, const char* pattern,
+                 size_t count) {
+    const __m256i first = _mm256_set1_epi8(pattern[0]);
+    const __m256i last = _mm256_set1_epi8(pattern[count - 1]);
+    size_t block = 0;
+    // в блок входят начала block .. block + 31, последний читаемый байт
+    // - text[block + 31 + count - 1]
+    for (; block + 32 + count - 1 <= size; block += 32) {
+        __m256i heads = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(text + block));
+        __m256i tails = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(text + block + count - 1));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(heads, first),
+                             _mm256_cmpeq_epi8(tails, last))));
+        if (mask != 0) {
+            size_t found = check_candidates(text, block, mask, pattern,
+                                            count);
+            if (found != kNotFound) {
+                return found;
+            }
+        }
+    }
+    return finish_scalar(text, size, block, pattern, count);
+}
+
+// нужен только SSE2; уровень kSse41 его подразумевает
+TARGET_SSE41
+size_t find_sse(const char* text, size_t size, const char* pattern,
+                size_t count) {
+    const __m128i first = _mm_set1_epi8(pattern[0]);
+    const __m128i last = _mm_set1_epi8(pattern[count - 1]);
+    size_t block = 0;
+    for (; block + 16 + count - 1 <= size; block += 16) {
+        __m128i heads = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(text + block));
+        __m128i tails = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(text + block + count - 1));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(heads, first),
+                          _mm_cmpeq_epi8(tails, last))));
+        if (mask != 0) {
+            size_t found = check_candidates(text, block, mask, pattern,
+                                            count);
+            if (found != kNotFound) {
+                return found;
+            }
+        }
+    }
+    return finish_scalar(text, size, block, pattern, count);
+}
+
+#endif  // STRINGS_X86
+
+}  // namespace
+
+size_t find_substring(std::string_view text, std::string_view pattern,
+                      size_t from) {
+    return find_substring(text, pattern, from, detect_simd_level());
+}
+
+size_t find_substring(std::string_view text, std::string_view pattern,
+                      size_t from, SimdLevel level) {
+    if (from > text.size()) {
+        return kNotFound;
+    }
+    if (pattern.empty()) {
+        return from;
+    }
+    if (pattern.size() > text.size() - from) {
+        return kNotFound;
+    }
+    const char* data = text.data() + from;
+    size_t size = text.size() - from;
+    size_t found;
+    if (pattern.size() == 1) {
+        const void* position = std::memchr(data, pattern[0], size);
+        found = position == nullptr ? kNotFound :
+                static_cast<size_t>(static_cast<const char*>(position) -
+                                    data);
+    } else {
+        if (static_cast<int>(level) > static_cast<int>(detect_simd_level())) {
+            level = detect_simd_level();
+        }
+        switch (level) {
+#ifdef STRINGS_X86
+        case SimdLevel::kAvx2:
+            found = find_avx2(data, size, pattern.data(), pattern.size());
+            break;
+        case SimdLevel::kSse41:
+            found = find_sse(data, size, pattern.data(), pattern.size());
+            break;
+#endif
+        default:
+            found = find_scalar(data, size, pattern.data(), pattern.size());
+            break;
+        }
+    }
+    return found == kNotFound ? kNotFound : from + found;
+}
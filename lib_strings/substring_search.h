@@ -0,0 +1,28 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_STRINGS_SUBSTRING_SEARCH_H_
+#define LIB_STRINGS_SUBSTRING_SEARCH_H_
+
+#include <cstddef>
+#include <string_view>
+#include "../lib_cpu_features/cpu_features.h"
+
+// Поиск первого вхождения pattern в text начиная с позиции from; тот же
+// результат, что у std::string::find (std::string_view::npos, если
+// вхождения нет). Векторный фильтр по первому и последнему байту
+// образца: за один шаг сравниваются 32 (AVX2) или 16 (SSE) позиций
+// text с pattern[0], те же позиции со сдвигом на size - 1 - с последним
+// байтом образца, и только позиции, где совпали оба байта, проверяются
+// memcmp. На обычном тексте совпадение двух байтов на фиксированном
+// расстоянии редко, поэтому почти весь текст проходит без ветвлений по
+// отдельным символам. Однобайтовый образец ищется memchr. Набор
+// инструкций выбирается при первом вызове по detect_simd_level()
+size_t find_substring(std::string_view text, std::string_view pattern,
+                      size_t from = 0);
+
+// то же с явно заданным набором инструкций (для тестов и бенчмарков);
+// если процессор его не поддерживает, используется detect_simd_level()
+size_t find_substring(std::string_view text, std::string_view pattern,
+                      size_t from, SimdLevel level);
+
+#endif  // LIB_STRINGS_SUBSTRING_SEARCH_H_
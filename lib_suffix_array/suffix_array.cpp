@@ -0,0 +1,268 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include "../lib_suffix_array/suffix_array.h"
+
+namespace {
+
+// свободная ячейка массива во время построения
+const int32_t kEmpty = -1;
+
+// рабочая память построения: текущий объём и пик
+struct TMemoryUsage {
+    size_t current = 0;
+    size_t peak = 0;
+
+    void add(size_t bytes) {
+        current += bytes;
+        peak = std::max(peak, current);
+    }
+    void remove(size_t bytes) { current -= bytes; }
+};
+
+// типы суффиксов, по биту на позицию: 1 - S (суффикс меньше
+// следующего), 0 - L (больше)
+class TSuffixTypes {
+ public:
+    explicit TSuffixTypes(int32_t count)
+        : words_((static_cast<size_t>(count) + 63) / 64, 0) {}
+
+    bool is_s(int32_t i) const noexcept {
+        return (words_[i >> 6] >> (i & 63)) & 1;
+    }
+    void set_s(int32_t i) noexcept {
+        words_[i >> 6] |= uint64_t(1) << (i & 63);
+    }
+    // S-суффикс, перед которым L
+    bool is_lms(int32_t i) const noexcept {
+        return i > 0 && is_s(i) && !is_s(i - 1);
+    }
+    size_t bytes() const noexcept { return words_.size() * sizeof(uint64_t); }
+
+ private:
+    std::vector<uint64_t> words_;
+};
+
+// начала корзин символов
+void bucket_heads(const std::vector<int32_t>& sizes,
+                  std::vector<int32_t>* bucket) {
+    int32_t sum = 0;
+    for (size_t c = 0; c < sizes.size(); c++) {
+        (*bucket)[c] = sum;
+        sum += sizes[c];
+    }
+}
+
+// концы корзин символов (позиция за последней ячейкой)
+void bucket_tails(const std::vector<int32_t>& sizes,
+                  std::vector<int32_t>* bucket) {
+    int32_t sum = 0;
+    for (size_t c = 0; c < sizes.size(); c++) {
+        sum += sizes[c];
+        (*bucket)[c] = sum;
+    }
+}
+
+// Индуцированная сортировка: LMS-суффиксы уже стоят в концах своих
+// корзин. Проход слева направо ставит L-суффиксы в начала корзин вслед
+// за суффиксами, которые за ними следуют; проход справа налево так же
+// ставит S-суффиксы в концы корзин. Ограничитель виртуальный: самый
+// маленький суффикс - пустой, и первым в свою корзину идёт n - 1
+template <class Char>
+void induce(const Char* s, int32_t* sa, int32_t n, const TSuffixTypes& types,
+            const std::vector<int32_t>& sizes, std::vector<int32_t>* bucket) {
+    bucket_heads(sizes, bucket);
+    sa[(*bucket)[s[n - 1]]++] = n - 1;
+    for (int32_t i = 0; i < n; i++) {
+        int32_t j = sa[i] - 1;
+        if (j >= 0 && !types.is_s(j)) {
+            sa[(*bucket)[s[j]]++] = j;
+        }
+    }
+    bucket_tails(sizes, bucket);
+    for (int32_t i = n - 1; i >= 0; i--) {
+        int32_t j = sa[i] - 1;
+        if (j >= 0 && types.is_s(j)) {
+            sa[--(*bucket)[s[j]]] = j;
+        }
+    }
+}
+
+// равны ли LMS-подстроки, начинающиеся в p и q (символы и типы до
+// следующей LMS-позиции включительно); подстрока, дошедшая до
+// ограничителя, уникальна
+template <class Char>
+bool equal_lms(const Char* s, int32_t n, const TSuffixTypes& types,
+               int32_t p, int32_t q) {
+    for (int32_t d = 0;; d++) {
+        if (p + d == n || q + d == n) {
+            return false;
+        }
+        if (s[p + d] != s[q + d] ||
+            types.is_s(p + d) != types.is_s(q + d)) {
+            return false;
+        }
+        if (d > 0) {
+            bool end_p = types.is_lms(p + d);
+            bool end_q = types.is_lms(q + d);
+            if (end_p || end_q) {
+                return end_p && end_q;
+            }
+        }
+    }
+}
+
+// SA-IS для s[0 .. n) над алфавитом [0, upper]; результат - в sa[0 .. n)
+template <class Char>
+void sais(const Char* s, int32_t* sa, int32_t n, int32_t upper,
+          TMemoryUsage* memory) {
+    if (n <= 1) {
+        if (n == 1) {
+            sa[0] = 0;
+        }
+        return;
+    }
+    TSuffixTypes types(n);
+    for (int32_t i = n - 2; i >= 0; i--) {
+        if (s[i] < s[i + 1] || (s[i] == s[i + 1] && types.is_s(i + 1))) {
+            types.set_s(i);
+        }
+    }
+    std::vector<int32_t> sizes(static_cast<size_t>(upper) + 1, 0);
+    std::vector<int32_t> bucket(sizes.size());
+    for (int32_t i = 0; i < n; i++) {
+        sizes[s[i]]++;
+    }
+    size_t level_bytes = types.bytes() + 2 * sizes.size() * sizeof(int32_t);
+    memory->add(level_bytes);
+
+    // 1. LMS-суффиксы в произвольном порядке - и после индуцирования
+    // LMS-подстроки упорядочены
+    std::fill(sa, sa + n, kEmpty);
+    bucket_tails(sizes, &bucket);
+    for (int32_t i = n - 1; i >= 1; i--) {
+        if (types.is_lms(i)) {
+            sa[--bucket[s[i]]] = i;
+        }
+    }
+    induce(s, sa, n, types, sizes, &bucket);
+
+    // 2. упорядоченные LMS-позиции - в начало массива, их имена (номера
+    // классов равных подстрок) - в sa[m + p / 2]: LMS-позиции отстоят
+    // друг от друга хотя бы на 2, поэтому ячейки не пересекаются
+    int32_t m = 0;
+    for (int32_t i = 0; i < n; i++) {
+        if (types.is_lms(sa[i])) {
+            sa[m++] = sa[i];
+        }
+    }
+    std::fill(sa + m, sa + n, kEmpty);
+    int32_t names = 0;
+    int32_t previous = kEmpty;
+    for (int32_t i = 0; i < m; i++) {
+        int32_t p = sa[i];
+        if (previous == kEmpty || !equal_lms(s, n, types, previous, p)) {
+            names++;
+        }
+        previous = p;
+        sa[m + p / 2] = names - 1;
+    }
+    // сокращённая строка - имена в порядке позиций - в конец массива
+    for (int32_t i = n - 1, j = n - 1; i >= m; i--) {
+        if (sa[i] != kEmpty) {
+            sa[j--] = sa[i];
+        }
+    }
+
+    // 3. суффиксный массив сокращённой строки - в sa[0 .. m): рекурсия
+    // не выходит за эти ячейки, а строка лежит в sa[n - m .. n)
+    int32_t* reduced = sa + n - m;
+    if (names < m) {
+        sais(static_cast<const int32_t*>(reduced), sa, m, names - 1, memory);
+    } else {
+        for (int32_t i = 0; i < m; i++) {
+            sa[reduced[i]] = i;
+        }
+    }
+
+    // 4. LMS-суффиксы в найденном порядке - в концы корзин (i-й по
+    // порядку попадает не левее ячейки i), и окончательное индуцирование
+    for (int32_t i = 1, j = 0; i < n; i++) {
+        if (types.is_lms(i)) {
+            reduced[j++] = i;
+        }
+    }
+    for (int32_t i = 0; i < m; i++) {
+        sa[i] = reduced[sa[i]];
+    }
+    std::fill(sa + m, sa + n, kEmpty);
+    bucket_tails(sizes, &bucket);
+    for (int32_t i = m - 1; i >= 0; i--) {
+        int32_t p = sa[i];
+        sa[i] = kEmpty;
+        sa[--bucket[s[p]]] = p;
+    }
+    induce(s, sa, n, types, sizes, &bucket);
+    memory->remove(level_bytes);
+}
+
+}  // namespace
+
+std::vector<uint32_t> suffix_array(std::string_view text,
+                                   size_t* peak_bytes) {
+    if (text.size() > kSuffixArrayMaxSize) {
+        throw std::length_error("suffix_array: text is too long");
+    }
+    int32_t n = static_cast<int32_t>(text.size());
+    std::vector<uint32_t> result(text.size());
+    TMemoryUsage memory;
+    memory.add(result.size() * sizeof(uint32_t));
+    // int32_t и uint32_t - знаковый и беззнаковый варианты одного типа,
+    // запись через указатель на другой из них допустима
+    sais(reinterpret_cast<const unsigned char*>(text.data()),
+         reinterpret_cast<int32_t*>(result.data()), n, 255, &memory);
+    if (peak_bytes != nullptr) {
+        *peak_bytes = memory.peak;
+    }
+    return result;
+}
+
+std::vector<uint32_t> lcp_array(std::string_view text,
+                                const std::vector<uint32_t>& sa,
+                                size_t* peak_bytes) {
+    if (sa.size() != text.size()) {
+        throw std::invalid_argument(
+            "lcp_array: suffix array does not match the text");
+    }
+    size_t n = text.size();
+    std::vector<uint32_t> rank(n);
+    for (size_t i = 0; i < n; i++) {
+        rank[sa[i]] = static_cast<uint32_t>(i);
+    }
+    std::vector<uint32_t> result(n, 0);
+    if (peak_bytes != nullptr) {
+        TMemoryUsage memory;
+        memory.add(rank.capacity() * sizeof(uint32_t));
+        memory.add(result.capacity() * sizeof(uint32_t));
+        *peak_bytes = memory.peak;
+    }
+    size_t common = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (rank[i] == 0) {
+            common = 0;
+            continue;
+        }
+        size_t j = sa[rank[i] - 1];
+        while (i + common < n && j + common < n &&
+               text[i + common] == text[j + common]) {
+            common++;
+        }
+        result[rank[i]] = static_cast<uint32_t>(common);
+        if (common > 0) {
+            common--;
+        }
+    }
+    return result;
+}
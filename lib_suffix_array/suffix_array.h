@@ -0,0 +1,47 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_SUFFIX_ARRAY_SUFFIX_ARRAY_H_
+#define LIB_SUFFIX_ARRAY_SUFFIX_ARRAY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// наибольшая длина текста: позиции хранятся 32-битными
+const size_t kSuffixArrayMaxSize = INT32_MAX;
+
+// Суффиксный массив text: начала суффиксов в лексикографическом порядке
+// (байты сравниваются как беззнаковые, более короткий суффикс - префикс
+// более длинного - идёт раньше). Построение SA-IS за O(n): суффиксы
+// делятся на типы S и L (меньше или больше следующего), сортируются
+// только LMS-подстроки (от S-суффикса, перед которым L, до следующего
+// такого), их имена образуют строку вдвое короче, и если имена не
+// уникальны, задача для неё решается рекурсивно; затем порядок всех
+// суффиксов индуцируется двумя проходами по корзинам первых байтов.
+// Текст не копируется и не дополняется ограничителем (он виртуальный),
+// а сокращённая строка и её суффиксный массив на всех уровнях рекурсии
+// живут внутри результата, поэтому кроме самого массива (4 байта на
+// байт текста) нужны биты типов и два массива корзин на каждый активный
+// уровень рекурсии. На верхнем уровне корзин 256, но глубже алфавит -
+// имена LMS-подстрок, и на первом уровне их бывает почти n / 2, на
+// следующих - вдвое меньше: в худшем случае корзины занимают почти 4n
+// байт на первом уровне и до 8n байт в сумме сверх результата. На
+// журналах и ДНК пик вместе с результатом - 4.5-5 байт на байт текста.
+// Если peak_bytes не nullptr, туда пишется пик рабочей памяти вместе с
+// результатом. std::length_error - текст длиннее kSuffixArrayMaxSize
+std::vector<uint32_t> suffix_array(std::string_view text,
+                                   size_t* peak_bytes = nullptr);
+
+// Массив LCP алгоритмом Касаи за O(n): result[i] - длина общего
+// префикса суффиксов sa[i - 1] и sa[i], result[0] = 0. Суффиксы
+// проходятся в порядке текста: общий префикс следующего суффикса со
+// своим соседом не короче текущего минус один, поэтому суммарно
+// сравнений O(n). Нужен обратный массив (ещё 4 байта на байт текста).
+// peak_bytes - как в suffix_array: пик рабочей памяти вместе с
+// результатом, без текста и sa
+std::vector<uint32_t> lcp_array(std::string_view text,
+                                const std::vector<uint32_t>& sa,
+                                size_t* peak_bytes = nullptr);
+
+#endif  // LIB_SUFFIX_ARRAY_SUFFIX_ARRAY_H_
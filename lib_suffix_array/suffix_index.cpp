@@ -0,0 +1,77 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../lib_suffix_array/suffix_array.h"
+#include "../lib_suffix_array/suffix_index.h"
+
+TSuffixIndex::TSuffixIndex(std::string text)
+    : text_(std::move(text)), suffixes_(suffix_array(text_)) {}
+
+size_t TSuffixIndex::bound(std::string_view pattern, bool after) const {
+    const unsigned char* text =
+        reinterpret_cast<const unsigned char*>(text_.data());
+    const unsigned char* needle =
+        reinterpret_cast<const unsigned char*>(pattern.data());
+    size_t n = text_.size();
+    size_t m = pattern.size();
+    // ответ в (left, right]; left = -1 и right = n - воображаемые
+    // суффиксы меньше и больше всех; *_common - общие префиксы образца
+    // с суффиксами на границах
+    ptrdiff_t left = -1;
+    ptrdiff_t right = static_cast<ptrdiff_t>(n);
+    size_t left_common = 0;
+    size_t right_common = 0;
+    while (right - left > 1) {
+        ptrdiff_t middle = left + (right - left) / 2;
+        size_t start = suffixes_[middle];
+        size_t common = std::min(left_common, right_common);
+        while (common < m && start + common < n &&
+               text[start + common] == needle[common]) {
+            common++;
+        }
+        bool before;
+        if (common == m) {
+            // суффикс начинается с образца
+            before = after;
+        } else {
+            before = start + common == n ||
+                     text[start + common] < needle[common];
+        }
+        if (before) {
+            left = middle;
+            left_common = common;
+        } else {
+            right = middle;
+            right_common = common;
+        }
+    }
+    return static_cast<size_t>(right);
+}
+
+std::pair<size_t, size_t> TSuffixIndex::equal_range(
+    std::string_view pattern) const {
+    return std::make_pair(bound(pattern, false), bound(pattern, true));
+}
+
+size_t TSuffixIndex::count(std::string_view pattern) const {
+    std::pair<size_t, size_t> range = equal_range(pattern);
+    return range.second - range.first;
+}
+
+bool TSuffixIndex::contains(std::string_view pattern) const {
+    size_t first = bound(pattern, false);
+    return first < suffixes_.size() &&
+           text_.compare(suffixes_[first], pattern.size(), pattern) == 0;
+}
+
+std::vector<uint32_t> TSuffixIndex::find_all(
+    std::string_view pattern) const {
+    std::pair<size_t, size_t> range = equal_range(pattern);
+    std::vector<uint32_t> result(suffixes_.begin() + range.first,
+                                 suffixes_.begin() + range.second);
+    std::sort(result.begin(), result.end());
+    return result;
+}
@@ -0,0 +1,50 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_SUFFIX_ARRAY_SUFFIX_INDEX_H_
+#define LIB_SUFFIX_ARRAY_SUFFIX_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Индекс подстрок текста: текст и его суффиксный массив (5 байт на
+// байт текста). Все вхождения образца - отрезок суффиксного массива,
+// его границы ищутся двоичным поиском за O(|pattern| log n) в худшем
+// случае. При поиске запоминаются длины общих префиксов образца с
+// суффиксами на обеих границах отрезка, и сравнение с серединой
+// начинается с меньшей из них: все суффиксы между границами имеют
+// этот префикс, поэтому на длинных образцах уже совпавшие символы не
+// сравниваются повторно
+class TSuffixIndex {
+ public:
+    explicit TSuffixIndex(std::string text);
+
+    const std::string& text() const noexcept { return text_; }
+    const std::vector<uint32_t>& suffixes() const noexcept {
+        return suffixes_;
+    }
+    size_t size() const noexcept { return text_.size(); }
+    size_t memory_bytes() const noexcept {
+        return text_.capacity() + suffixes_.capacity() * sizeof(uint32_t);
+    }
+
+    // [first, last) в suffixes() - суффиксы, начинающиеся с pattern
+    std::pair<size_t, size_t> equal_range(std::string_view pattern) const;
+    size_t count(std::string_view pattern) const;
+    bool contains(std::string_view pattern) const;
+    // позиции всех вхождений по возрастанию
+    std::vector<uint32_t> find_all(std::string_view pattern) const;
+
+ private:
+    // первый суффикс, не меньший pattern (after = false), или первый,
+    // идущий после всех суффиксов с префиксом pattern (after = true)
+    size_t bound(std::string_view pattern, bool after) const;
+
+    std::string text_;
+    std::vector<uint32_t> suffixes_;
+};
+
+#endif  // LIB_SUFFIX_ARRAY_SUFFIX_INDEX_H_
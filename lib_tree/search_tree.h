@@ -0,0 +1,424 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_TREE_SEARCH_TREE_H_
+#define LIB_TREE_SEARCH_TREE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../lib_memory/pool.h"
+#include "../lib_tree/tree_links.h"
+
+// Упорядоченный словарь на сбалансированном дереве поиска (АВЛ или
+// красно-чёрном - параметр Balance). Узлы выделяются из пула
+// TObjectPool: они лежат подряд в слябах, вставка не обращается к
+// malloc, а деревья одного типа могут делить пул (make_pool() и
+// конструктор от пула). Каждый узел хранит размер поддерева, поэтому
+// k-й элемент (select), ранг ключа (rank) и число ключей в диапазоне
+// находятся за O(log n). Из отсортированных данных дерево строится за
+// O(n) (assign_sorted) - без поиска места и поворотов на каждый ключ.
+template <class Key, class Value, TreeBalance Balance,
+          class Less = std::less<Key>>
+class TSearchTree {
+ public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+
+ private:
+    struct TNode : tree_detail::TLinks {
+        template <class... Args>
+        explicit TNode(Args&&... args)
+            : tree_detail::TLinks{ nullptr, nullptr, nullptr, 0, 0 },
+              value(std::forward<Args>(args)...) {}
+
+        value_type value;
+    };
+
+    struct TTraits {
+        using value_type = typename TSearchTree::value_type;
+        static value_type* value_of(tree_detail::TLinks* links) noexcept {
+            return &static_cast<TNode*>(links)->value;
+        }
+    };
+
+ public:
+    using iterator = tree_detail::TTreeIterator<TTraits, false>;
+    using const_iterator = tree_detail::TTreeIterator<TTraits, true>;
+    using iterator_range = tree_detail::TIteratorRange<iterator>;
+    using const_iterator_range = tree_detail::TIteratorRange<const_iterator>;
+    using node_pool = TObjectPool<TNode>;
+
+    static constexpr TreeBalance kBalance = Balance;
+    static constexpr size_t kMaxSize = UINT32_MAX;
+    static constexpr size_t kDefaultNodesPerSlab = 256;
+
+    static std::shared_ptr<node_pool> make_pool(
+        size_t nodes_per_slab = kDefaultNodesPerSlab) {
+        return std::make_shared<node_pool>(nodes_per_slab);
+    }
+
+    explicit TSearchTree(Less less = Less())
+        : TSearchTree(make_pool(), std::move(less)) {}
+
+    // дерево, выделяющее узлы из общего пула
+    explicit TSearchTree(std::shared_ptr<node_pool> pool, Less less = Less())
+        : pool_(std::move(pool)), less_(std::move(less)) {
+        if (pool_ == nullptr) {
+            throw std::invalid_argument("TSearchTree: node pool is null");
+        }
+        reset_header();
+    }
+
+    // копия получает собственный пул и строится за O(n)
+    TSearchTree(const TSearchTree& other) : TSearchTree(other.less_) {
+        std::vector<tree_detail::TLinks*> nodes;
+        nodes.reserve(other.size());
+        try {
+            for (const value_type& value : other) {
+                nodes.push_back(pool_->create(value));
+            }
+        } catch (...) {
+            for (tree_detail::TLinks* node : nodes) {
+                pool_->destroy(static_cast<TNode*>(node));
+            }
+            throw;
+        }
+        tree_detail::build(Balance, nodes.data(), nodes.size(), &header_);
+    }
+
+    // перемещённое дерево остаётся пустым и пользуется тем же пулом
+    TSearchTree(TSearchTree&& other) noexcept
+        : pool_(other.pool_), less_(other.less_) {
+        reset_header();
+        take_nodes(&other);
+    }
+
+    TSearchTree& operator=(const TSearchTree& other) {
+        if (this != &other) {
+            TSearchTree copy(other);
+            clear();
+            pool_ = copy.pool_;
+            less_ = copy.less_;
+            take_nodes(&copy);
+        }
+        return *this;
+    }
+
+    TSearchTree& operator=(TSearchTree&& other) noexcept {
+        if (this != &other) {
+            clear();
+            pool_ = other.pool_;
+            less_ = other.less_;
+            take_nodes(&other);
+        }
+        return *this;
+    }
+
+    ~TSearchTree() { clear(); }
+
+    size_t size() const noexcept { return tree_detail::size_of(root()); }
+    bool empty() const noexcept { return root() == nullptr; }
+
+    iterator begin() noexcept { return iterator(first()); }
+    iterator end() noexcept { return iterator(&header_); }
+    const_iterator begin() const noexcept {
+        return const_iterator(first());
+    }
+    const_iterator end() const noexcept { return const_iterator(header()); }
+
+    iterator find(const Key& key) { return iterator(find_node(key)); }
+    const_iterator find(const Key& key) const {
+        return const_iterator(find_node(key));
+    }
+    bool contains(const Key& key) const { return find_node(key) != &header_; }
+
+    // первый элемент с ключом не меньше key
+    iterator lower_bound(const Key& key) {
+        return iterator(lower_node(key));
+    }
+    const_iterator lower_bound(const Key& key) const {
+        return const_iterator(lower_node(key));
+    }
+
+    // первый элемент с ключом больше key
+    iterator upper_bound(const Key& key) {
+        return iterator(upper_node(key));
+    }
+    const_iterator upper_bound(const Key& key) const {
+        return const_iterator(upper_node(key));
+    }
+
+    // элементы с ключами из [from, to) для обхода циклом for
+    iterator_range range(const Key& from, const Key& to) {
+        return iterator_range(lower_bound(from), lower_bound(to));
+    }
+    const_iterator_range range(const Key& from, const Key& to) const {
+        return const_iterator_range(lower_bound(from), lower_bound(to));
+    }
+
+    // число ключей, меньших key
+    size_t rank(const Key& key) const {
+        const tree_detail::TLinks* node = root();
+        size_t result = 0;
+        while (node != nullptr) {
+            if (less_(key_of(node), key)) {
+                result += tree_detail::size_of(node->left) + 1;
+                node = node->right;
+            } else {
+                node = node->left;
+            }
+        }
+        return result;
+    }
+
+    // позиция элемента в порядке ключей; для end() - size()
+    size_t index_of(const_iterator it) const {
+        if (it.links() == &header_) {
+            return size();
+        }
+        return tree_detail::rank(it.links(), &header_);
+    }
+
+    // число ключей из [from, to)
+    size_t count_range(const Key& from, const Key& to) const {
+        size_t lo = rank(from);
+        size_t hi = rank(to);
+        return hi > lo ? hi - lo : 0;
+    }
+
+    // k-й по порядку элемент (с нуля); k >= size() - std::out_of_range
+    iterator select(size_t k) { return iterator(select_node(k)); }
+    const_iterator select(size_t k) const {
+        return const_iterator(select_node(k));
+    }
+
+    Value& at(const Key& key) { return value_of(find_node(key)); }
+    const Value& at(const Key& key) const {
+        return value_of(find_node(key));
+    }
+
+    Value& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return try_emplace(value.first, value.second);
+    }
+
+    // добавляет элемент, если ключа ещё нет; иначе возвращает
+    // существующий и ничего не создаёт
+    template <class... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        tree_detail::TLinks* parent = &header_;
+        tree_detail::TLinks* node = root();
+        bool left = true;
+        while (node != nullptr) {
+            parent = node;
+            left = less_(key, key_of(node));
+            if (!left && !less_(key_of(node), key)) {
+                return { iterator(node), false };
+            }
+            node = left ? node->left : node->right;
+        }
+        if (size() == kMaxSize) {
+            throw std::length_error("TSearchTree: too many elements");
+        }
+        TNode* created = pool_->create(
+            std::piecewise_construct, std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        tree_detail::insert_and_rebalance(Balance, left, created, parent,
+                                          &header_);
+        return { iterator(created), true };
+    }
+
+    template <class V>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, V&& value) {
+        std::pair<iterator, bool> result = try_emplace(key);
+        result.first->second = std::forward<V>(value);
+        return result;
+    }
+
+    // возвращает итератор на следующий элемент
+    iterator erase(const_iterator position) {
+        tree_detail::TLinks* node = position.links();
+        iterator next(tree_detail::next(node));
+        tree_detail::erase_and_rebalance(Balance, node, &header_);
+        pool_->destroy(static_cast<TNode*>(node));
+        return next;
+    }
+
+    size_t erase(const Key& key) {
+        iterator it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    // заменяет содержимое элементами values, отсортированными по
+    // строго возрастающим ключам (иначе std::invalid_argument), за O(n)
+    void assign_sorted(const std::vector<value_type>& values) {
+        for (size_t i = 1; i < values.size(); i++) {
+            if (!less_(values[i - 1].first, values[i].first)) {
+                throw std::invalid_argument(
+                    "TSearchTree: keys are not strictly increasing");
+            }
+        }
+        if (values.size() > kMaxSize) {
+            throw std::length_error("TSearchTree: too many elements");
+        }
+        clear();
+        std::vector<tree_detail::TLinks*> nodes;
+        nodes.reserve(values.size());
+        try {
+            for (const value_type& value : values) {
+                nodes.push_back(pool_->create(value));
+            }
+        } catch (...) {
+            for (tree_detail::TLinks* node : nodes) {
+                pool_->destroy(static_cast<TNode*>(node));
+            }
+            throw;
+        }
+        tree_detail::build(Balance, nodes.data(), nodes.size(), &header_);
+    }
+
+    void clear() noexcept {
+        destroy(root());
+        reset_header();
+    }
+
+    void swap(TSearchTree& other) noexcept {
+        TSearchTree temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    // высота дерева (для тестов и бенчмарков)
+    size_t height() const noexcept { return tree_detail::height(root()); }
+
+    // проверка порядка ключей, размеров поддеревьев и инварианта
+    // балансировки
+    bool check_invariants() const {
+        if (!tree_detail::check_structure(Balance, &header_)) {
+            return false;
+        }
+        const_iterator it = begin();
+        if (it == end()) {
+            return true;
+        }
+        for (const_iterator next = std::next(it); next != end();
+             it = next++) {
+            if (!less_(it->first, next->first)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+ private:
+    static const Key& key_of(const tree_detail::TLinks* node) noexcept {
+        return static_cast<const TNode*>(node)->value.first;
+    }
+
+    tree_detail::TLinks* root() const noexcept { return header_.left; }
+
+    tree_detail::TLinks* header() const noexcept {
+        return const_cast<tree_detail::TLinks*>(&header_);
+    }
+
+    tree_detail::TLinks* lower_node(const Key& key) const {
+        tree_detail::TLinks* node = root();
+        tree_detail::TLinks* result = header();
+        while (node != nullptr) {
+            if (less_(key_of(node), key)) {
+                node = node->right;
+            } else {
+                result = node;
+                node = node->left;
+            }
+        }
+        return result;
+    }
+
+    tree_detail::TLinks* upper_node(const Key& key) const {
+        tree_detail::TLinks* node = root();
+        tree_detail::TLinks* result = header();
+        while (node != nullptr) {
+            if (less_(key, key_of(node))) {
+                result = node;
+                node = node->left;
+            } else {
+                node = node->right;
+            }
+        }
+        return result;
+    }
+
+    // узел с ключом key или заголовок
+    tree_detail::TLinks* find_node(const Key& key) const {
+        tree_detail::TLinks* node = lower_node(key);
+        return node != header() && !less_(key, key_of(node)) ? node
+                                                             : header();
+    }
+
+    tree_detail::TLinks* select_node(size_t k) const {
+        if (k >= size()) {
+            throw std::out_of_range("TSearchTree: index out of range");
+        }
+        return tree_detail::select(root(), k);
+    }
+
+    Value& value_of(tree_detail::TLinks* node) const {
+        if (node == header()) {
+            throw std::out_of_range("TSearchTree: key not found");
+        }
+        return static_cast<TNode*>(node)->value.second;
+    }
+
+    tree_detail::TLinks* first() const noexcept {
+        return root() != nullptr ? tree_detail::leftmost(root()) : header();
+    }
+
+    void reset_header() noexcept {
+        header_ = tree_detail::TLinks{ nullptr, nullptr, nullptr, 0, 0 };
+    }
+
+    // забирает узлы other (пул должен совпадать)
+    void take_nodes(TSearchTree* other) noexcept {
+        header_.left = other->header_.left;
+        if (header_.left != nullptr) {
+            header_.left->parent = &header_;
+        }
+        other->reset_header();
+    }
+
+    void destroy(tree_detail::TLinks* node) noexcept {
+        while (node != nullptr) {
+            destroy(node->right);
+            tree_detail::TLinks* left = node->left;
+            pool_->destroy(static_cast<TNode*>(node));
+            node = left;
+        }
+    }
+
+    std::shared_ptr<node_pool> pool_;
+    Less less_;
+    tree_detail::TLinks header_;  // left - корень
+};
+
+template <class Key, class Value, class Less = std::less<Key>>
+using TAvlMap = TSearchTree<Key, Value, TreeBalance::kAvl, Less>;
+
+template <class Key, class Value, class Less = std::less<Key>>
+using TRedBlackMap = TSearchTree<Key, Value, TreeBalance::kRedBlack, Less>;
+
+#endif  // LIB_TREE_SEARCH_TREE_H_
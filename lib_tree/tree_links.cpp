@@ -0,0 +1,408 @@
+// Copyright 2024 Marina Usova
+
+#include <algorithm>
+#include "../lib_tree/tree_links.h"
+
+namespace tree_detail {
+
+namespace {
+
+uint8_t height_of(const TLinks* node) noexcept {
+    return node != nullptr ? node->tag : 0;
+}
+
+bool is_red(const TLinks* node) noexcept {
+    return node != nullptr && node->tag == kRed;
+}
+
+// пересчёт размера и высоты (АВЛ) узла по детям
+void update_avl(TLinks* node) noexcept {
+    node->size = static_cast<uint32_t>(size_of(node->left) +
+                                       size_of(node->right) + 1);
+    node->tag = static_cast<uint8_t>(
+        std::max(height_of(node->left), height_of(node->right)) + 1);
+}
+
+void replace_child(TLinks* parent, TLinks* old_child,
+                   TLinks* new_child) noexcept {
+    if (parent->left == old_child) {
+        parent->left = new_child;
+    } else {
+        parent->right = new_child;
+    }
+}
+
+// повороты сохраняют размеры поддеревьев: новый корень поддерева
+// получает размер старого, а размер опустившегося узла пересчитывается
+TLinks* rotate_left(TLinks* node) noexcept {
+    TLinks* pivot = node->right;
+    node->right = pivot->left;
+    if (pivot->left != nullptr) {
+        pivot->left->parent = node;
+    }
+    pivot->parent = node->parent;
+    replace_child(node->parent, node, pivot);
+    pivot->left = node;
+    node->parent = pivot;
+    pivot->size = node->size;
+    node->size = static_cast<uint32_t>(size_of(node->left) +
+                                       size_of(node->right) + 1);
+    return pivot;
+}
+
+TLinks* rotate_right(TLinks* node) noexcept {
+    TLinks* pivot = node->left;
+    node->left = pivot->right;
+    if (pivot->right != nullptr) {
+        pivot->right->parent = node;
+    }
+    pivot->parent = node->parent;
+    replace_child(node->parent, node, pivot);
+    pivot->right = node;
+    node->parent = pivot;
+    pivot->size = node->size;
+    node->size = static_cast<uint32_t>(size_of(node->left) +
+                                       size_of(node->right) + 1);
+    return pivot;
+}
+
+// подъём от node до корня с пересчётом размеров и высот; узел с
+// разницей высот детей 2 выравнивается одним или двумя поворотами
+void avl_rebalance(TLinks* node, TLinks* header) noexcept {
+    while (node != header) {
+        update_avl(node);
+        int balance = height_of(node->left) - height_of(node->right);
+        if (balance > 1) {
+            if (height_of(node->left->left) < height_of(node->left->right)) {
+                TLinks* child = rotate_left(node->left);
+                update_avl(child->left);
+                update_avl(child);
+            }
+            node = rotate_right(node);
+            update_avl(node->right);
+            update_avl(node);
+        } else if (balance < -1) {
+            if (height_of(node->right->right) < height_of(node->right->left)) {
+                TLinks* child = rotate_right(node->right);
+                update_avl(child->right);
+                update_avl(child);
+            }
+            node = rotate_left(node);
+            update_avl(node->left);
+            update_avl(node);
+        }
+        node = node->parent;
+    }
+}
+
+// восстановление после вставки красного узла node: устраняется пара
+// «красный родитель - красный ребёнок»
+void red_black_insert_fixup(TLinks* node, TLinks* header) noexcept {
+    while (node != header->left && is_red(node->parent)) {
+        TLinks* parent = node->parent;
+        TLinks* grand = parent->parent;
+        if (parent == grand->left) {
+            TLinks* uncle = grand->right;
+            if (is_red(uncle)) {
+                parent->tag = kBlack;
+                uncle->tag = kBlack;
+                grand->tag = kRed;
+                node = grand;
+                continue;
+            }
+            if (node == parent->right) {
+                rotate_left(parent);
+                parent = node;
+            }
+            parent->tag = kBlack;
+            grand->tag = kRed;
+            rotate_right(grand);
+            break;
+        } else {
+            TLinks* uncle = grand->left;
+            if (is_red(uncle)) {
+                parent->tag = kBlack;
+                uncle->tag = kBlack;
+                grand->tag = kRed;
+                node = grand;
+                continue;
+            }
+            if (node == parent->left) {
+                rotate_right(parent);
+                parent = node;
+            }
+            parent->tag = kBlack;
+            grand->tag = kRed;
+            rotate_left(grand);
+            break;
+        }
+    }
+    header->left->tag = kBlack;
+}
+
+// восстановление после удаления чёрного узла: поддереву node (возможно
+// пустому) с родителем parent не хватает одного чёрного узла
+void red_black_erase_fixup(TLinks* node, TLinks* parent,
+                           TLinks* header) noexcept {
+    while (node != header->left && !is_red(node)) {
+        if (node == parent->left) {
+            TLinks* sibling = parent->right;
+            if (is_red(sibling)) {
+                sibling->tag = kBlack;
+                parent->tag = kRed;
+                rotate_left(parent);
+                sibling = parent->right;
+            }
+            if (!is_red(sibling->left) && !is_red(sibling->right)) {
+                sibling->tag = kRed;
+                node = parent;
+                parent = parent->parent;
+                continue;
+            }
+            if (!is_red(sibling->right)) {
+                sibling->left->tag = kBlack;
+                sibling->tag = kRed;
+                rotate_right(sibling);
+                sibling = parent->right;
+            }
+            sibling->tag = parent->tag;
+            parent->tag = kBlack;
+            sibling->right->tag = kBlack;
+            rotate_left(parent);
+        } else {
+            TLinks* sibling = parent->left;
+            if (is_red(sibling)) {
+                sibling->tag = kBlack;
+                parent->tag = kRed;
+                rotate_right(parent);
+                sibling = parent->left;
+            }
+            if (!is_red(sibling->left) && !is_red(sibling->right)) {
+                sibling->tag = kRed;
+                node = parent;
+                parent = parent->parent;
+                continue;
+            }
+            if (!is_red(sibling->left)) {
+                sibling->right->tag = kBlack;
+                sibling->tag = kRed;
+                rotate_left(sibling);
+                sibling = parent->left;
+            }
+            sibling->tag = parent->tag;
+            parent->tag = kBlack;
+            sibling->left->tag = kBlack;
+            rotate_right(parent);
+        }
+        break;
+    }
+    if (node != nullptr) {
+        node->tag = kBlack;
+    }
+}
+
+// корень поддерева из nodes[0 .. count) - средний узел
+TLinks* middle_of(TLinks** nodes, size_t count) noexcept {
+    return count != 0 ? nodes[count / 2] : nullptr;
+}
+
+// все поля узла записываются в момент его посещения в симметричном
+// порядке (правый ребёнок известен заранее - это середина правой
+// части), поэтому узлы, созданные подряд, заполняются последовательно
+// в памяти, а не в прямом порядке обхода со скачками по всему массиву
+TLinks* build_subtree(TreeBalance balance, TLinks** nodes, size_t count,
+                      TLinks* parent, size_t depth,
+                      size_t red_depth) noexcept {
+    if (count == 0) {
+        return nullptr;
+    }
+    size_t middle = count / 2;
+    TLinks* node = nodes[middle];
+    TLinks* left = build_subtree(balance, nodes, middle, node, depth + 1,
+                                 red_depth);
+    TLinks** right = nodes + middle + 1;
+    size_t right_count = count - middle - 1;
+    node->left = left;
+    node->right = middle_of(right, right_count);
+    node->parent = parent;
+    node->size = static_cast<uint32_t>(count);
+    if (balance == TreeBalance::kAvl) {
+        // высота поддерева из count узлов - число двоичных разрядов count
+        uint8_t height = 0;
+        for (size_t rest = count; rest != 0; rest >>= 1) {
+            height++;
+        }
+        node->tag = height;
+    } else {
+        node->tag = depth == red_depth ? kRed : kBlack;
+    }
+    build_subtree(balance, right, right_count, node, depth + 1, red_depth);
+    return node;
+}
+
+// проверка поддерева; возвращает «чёрную высоту» у красно-чёрного
+// дерева или высоту у АВЛ, при нарушении - -1
+int check_subtree(TreeBalance balance, const TLinks* node) noexcept {
+    if (node == nullptr) {
+        return 0;
+    }
+    if ((node->left != nullptr && node->left->parent != node) ||
+        (node->right != nullptr && node->right->parent != node)) {
+        return -1;
+    }
+    if (node->size != size_of(node->left) + size_of(node->right) + 1) {
+        return -1;
+    }
+    int left = check_subtree(balance, node->left);
+    int right = check_subtree(balance, node->right);
+    if (left < 0 || right < 0) {
+        return -1;
+    }
+    if (balance == TreeBalance::kAvl) {
+        int height = std::max(left, right) + 1;
+        if (left - right > 1 || right - left > 1 || node->tag != height) {
+            return -1;
+        }
+        return height;
+    }
+    if (left != right || (node->tag != kRed && node->tag != kBlack)) {
+        return -1;
+    }
+    if (node->tag == kRed && (is_red(node->left) || is_red(node->right))) {
+        return -1;
+    }
+    return left + (node->tag == kBlack ? 1 : 0);
+}
+
+}  // namespace
+
+TLinks* select(TLinks* root, size_t k) noexcept {
+    TLinks* node = root;
+    while (true) {
+        size_t left = size_of(node->left);
+        if (k == left) {
+            return node;
+        }
+        if (k < left) {
+            node = node->left;
+        } else {
+            k -= left + 1;
+            node = node->right;
+        }
+    }
+}
+
+size_t rank(const TLinks* node, const TLinks* header) noexcept {
+    size_t result = size_of(node->left);
+    while (node->parent != header) {
+        if (node == node->parent->right) {
+            result += size_of(node->parent->left) + 1;
+        }
+        node = node->parent;
+    }
+    return result;
+}
+
+void insert_and_rebalance(TreeBalance balance, bool left, TLinks* node,
+                          TLinks* parent, TLinks* header) noexcept {
+    node->left = nullptr;
+    node->right = nullptr;
+    node->parent = parent;
+    node->size = 1;
+    if (left) {
+        parent->left = node;
+    } else {
+        parent->right = node;
+    }
+    if (balance == TreeBalance::kAvl) {
+        node->tag = 1;
+        avl_rebalance(parent, header);
+        return;
+    }
+    node->tag = kRed;
+    for (TLinks* up = parent; up != header; up = up->parent) {
+        up->size++;
+    }
+    red_black_insert_fixup(node, header);
+}
+
+void erase_and_rebalance(TreeBalance balance, TLinks* node,
+                         TLinks* header) noexcept {
+    // removed - узел, место которого в дереве освобождается: сам node,
+    // если у него меньше двух детей, иначе его преемник, который
+    // займёт место node. child встаёт на место removed
+    TLinks* removed = node;
+    if (node->left != nullptr && node->right != nullptr) {
+        removed = leftmost(node->right);
+    }
+    TLinks* child = removed->left != nullptr ? removed->left : removed->right;
+    for (TLinks* up = removed->parent; up != header; up = up->parent) {
+        up->size--;
+    }
+    TLinks* child_parent = removed->parent;
+    uint8_t removed_tag = removed->tag;
+    if (child != nullptr) {
+        child->parent = removed->parent;
+    }
+    replace_child(removed->parent, removed, child);
+    if (removed != node) {
+        // преемник занимает место node со всеми его полями
+        if (child_parent == node) {
+            child_parent = removed;
+        }
+        removed->left = node->left;
+        removed->right = node->right;
+        removed->parent = node->parent;
+        removed->size = node->size;
+        removed->tag = node->tag;
+        if (removed->left != nullptr) {
+            removed->left->parent = removed;
+        }
+        if (removed->right != nullptr) {
+            removed->right->parent = removed;
+        }
+        replace_child(node->parent, node, removed);
+    }
+    if (balance == TreeBalance::kAvl) {
+        avl_rebalance(child_parent, header);
+    } else if (removed_tag == kBlack) {
+        red_black_erase_fixup(child, child_parent, header);
+    }
+}
+
+void build(TreeBalance balance, TLinks** nodes, size_t count,
+           TLinks* header) noexcept {
+    // деление пополам даёт дерево, у которого все пустые ссылки на
+    // двух соседних глубинах; у красно-чёрного дерева неполный нижний
+    // уровень красный, остальные чёрные
+    size_t levels = 0;
+    while ((size_t(1) << levels) - 1 < count) {
+        levels++;
+    }
+    size_t red_depth = count == (size_t(1) << levels) - 1 ? SIZE_MAX
+                                                           : levels - 1;
+    header->left = build_subtree(balance, nodes, count, header, 0, red_depth);
+}
+
+size_t height(const TLinks* root) noexcept {
+    if (root == nullptr) {
+        return 0;
+    }
+    return std::max(height(root->left), height(root->right)) + 1;
+}
+
+bool check_structure(TreeBalance balance, const TLinks* header) noexcept {
+    const TLinks* root = header->left;
+    if (root == nullptr) {
+        return true;
+    }
+    if (root->parent != header) {
+        return false;
+    }
+    if (balance == TreeBalance::kRedBlack && root->tag != kBlack) {
+        return false;
+    }
+    return check_subtree(balance, root) >= 0;
+}
+
+}  // namespace tree_detail
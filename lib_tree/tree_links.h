@@ -0,0 +1,182 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_TREE_TREE_LINKS_H_
+#define LIB_TREE_TREE_LINKS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+// способ балансировки дерева поиска
+enum class TreeBalance {
+    kAvl,       // АВЛ: высоты поддеревьев отличаются не больше чем на 1
+    kRedBlack   // красно-чёрное: ниже на вставках и удалениях
+};
+
+namespace tree_detail {
+
+// Связи узла дерева поиска, общие для всех типов элементов: алгоритмы
+// балансировки работают только с ними и не зависят от шаблона дерева.
+// size - число узлов поддерева (для k-й порядковой статистики и ранга),
+// tag - высота поддерева у АВЛ или цвет у красно-чёрного дерева.
+// Дерево хранит заголовок: его left - корень, а сам он - родитель
+// корня, поэтому end() - это заголовок, а замена корня при поворотах
+// не требует отдельной ветки.
+struct TLinks {
+    TLinks* left;
+    TLinks* right;
+    TLinks* parent;
+    uint32_t size;
+    uint8_t tag;
+};
+
+const uint8_t kRed = 0;
+const uint8_t kBlack = 1;
+
+inline size_t size_of(const TLinks* node) noexcept {
+    return node != nullptr ? node->size : 0;
+}
+
+inline TLinks* leftmost(TLinks* node) noexcept {
+    while (node->left != nullptr) {
+        node = node->left;
+    }
+    return node;
+}
+
+inline TLinks* rightmost(TLinks* node) noexcept {
+    while (node->right != nullptr) {
+        node = node->right;
+    }
+    return node;
+}
+
+// следующий по порядку узел; за наибольшим идёт заголовок
+inline TLinks* next(TLinks* node) noexcept {
+    if (node->right != nullptr) {
+        return leftmost(node->right);
+    }
+    while (node == node->parent->right) {
+        node = node->parent;
+    }
+    return node->parent;
+}
+
+// предыдущий по порядку узел; для заголовка - наибольший (всё дерево -
+// левое поддерево заголовка)
+inline TLinks* prev(TLinks* node) noexcept {
+    if (node->left != nullptr) {
+        return rightmost(node->left);
+    }
+    while (node == node->parent->left) {
+        node = node->parent;
+    }
+    return node->parent;
+}
+
+// k-й по порядку узел поддерева root (с нуля), k < size_of(root)
+TLinks* select(TLinks* root, size_t k) noexcept;
+
+// число узлов дерева, меньших node
+size_t rank(const TLinks* node, const TLinks* header) noexcept;
+
+// подвешивает node левым (left) или правым ребёнком parent и
+// восстанавливает баланс; поля node заполняются здесь
+void insert_and_rebalance(TreeBalance balance, bool left, TLinks* node,
+                          TLinks* parent, TLinks* header) noexcept;
+
+// отцепляет node от дерева и восстанавливает баланс
+void erase_and_rebalance(TreeBalance balance, TLinks* node,
+                         TLinks* header) noexcept;
+
+// строит идеально сбалансированное дерево из count узлов, уже
+// упорядоченных по ключу, за O(n) и подвешивает его к заголовку
+void build(TreeBalance balance, TLinks** nodes, size_t count,
+           TLinks* header) noexcept;
+
+// высота дерева (пустое - 0)
+size_t height(const TLinks* root) noexcept;
+
+// проверка связей, размеров поддеревьев и инварианта балансировки
+bool check_structure(TreeBalance balance, const TLinks* header) noexcept;
+
+// двунаправленный итератор; Traits::value_of(TLinks*) возвращает
+// указатель на элемент узла
+template <class Traits, bool IsConst>
+class TTreeIterator {
+    using Value = typename Traits::value_type;
+
+ public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer =
+        typename std::conditional<IsConst, const Value*, Value*>::type;
+    using reference =
+        typename std::conditional<IsConst, const Value&, Value&>::type;
+
+    TTreeIterator() noexcept : links_(nullptr) {}
+    explicit TTreeIterator(TLinks* links) noexcept : links_(links) {}
+    // iterator -> const_iterator
+    template <bool OtherConst,
+              class = typename std::enable_if<IsConst && !OtherConst>::type>
+    TTreeIterator(const TTreeIterator<Traits, OtherConst>& other) noexcept
+        : links_(other.links()) {}
+
+    reference operator*() const noexcept { return *Traits::value_of(links_); }
+    pointer operator->() const noexcept { return Traits::value_of(links_); }
+
+    TTreeIterator& operator++() noexcept {
+        links_ = next(links_);
+        return *this;
+    }
+    TTreeIterator operator++(int) noexcept {
+        TTreeIterator copy(*this);
+        links_ = next(links_);
+        return copy;
+    }
+    TTreeIterator& operator--() noexcept {
+        links_ = prev(links_);
+        return *this;
+    }
+    TTreeIterator operator--(int) noexcept {
+        TTreeIterator copy(*this);
+        links_ = prev(links_);
+        return copy;
+    }
+
+    friend bool operator==(const TTreeIterator& left,
+                           const TTreeIterator& right) noexcept {
+        return left.links_ == right.links_;
+    }
+    friend bool operator!=(const TTreeIterator& left,
+                           const TTreeIterator& right) noexcept {
+        return left.links_ != right.links_;
+    }
+
+    // связи узла, на который указывает итератор (для реализации дерева)
+    TLinks* links() const noexcept { return links_; }
+
+ private:
+    TLinks* links_;
+};
+
+// пара итераторов для обхода диапазона циклом for
+template <class Iterator>
+class TIteratorRange {
+ public:
+    TIteratorRange(Iterator first, Iterator last)
+        : first_(first), last_(last) {}
+    Iterator begin() const { return first_; }
+    Iterator end() const { return last_; }
+    bool empty() const { return first_ == last_; }
+
+ private:
+    Iterator first_;
+    Iterator last_;
+};
+
+}  // namespace tree_detail
+
+#endif  // LIB_TREE_TREE_LINKS_H_
@@ -0,0 +1,344 @@
+// Copyright 2024 Marina Usova
+
+#ifndef LIB_VECTOR_VECTOR_H_
+#define LIB_VECTOR_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Признак того, что объект типа T можно перенести в другую память побайтовым
+// копированием, не вызывая конструктор перемещения и деструктор. По умолчанию
+// верно для тривиально копируемых типов; для своих типов (например, с
+// указателем на кучу, но без указателей на самого себя) можно
+// специализировать.
+template <class T>
+struct TIsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+// Динамический массив с настраиваемым коэффициентом роста
+// (GrowthNum / GrowthDen, по умолчанию 1.5) и встроенным буфером на
+// InlineCapacity элементов: пока элементов не больше InlineCapacity,
+// память в куче не выделяется.
+// Тривиально переносимые типы перемещаются при перевыделении через memcpy,
+// остальные - перемещением (или копированием, если перемещение может
+// бросить исключение).
+template <class T, size_t InlineCapacity = 0,
+          size_t GrowthNum = 3, size_t GrowthDen = 2>
+class TVector {
+    static_assert(GrowthNum > GrowthDen && GrowthDen > 0,
+                  "growth factor must be greater than 1");
+
+ public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    TVector() noexcept : data_(inline_data()), size_(0),
+                         capacity_(InlineCapacity) {}
+
+    explicit TVector(size_t size, const T& value = T()) : TVector() {
+        reserve(size);
+        std::uninitialized_fill_n(data_, size, value);
+        size_ = size;
+    }
+
+    TVector(std::initializer_list<T> values) : TVector() {
+        reserve(values.size());
+        std::uninitialized_copy(values.begin(), values.end(), data_);
+        size_ = values.size();
+    }
+
+    TVector(const TVector& other) : TVector() {
+        reserve(other.size_);
+        std::uninitialized_copy(other.begin(), other.end(), data_);
+        size_ = other.size_;
+    }
+
+    TVector(TVector&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value) : TVector() {
+        steal(std::move(other));
+    }
+
+    ~TVector() {
+        clear();
+        release();
+    }
+
+    TVector& operator=(const TVector& other) {
+        if (this != &other) {
+            TVector copy(other);
+            clear();
+            steal(std::move(copy));
+        }
+        return *this;
+    }
+
+    TVector& operator=(TVector&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            steal(std::move(other));
+        }
+        return *this;
+    }
+
+    size_t size() const noexcept { return size_; }
+    size_t capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0; }
+    // true, пока элементы хранятся во встроенном буфере
+    bool is_inline() const noexcept { return data_ == inline_data(); }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+
+    T& operator[](size_t index) noexcept { return data_[index]; }
+    const T& operator[](size_t index) const noexcept { return data_[index]; }
+
+    T& at(size_t index) {
+        check_index(index);
+        return data_[index];
+    }
+    const T& at(size_t index) const {
+        check_index(index);
+        return data_[index];
+    }
+
+    T& front() noexcept { return data_[0]; }
+    const T& front() const noexcept { return data_[0]; }
+    T& back() noexcept { return data_[size_ - 1]; }
+    const T& back() const noexcept { return data_[size_ - 1]; }
+
+    iterator begin() noexcept { return data_; }
+    iterator end() noexcept { return data_ + size_; }
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <class... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            // новый элемент строится до переноса старых: аргументы могут
+            // ссылаться на элементы самого вектора
+            size_t new_capacity = next_capacity(size_ + 1);
+            T* new_data = allocate(new_capacity);
+            try {
+                new (new_data + size_) T(std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_data);
+                throw;
+            }
+            try {
+                relocate(data_, size_, new_data);
+            } catch (...) {
+                new_data[size_].~T();
+                deallocate(new_data);
+                throw;
+            }
+            release();
+            data_ = new_data;
+            capacity_ = new_capacity;
+        } else {
+            new (data_ + size_) T(std::forward<Args>(args)...);
+        }
+        return data_[size_++];
+    }
+
+    void pop_back() noexcept {
+        data_[--size_].~T();
+    }
+
+    iterator insert(const_iterator position, const T& value) {
+        size_t index = static_cast<size_t>(position - data_);
+        T copy(value);
+        emplace_back(std::move(copy));
+        std::rotate(data_ + index, data_ + size_ - 1, data_ + size_);
+        return data_ + index;
+    }
+
+    iterator erase(const_iterator position) {
+        size_t index = static_cast<size_t>(position - data_);
+        std::move(data_ + index + 1, data_ + size_, data_ + index);
+        pop_back();
+        return data_ + index;
+    }
+
+    void clear() noexcept {
+        destroy(data_, size_);
+        size_ = 0;
+    }
+
+    void resize(size_t size, const T& value = T()) {
+        if (size < size_) {
+            destroy(data_ + size, size_ - size);
+        } else if (size > capacity_) {
+            T copy(value);  // value может быть элементом самого вектора
+            reserve(size);
+            std::uninitialized_fill_n(data_ + size_, size - size_, copy);
+        } else if (size > size_) {
+            std::uninitialized_fill_n(data_ + size_, size - size_, value);
+        }
+        size_ = size;
+    }
+
+    // гарантирует capacity() >= capacity без лишнего роста
+    void reserve(size_t capacity) {
+        if (capacity > capacity_) {
+            reallocate(capacity);
+        }
+    }
+
+    // отдаёт лишнюю память; небольшие массивы возвращаются
+    // во встроенный буфер
+    void shrink_to_fit() {
+        if (size_ == capacity_ || is_inline()) {
+            return;
+        }
+        if (size_ <= InlineCapacity) {
+            T* old_data = data_;
+            relocate(old_data, size_, inline_data());
+            deallocate(old_data);
+            data_ = inline_data();
+            capacity_ = InlineCapacity;
+        } else {
+            reallocate(size_);
+        }
+    }
+
+    void swap(TVector& other) {
+        TVector temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    friend bool operator==(const TVector& left, const TVector& right) {
+        return left.size_ == right.size_ &&
+               std::equal(left.begin(), left.end(), right.begin());
+    }
+    friend bool operator!=(const TVector& left, const TVector& right) {
+        return !(left == right);
+    }
+
+ private:
+    static constexpr bool kTriviallyRelocatable =
+        TIsTriviallyRelocatable<T>::value;
+
+    T* inline_data() noexcept {
+        return reinterpret_cast<T*>(inline_storage_);
+    }
+    const T* inline_data() const noexcept {
+        return reinterpret_cast<const T*>(inline_storage_);
+    }
+
+    void check_index(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("TVector: index is out of range");
+        }
+    }
+
+    size_t next_capacity(size_t required) const {
+        size_t grown = capacity_ * GrowthNum / GrowthDen;
+        return std::max<size_t>(std::max(grown, required), 4);
+    }
+
+    // типам с выравниванием больше, чем даёт обычный operator new,
+    // нужна выравнивающая форма (как в TFixedPool)
+    static constexpr bool kOverAligned =
+        alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    static T* allocate(size_t capacity) {
+        if constexpr (kOverAligned) {
+            return static_cast<T*>(::operator new(
+                capacity * sizeof(T), std::align_val_t(alignof(T))));
+        } else {
+            return static_cast<T*>(::operator new(capacity * sizeof(T)));
+        }
+    }
+
+    static void deallocate(T* data) noexcept {
+        if constexpr (kOverAligned) {
+            ::operator delete(data, std::align_val_t(alignof(T)));
+        } else {
+            ::operator delete(data);
+        }
+    }
+
+    // освобождает кучу (встроенный буфер не трогает), элементы уже удалены
+    void release() noexcept {
+        if (!is_inline()) {
+            deallocate(data_);
+        }
+    }
+
+    static void destroy(T* data, size_t count) noexcept {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < count; i++) {
+                data[i].~T();
+            }
+        }
+    }
+
+    // переносит count элементов в неинициализированную память to
+    static void relocate(T* from, size_t count, T* to) {
+        if (kTriviallyRelocatable) {
+            if (count != 0) {
+                std::memcpy(static_cast<void*>(to), from, count * sizeof(T));
+            }
+            return;
+        }
+        size_t i = 0;
+        try {
+            for (; i < count; i++) {
+                new (to + i) T(std::move_if_noexcept(from[i]));
+            }
+        } catch (...) {
+            destroy(to, i);
+            throw;
+        }
+        destroy(from, count);
+    }
+
+    void reallocate(size_t capacity) {
+        T* new_data = allocate(capacity);
+        try {
+            relocate(data_, size_, new_data);
+        } catch (...) {
+            deallocate(new_data);
+            throw;
+        }
+        release();
+        data_ = new_data;
+        capacity_ = capacity;
+    }
+
+    // забирает элементы other; *this должен быть пустым
+    void steal(TVector&& other) {
+        if (other.is_inline()) {
+            reserve(other.size_);
+            relocate(other.data_, other.size_, data_);
+        } else {
+            release();
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.capacity_ = InlineCapacity;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    T* data_;
+    size_t size_;
+    size_t capacity_;
+    alignas(T) unsigned char
+        inline_storage_[(InlineCapacity > 0 ? InlineCapacity : 1) * sizeof(T)];
+};
+
+#endif  // LIB_VECTOR_VECTOR_H_
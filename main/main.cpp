@@ -17,7 +17,7 @@ int main() {
       result = division(a, b);
       std::cout << a << " / " << b << " = "
           << std::setprecision(2) << result << std::endl;
-  } catch (std::exception err) {
+  } catch (const std::exception& err) {
       std::cerr << err.what() << std::endl;
   }
 
@@ -27,10 +27,18 @@ int main() {
       result = division(a, b);
       std::cout << a << " / " << b << " = "
           << std::setprecision(2) << result << std::endl;
-  } catch (std::exception err) {
+  } catch (const std::exception& err) {
       std::cerr << err.what() << std::endl;
   }
 
+  TExpected<float, ErrorCode> checked = try_division(a, b);
+  if (checked) {
+      std::cout << a << " / " << b << " = "
+          << std::setprecision(2) << checked.value() << std::endl;
+  } else {
+      std::cerr << error_message(checked.error()) << std::endl;
+  }
+
   return 0;
 }
 
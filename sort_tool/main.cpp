@@ -0,0 +1,110 @@
+// Copyright 2024 Marina Usova
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "../lib_external_sort/external_sort.h"
+
+namespace {
+
+bool starts_with(const std::string& text, const std::string& prefix,
+                 std::string* rest) {
+    if (text.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    *rest = text.substr(prefix.size());
+    return true;
+}
+
+void print_usage(const char* program) {
+    std::cerr << "Usage: " << program << " <input> <output>"
+              << " [--memory-mb=N] [--fan-in=N] [--io=pread|mmap]"
+              << " [--temp-dir=path] [--verify]" << std::endl
+              << "       " << program << " --generate=N <path> [--seed=S]"
+              << std::endl;
+}
+
+void print_phase(const char* name, double seconds, double mb_per_second) {
+    std::cout << std::left << std::setw(8) << name << std::right
+              << std::fixed << std::setprecision(3) << std::setw(10)
+              << seconds << " s" << std::setprecision(1) << std::setw(10)
+              << mb_per_second << " MB/s" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    TExternalSortOptions options;
+    std::string paths[2];
+    int path_count = 0;
+    uint64_t generate = 0;
+    uint64_t seed = 1;
+    bool verify = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value;
+        if (starts_with(arg, "--memory-mb=", &value)) {
+            options.memory_bytes =
+                static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10))
+                << 20;
+        } else if (starts_with(arg, "--fan-in=", &value)) {
+            options.fan_in =
+                static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        } else if (starts_with(arg, "--io=", &value) &&
+                   (value == "pread" || value == "mmap")) {
+            options.io_mode = value == "mmap" ? IoMode::kMmap : IoMode::kPread;
+        } else if (starts_with(arg, "--temp-dir=", &value)) {
+            options.temp_directory = value;
+        } else if (starts_with(arg, "--generate=", &value)) {
+            generate = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (starts_with(arg, "--seed=", &value)) {
+            seed = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (arg == "--verify") {
+            verify = true;
+        } else if (arg.compare(0, 2, "--") != 0 && path_count < 2) {
+            paths[path_count++] = arg;
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    try {
+        if (generate > 0) {
+            if (path_count != 1) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            generate_records(paths[0], generate, seed);
+            std::cout << "generated " << generate << " records" << std::endl;
+            return 0;
+        }
+        if (path_count != 2) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        TExternalSortStats stats = external_sort(paths[0], paths[1], options);
+        std::cout << stats.records << " records, "
+                  << stats.bytes / (1 << 20) << " MB, " << stats.runs
+                  << " runs, " << stats.merge_passes << " merge passes"
+                  << std::endl;
+        print_phase("runs", stats.run_seconds,
+                    stats.megabytes_per_second(stats.run_seconds));
+        print_phase("merge", stats.merge_seconds,
+                    stats.megabytes_per_second(stats.merge_seconds));
+        print_phase("total", stats.seconds(),
+                    stats.megabytes_per_second(stats.seconds()));
+        if (verify) {
+            bool sorted = is_sorted_file(paths[1], options.io_mode);
+            std::cout << (sorted ? "output is sorted" : "output is NOT sorted")
+                      << std::endl;
+            return sorted ? 0 : 2;
+        }
+    } catch (const std::exception& err) {
+        std::cerr << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,209 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../lib_bplus_tree/bplus_tree.h"
+
+namespace {
+
+template <class Key>
+size_t count_less_naive(const std::vector<Key>& keys, Key key) {
+    size_t result = 0;
+    for (Key value : keys) {
+        result += value < key ? 1 : 0;
+    }
+    return result;
+}
+
+// случайные вставки и удаления с проверкой инвариантов и сравнением с
+// std::map; маленький узел даёт высокое дерево и частые слияния
+template <class Tree>
+void check_random_operations(uint32_t seed, int key_range) {
+    std::mt19937 gen(seed);
+    Tree tree;
+    std::map<int64_t, int> reference;
+    for (int step = 0; step < 30000; step++) {
+        int64_t key = static_cast<int64_t>(gen() % key_range) - key_range / 2;
+        if (gen() % 5 < 2) {
+            ASSERT_EQ(reference.erase(key) == 1, tree.erase(key));
+        } else {
+            ASSERT_EQ(reference.insert({ key, step }).second,
+                      tree.insert(key, step));
+        }
+        if (step % 100 == 0) {
+            ASSERT_TRUE(tree.check_invariants());
+            ASSERT_EQ(reference.size(), tree.size());
+        }
+    }
+    ASSERT_TRUE(tree.check_invariants());
+    std::vector<std::pair<int64_t, int>> items;
+    for (auto it = tree.begin(); it != tree.end(); ++it) {
+        items.emplace_back(it.key(), it.value());
+    }
+    using TItems = std::vector<std::pair<int64_t, int>>;
+    ASSERT_EQ(TItems(reference.begin(), reference.end()), items);
+    // удаление всего до пустого дерева
+    for (const auto& item : reference) {
+        ASSERT_TRUE(tree.erase(item.first));
+    }
+    ASSERT_TRUE(tree.empty());
+    ASSERT_EQ(0u, tree.height());
+    ASSERT_TRUE(tree.check_invariants());
+}
+
+}  // namespace
+
+TEST(TestBPlusTreeLib, node_search_matches_scalar_on_all_simd_levels) {
+  std::mt19937_64 gen(1);
+  for (size_t count : { 0, 1, 3, 4, 7, 8, 9, 31, 41 }) {
+    std::vector<uint64_t> keys64(count);
+    std::vector<uint32_t> keys32(count);
+    for (size_t i = 0; i < count; i++) {
+      // старший бит проверяет беззнаковое сравнение
+      keys64[i] = gen() | (i % 2 == 0 ? uint64_t(1) << 63 : 0);
+      keys32[i] = static_cast<uint32_t>(keys64[i] >> 32);
+    }
+    for (SimdLevel level :
+         { SimdLevel::kScalar, SimdLevel::kSse41, SimdLevel::kAvx2 }) {
+      for (int probe = 0; probe < 50; probe++) {
+        uint64_t key = probe % 5 == 0 && count > 0 ?
+                       keys64[gen() % count] : gen();
+        uint32_t key32 = static_cast<uint32_t>(key >> 32);
+        ASSERT_EQ(count_less_naive(keys64, key),
+                  bplus_detail::count_less(keys64.data(), count, key, level));
+        ASSERT_EQ(count_less_naive(keys32, key32),
+                  bplus_detail::count_less(keys32.data(), count, key32,
+                                           level));
+      }
+    }
+  }
+}
+
+TEST(TestBPlusTreeLib, keeps_invariants_after_random_operations) {
+  check_random_operations<TBPlusTree<int64_t, int, 128>>(1, 5000);
+  check_random_operations<TBPlusTree<int64_t, int, 128>>(2, 500);
+  check_random_operations<TBPlusTree<int64_t, int>>(3, 20000);
+}
+
+TEST(TestBPlusTreeLib, nodes_fill_whole_cache_lines) {
+  using TTree = TBPlusTree<uint64_t, uint64_t>;
+
+  EXPECT_EQ(31u, TTree::kInnerCapacity);
+  EXPECT_EQ(30u, TTree::kLeafCapacity);
+  EXPECT_EQ(41u, (TBPlusTree<uint32_t, uint64_t>::kInnerCapacity));
+}
+
+TEST(TestBPlusTreeLib, can_build_from_sorted_input) {
+  for (size_t count : { 0, 1, 2, 30, 31, 61, 1000, 100000 }) {
+    // Arrange
+    std::vector<std::pair<uint32_t, uint32_t>> items;
+    for (size_t i = 0; i < count; i++) {
+      items.emplace_back(static_cast<uint32_t>(i * 3),
+                         static_cast<uint32_t>(i));
+    }
+    TBPlusTree<uint32_t, uint32_t> tree;
+    tree.insert(1, 1);
+
+    // Act
+    tree.assign_sorted(items);
+
+    // Assert
+    ASSERT_TRUE(tree.check_invariants());
+    ASSERT_EQ(count, tree.size());
+    EXPECT_FALSE(tree.contains(1));
+    if (count > 0) {
+      EXPECT_EQ(count - 1, tree.at(static_cast<uint32_t>(count - 1) * 3));
+    }
+    // дерево после построения остаётся рабочим
+    for (uint32_t key = 1; key < 3000; key += 3) {
+      tree.insert(key, key);
+    }
+    for (uint32_t key = 0; key < 3000; key += 6) {
+      tree.erase(key);
+    }
+    ASSERT_TRUE(tree.check_invariants());
+  }
+}
+
+TEST(TestBPlusTreeLib, throw_when_sorted_input_is_not_increasing) {
+  TBPlusTree<int, int> tree;
+
+  ASSERT_ANY_THROW(tree.assign_sorted({ { 1, 0 }, { 3, 0 }, { 2, 0 } }));
+  ASSERT_ANY_THROW(tree.assign_sorted({ { 1, 0 }, { 1, 0 } }));
+  ASSERT_NO_THROW(tree.assign_sorted({ { 1, 0 }, { 2, 0 } }));
+}
+
+TEST(TestBPlusTreeLib, can_scan_range_across_leaves) {
+  // Arrange
+  TBPlusTree<int, int, 128> tree;
+  for (int key = 0; key < 1000; key += 2) {
+    tree.insert(key, key / 2);
+  }
+
+  // Act
+  std::vector<int> keys;
+  int sum = 0;
+  size_t count = tree.scan(101, 201, [&](int key, int value) {
+    keys.push_back(key);
+    sum += value;
+  });
+
+  // Assert
+  EXPECT_EQ(50u, count);
+  EXPECT_EQ(102, keys.front());
+  EXPECT_EQ(200, keys.back());
+  EXPECT_EQ(3775, sum);
+  EXPECT_EQ(0u, tree.scan(201, 101, [](int, int) {}));
+  EXPECT_EQ(0u, tree.scan(2000, 3000, [](int, int) {}));
+  EXPECT_EQ(500u, tree.scan(-5, 5000, [](int, int) {}));
+}
+
+TEST(TestBPlusTreeLib, can_find_and_assign_values) {
+  // Arrange
+  TBPlusTree<int, std::string> tree;
+  for (int key = 0; key < 100; key++) {
+    tree.insert(key * 10, std::to_string(key));
+  }
+
+  // Act
+  bool inserted = tree.insert(50, "other");
+  tree.insert_or_assign(60, "six");
+  tree.find(70).value() = "seven";
+
+  // Assert
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ("5", tree.at(50));
+  EXPECT_EQ("six", tree.at(60));
+  EXPECT_EQ("seven", tree.at(70));
+  EXPECT_EQ(130, tree.lower_bound(121).key());
+  EXPECT_TRUE(tree.lower_bound(991) == tree.end());
+  EXPECT_TRUE(tree.find(55) == tree.end());
+}
+
+TEST(TestBPlusTreeLib, throw_when_key_is_missing) {
+  TBPlusTree<int, int> tree;
+  tree.insert(1, 1);
+
+  ASSERT_ANY_THROW(tree.at(2));
+  ASSERT_NO_THROW(tree.at(1));
+}
+
+TEST(TestBPlusTreeLib, can_move) {
+  TBPlusTree<int, int> tree;
+  for (int key = 0; key < 500; key++) {
+    tree.insert(key, key);
+  }
+
+  TBPlusTree<int, int> moved(std::move(tree));
+  tree.insert(1, 1);
+
+  EXPECT_EQ(500u, moved.size());
+  EXPECT_EQ(1u, tree.size());
+  EXPECT_TRUE(moved.check_invariants());
+  EXPECT_TRUE(tree.check_invariants());
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include "../lib_cpu_features/cpu_features.h"
+
+TEST(TestCpuFeaturesLib, detection_is_stable) {
+  // Act
+  SimdLevel first = detect_simd_level();
+  bool first_fma = detect_fma();
+
+  // Assert
+  EXPECT_EQ(first, detect_simd_level());
+  EXPECT_EQ(first_fma, detect_fma());
+}
+
+TEST(TestCpuFeaturesLib, fma_is_reported_only_with_avx2) {
+  // Act & Assert
+  if (detect_fma()) {
+    EXPECT_EQ(SimdLevel::kAvx2, detect_simd_level());
+  }
+}
@@ -0,0 +1,167 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include "../lib_deque/chunked_deque.h"
+
+TEST(TestDequeLib, chunk_size_is_rounded_to_power_of_two) {
+  // Arrange & Act
+  TChunkedDeque<int> deque(100);
+
+  // Assert
+  EXPECT_EQ(128u, deque.chunk_size());
+  ASSERT_ANY_THROW(TChunkedDeque<int>(0));
+}
+
+TEST(TestDequeLib, can_push_and_pop_at_both_ends) {
+  // Arrange
+  TChunkedDeque<int> deque(4);
+
+  // Act
+  for (int i = 0; i < 10; i++) {
+    deque.push_back(i);
+    deque.push_front(-i - 1);
+  }
+
+  // Assert
+  ASSERT_EQ(20u, deque.size());
+  EXPECT_EQ(-10, deque.front());
+  EXPECT_EQ(9, deque.back());
+  for (int i = 0; i < 20; i++) {
+    EXPECT_EQ(i - 10, deque[i]);
+  }
+  deque.pop_front();
+  deque.pop_back();
+  EXPECT_EQ(-9, deque.front());
+  EXPECT_EQ(8, deque.back());
+}
+
+TEST(TestDequeLib, references_stay_valid_when_growing) {
+  // Arrange
+  TChunkedDeque<int> deque(8);
+  deque.push_back(42);
+  int* first = &deque.front();
+
+  // Act
+  for (int i = 0; i < 1000; i++) {
+    deque.push_back(i);
+    deque.push_front(i);
+  }
+
+  // Assert
+  EXPECT_EQ(42, *first);
+  EXPECT_EQ(first, &deque[1000]);
+}
+
+TEST(TestDequeLib, chunks_are_recycled) {
+  // Arrange
+  TChunkedDeque<int> deque(16, 8);
+  auto crawl = [&deque]() {
+    for (int i = 0; i < 50; i++) {
+      deque.push_back(i);
+    }
+    for (int i = 0; i < 50; i++) {
+      deque.pop_front();
+    }
+  };
+  for (int i = 0; i < 100; i++) {
+    deque.push_back(i);
+  }
+  // за 16 шагов голова проходит все смещения внутри блока
+  for (int round = 0; round < 16; round++) {
+    crawl();
+  }
+  size_t allocations = deque.chunk_allocations();
+
+  // Act: очередь «ползёт» вперёд, размер колеблется от 100 до 150
+  for (int round = 0; round < 1000; round++) {
+    crawl();
+  }
+
+  // Assert
+  EXPECT_EQ(100u, deque.size());
+  EXPECT_EQ(allocations, deque.chunk_allocations());
+  EXPECT_LE(deque.spare_chunks(), 8u);
+}
+
+TEST(TestDequeLib, shrink_to_fit_releases_spare_chunks) {
+  // Arrange
+  TChunkedDeque<int> deque(16);
+  for (int i = 0; i < 100; i++) {
+    deque.push_back(i);
+  }
+
+  // Act
+  deque.clear();
+  size_t spare = deque.spare_chunks();
+  deque.shrink_to_fit();
+
+  // Assert
+  EXPECT_GT(spare, 0u);
+  EXPECT_EQ(0u, deque.spare_chunks());
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST(TestDequeLib, behaves_like_std_deque_on_random_operations) {
+  // Arrange
+  TChunkedDeque<std::string> deque(4, 2);
+  std::deque<std::string> expected;
+  std::mt19937 gen(21);
+
+  for (int step = 0; step < 20000; step++) {
+    // Act
+    int action = static_cast<int>(gen() % 4);
+    if (expected.empty() || action == 0) {
+      deque.push_back(std::to_string(step));
+      expected.push_back(std::to_string(step));
+    } else if (action == 1) {
+      deque.push_front(std::to_string(step));
+      expected.push_front(std::to_string(step));
+    } else if (action == 2) {
+      deque.pop_back();
+      expected.pop_back();
+    } else {
+      deque.pop_front();
+      expected.pop_front();
+    }
+
+    // Assert
+    ASSERT_EQ(expected.size(), deque.size());
+    if (!expected.empty()) {
+      ASSERT_EQ(expected.front(), deque.front());
+      ASSERT_EQ(expected.back(), deque.back());
+    }
+  }
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), deque.begin()));
+}
+
+TEST(TestDequeLib, can_copy_and_move) {
+  // Arrange
+  TChunkedDeque<std::unique_ptr<int>> owners(4);
+  TChunkedDeque<int> deque(4);
+  for (int i = 0; i < 10; i++) {
+    deque.push_back(i);
+    owners.emplace_back(new int(i));
+  }
+
+  // Act
+  TChunkedDeque<int> copy(deque);
+  TChunkedDeque<std::unique_ptr<int>> moved(std::move(owners));
+
+  // Assert
+  EXPECT_TRUE(std::equal(deque.begin(), deque.end(), copy.begin()));
+  EXPECT_EQ(9, *moved.back());
+  EXPECT_TRUE(owners.empty());
+}
+
+TEST(TestDequeLib, throw_when_index_is_out_of_range) {
+  // Arrange
+  TChunkedDeque<int> deque;
+  deque.push_back(1);
+
+  // Act & Assert
+  ASSERT_ANY_THROW(deque.at(1));
+}
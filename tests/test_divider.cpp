@@ -0,0 +1,111 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../lib_easy_example/divider.h"
+#include "../lib_easy_example/easy_example.h"
+
+namespace {
+
+// граничные значения делимых и делителей
+std::vector<int> edge_values() {
+  std::vector<int> values = { 0, 1, -1, 2, -2, 3, -3, 5, 7, -7, 10, 641,
+                              INT_MAX, INT_MAX - 1, INT_MIN, INT_MIN + 1 };
+  for (int k = 1; k < 31; k++) {
+    values.push_back(1 << k);
+    values.push_back(-(1 << k));
+    values.push_back((1 << k) + 1);
+    values.push_back((1 << k) - 1);
+    values.push_back(-(1 << k) - 1);
+  }
+  return values;
+}
+
+int expected_quotient(int a, int b) {
+  // в int64_t переполнения INT_MIN / -1 нет, а результат приводим к int
+  return static_cast<int>(static_cast<uint32_t>(
+      static_cast<int64_t>(a) / b));
+}
+
+}  // namespace
+
+TEST(TestDividerLib, throw_when_divisor_is_zero) {
+  // Act & Assert
+  ASSERT_ANY_THROW(Divider(0));
+}
+
+TEST(TestDividerLib, can_get_quotient_correctly_on_edge_values) {
+  // Arrange
+  std::vector<int> values = edge_values();
+
+  for (int b : values) {
+    if (b == 0) {
+      continue;
+    }
+    Divider divider(b);
+    for (int a : values) {
+      // Act & Assert
+      ASSERT_EQ(expected_quotient(a, b), divider.quotient(a))
+          << a << " / " << b;
+    }
+  }
+}
+
+TEST(TestDividerLib, can_divide_as_division_on_edge_values) {
+  // Arrange
+  std::vector<int> values = edge_values();
+
+  for (int b : values) {
+    if (b == 0) {
+      continue;
+    }
+    Divider divider(b);
+    for (int a : values) {
+      // Act & Assert
+      ASSERT_EQ(division(a, b), divider.divide(a)) << a << " / " << b;
+    }
+  }
+}
+
+TEST(TestDividerLib, can_divide_correctly_on_random_values) {
+  // Arrange
+  std::mt19937 gen(2024);
+  std::uniform_int_distribution<int> any(INT_MIN, INT_MAX);
+  std::uniform_int_distribution<int> small(-1000, 1000);
+
+  for (int i = 0; i < 2000; i++) {
+    int b = (i % 2 == 0) ? any(gen) : small(gen);
+    if (b == 0) {
+      continue;
+    }
+    Divider divider(b);
+    for (int j = 0; j < 200; j++) {
+      int a = any(gen);
+      // Act & Assert
+      ASSERT_EQ(expected_quotient(a, b), divider.quotient(a))
+          << a << " / " << b;
+      ASSERT_EQ(division(a, b), divider.divide(a)) << a << " / " << b;
+    }
+  }
+}
+
+TEST(TestDividerLib, can_divide_batch) {
+  // Arrange
+  Divider divider(-3);
+  int numerators[] = { 9, 10, -11, 0, INT_MIN };
+  int quotients[5];
+  float results[5];
+
+  // Act
+  divider.quotient(numerators, quotients, 5);
+  divider.divide(numerators, results, 5);
+
+  // Assert
+  for (int i = 0; i < 5; i++) {
+    EXPECT_EQ(numerators[i] / -3, quotients[i]);
+    EXPECT_EQ(division(numerators[i], -3), results[i]);
+  }
+}
@@ -0,0 +1,280 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <thread>  // NOLINT [build/c++11]
+#include <vector>
+#include "../lib_dsu/concurrent_dsu.h"
+#include "../lib_dsu/dsu.h"
+#include "../lib_dsu/rollback_dsu.h"
+#include "../lib_parallel/thread_pool.h"
+
+namespace {
+
+std::vector<TDsuEdge> random_edges(size_t vertices, size_t count,
+                                   uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::vector<TDsuEdge> edges(count);
+    for (TDsuEdge& edge : edges) {
+        edge.a = static_cast<uint32_t>(gen() % vertices);
+        edge.b = static_cast<uint32_t>(gen() % vertices);
+    }
+    return edges;
+}
+
+// метки компонент, вычисленные последовательно без сжатия путей
+std::vector<uint32_t> reference_labels(size_t vertices,
+                                       const std::vector<TDsuEdge>& edges) {
+    TDisjointSets<PathMode::kNone> dsu(vertices);
+    for (const TDsuEdge& edge : edges) {
+        dsu.unite(edge.a, edge.b);
+    }
+    std::vector<uint32_t> labels(vertices);
+    for (uint32_t v = 0; v < vertices; v++) {
+        labels[v] = dsu.find(v);
+    }
+    return labels;
+}
+
+// два разбиения совпадают, если элементы попарно в одном множестве
+// одновременно в обоих (достаточно сравнить с первым элементом
+// множества)
+bool same_partition(const std::vector<uint32_t>& a,
+                    const std::vector<uint32_t>& b) {
+    std::vector<uint32_t> first_a(a.size(), UINT32_MAX);
+    std::vector<uint32_t> first_b(b.size(), UINT32_MAX);
+    for (uint32_t v = 0; v < a.size(); v++) {
+        if (first_a[a[v]] == UINT32_MAX) {
+            first_a[a[v]] = v;
+        }
+        if (first_b[b[v]] == UINT32_MAX) {
+            first_b[b[v]] = v;
+        }
+        if (first_a[a[v]] != first_b[b[v]]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <PathMode Mode>
+void check_unite_and_find() {
+    TDisjointSets<Mode> dsu(10);
+    EXPECT_TRUE(dsu.unite(0, 1));
+    EXPECT_TRUE(dsu.unite(2, 3));
+    EXPECT_TRUE(dsu.unite(1, 3));
+    EXPECT_FALSE(dsu.unite(0, 2));
+    EXPECT_TRUE(dsu.same(0, 3));
+    EXPECT_FALSE(dsu.same(0, 4));
+    EXPECT_EQ(4u, dsu.set_size(2));
+    EXPECT_EQ(1u, dsu.set_size(9));
+    EXPECT_EQ(7u, dsu.set_count());
+}
+
+template <PathMode Mode>
+void check_matches_reference() {
+    const size_t kVertices = 3000;
+    std::vector<TDsuEdge> edges = random_edges(kVertices, 2000, 5);
+    TDisjointSets<Mode> dsu(kVertices);
+    for (const TDsuEdge& edge : edges) {
+        dsu.unite(edge.a, edge.b);
+    }
+    std::vector<uint32_t> labels(kVertices);
+    for (uint32_t v = 0; v < kVertices; v++) {
+        labels[v] = dsu.find(v);
+    }
+    EXPECT_TRUE(same_partition(reference_labels(kVertices, edges), labels));
+}
+
+}  // namespace
+
+TEST(TestDsuLib, can_unite_and_find_with_every_path_mode) {
+  check_unite_and_find<PathMode::kNone>();
+  check_unite_and_find<PathMode::kHalving>();
+  check_unite_and_find<PathMode::kCompression>();
+}
+
+TEST(TestDsuLib, path_modes_give_same_partition) {
+  check_matches_reference<PathMode::kHalving>();
+  check_matches_reference<PathMode::kCompression>();
+}
+
+TEST(TestDsuLib, can_add_and_reset) {
+  // Arrange
+  TDisjointSets<> dsu(2);
+  dsu.unite(0, 1);
+
+  // Act
+  uint32_t added = dsu.add();
+  dsu.unite(added, 0);
+
+  // Assert
+  EXPECT_EQ(2u, added);
+  EXPECT_EQ(3u, dsu.set_size(1));
+  EXPECT_EQ(1u, dsu.set_count());
+  dsu.reset();
+  EXPECT_EQ(3u, dsu.set_count());
+  EXPECT_FALSE(dsu.same(0, 2));
+}
+
+TEST(TestDsuLib, throw_when_index_out_of_range) {
+  TDisjointSets<> dsu(3);
+  TRollbackDsu rollback(3);
+  TConcurrentDsu concurrent(3);
+
+  ASSERT_ANY_THROW(dsu.find(3));
+  ASSERT_ANY_THROW(dsu.unite(0, 5));
+  ASSERT_ANY_THROW(rollback.unite(3, 0));
+  ASSERT_ANY_THROW(concurrent.unite(0, 3));
+  ASSERT_ANY_THROW(concurrent.same(4, 0));
+}
+
+TEST(TestDsuLib, can_rollback_to_checkpoint) {
+  // Arrange
+  TRollbackDsu dsu(6);
+  dsu.unite(0, 1);
+  dsu.unite(2, 3);
+  size_t checkpoint = dsu.checkpoint();
+
+  // Act
+  dsu.unite(1, 2);
+  dsu.unite(4, 5);
+  EXPECT_FALSE(dsu.unite(0, 3));
+  dsu.rollback(checkpoint);
+
+  // Assert
+  EXPECT_EQ(checkpoint, dsu.checkpoint());
+  EXPECT_EQ(4u, dsu.set_count());
+  EXPECT_TRUE(dsu.same(0, 1));
+  EXPECT_TRUE(dsu.same(2, 3));
+  EXPECT_FALSE(dsu.same(1, 2));
+  EXPECT_FALSE(dsu.same(4, 5));
+  EXPECT_EQ(2u, dsu.set_size(3));
+}
+
+TEST(TestDsuLib, nested_rollbacks_restore_every_state) {
+  // Arrange: после каждого объединения запоминаем отметку и метки
+  const size_t kVertices = 200;
+  std::vector<TDsuEdge> edges = random_edges(kVertices, 300, 7);
+  TRollbackDsu dsu(kVertices);
+  std::vector<size_t> checkpoints;
+  std::vector<std::vector<uint32_t>> states;
+  auto labels = [&]() {
+    std::vector<uint32_t> result(kVertices);
+    for (uint32_t v = 0; v < kVertices; v++) {
+      result[v] = dsu.find(v);
+    }
+    return result;
+  };
+  for (const TDsuEdge& edge : edges) {
+    checkpoints.push_back(dsu.checkpoint());
+    states.push_back(labels());
+    dsu.unite(edge.a, edge.b);
+  }
+
+  // Act & Assert: откатываемся в обратном порядке
+  for (size_t i = edges.size(); i-- > 0;) {
+    dsu.rollback(checkpoints[i]);
+    ASSERT_EQ(states[i], labels());
+  }
+  EXPECT_EQ(kVertices, dsu.set_count());
+}
+
+TEST(TestDsuLib, can_undo_last_union) {
+  TRollbackDsu dsu(3);
+  dsu.unite(0, 1);
+  dsu.unite(1, 2);
+
+  dsu.undo();
+
+  EXPECT_TRUE(dsu.same(0, 1));
+  EXPECT_FALSE(dsu.same(0, 2));
+  EXPECT_EQ(2u, dsu.set_count());
+}
+
+TEST(TestDsuLib, throw_when_rollback_is_invalid) {
+  TRollbackDsu dsu(3);
+  dsu.unite(0, 1);
+
+  ASSERT_ANY_THROW(dsu.rollback(2));
+  dsu.undo();
+  ASSERT_ANY_THROW(dsu.undo());
+}
+
+TEST(TestDsuLib, concurrent_unions_from_threads_match_sequential) {
+  // Arrange
+  const size_t kVertices = 1 << 14;
+  const size_t kThreads = 4;
+  std::vector<TDsuEdge> edges = random_edges(kVertices, 12000, 11);
+  TConcurrentDsu dsu(kVertices);
+  std::vector<size_t> successes(kThreads, 0);
+
+  // Act: потоки берут рёбра через одно
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; t++) {
+    threads.emplace_back([&, t]() {
+      for (size_t i = t; i < edges.size(); i += kThreads) {
+        successes[t] += dsu.unite(edges[i].a, edges[i].b);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  // Assert: каждое успешное объединение уменьшило число множеств на 1
+  size_t total = 0;
+  for (size_t count : successes) {
+    total += count;
+  }
+  EXPECT_EQ(kVertices - total, dsu.set_count());
+  EXPECT_TRUE(same_partition(reference_labels(kVertices, edges),
+                             dsu.labels()));
+}
+
+TEST(TestDsuLib, concurrent_linking_of_same_sets_succeeds_once) {
+  // Arrange: все потоки сливают одну и ту же цепочку
+  const size_t kVertices = 4096;
+  const size_t kThreads = 4;
+  TConcurrentDsu dsu(kVertices);
+  std::vector<size_t> successes(kThreads, 0);
+
+  // Act
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; t++) {
+    threads.emplace_back([&, t]() {
+      for (uint32_t v = 1; v < kVertices; v++) {
+        successes[t] += dsu.unite(v - 1, v);
+        EXPECT_TRUE(dsu.same(0, v));
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  // Assert
+  size_t total = 0;
+  for (size_t count : successes) {
+    total += count;
+  }
+  EXPECT_EQ(kVertices - 1, total);
+  EXPECT_EQ(1u, dsu.set_count());
+}
+
+TEST(TestDsuLib, can_unite_edges_with_thread_pool) {
+  // Arrange
+  const size_t kVertices = 50000;
+  std::vector<TDsuEdge> edges = random_edges(kVertices, 40000, 13);
+  TThreadPool pool(4);
+  TConcurrentDsu dsu(kVertices);
+
+  // Act
+  parallel_unite(&pool, &dsu, edges.data(), edges.size());
+
+  // Assert
+  EXPECT_TRUE(same_partition(reference_labels(kVertices, edges),
+                             dsu.labels()));
+}
@@ -1,6 +1,10 @@
 // Copyright 2024 Marina Usova
 
 #include <gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include "../lib_easy_example/division_inline.h"
 #include "../lib_easy_example/easy_example.h"
 
 #define EPSILON 0.000001
@@ -48,3 +52,121 @@ TEST(TestEasyExampleLib, throw_when_try_div_by_zero) {
   // Act & Assert
   ASSERT_ANY_THROW(division(x, y));
 }
+
+TEST(TestEasyExampleLib, can_div_batch_correctly_on_every_simd_level) {
+  // Arrange
+  const size_t count = 37;  // не кратно ширине регистра - проверяем хвост
+  int a[count], b[count];
+  for (size_t i = 0; i < count; i++) {
+    a[i] = static_cast<int>(i * 7919) - 100000;
+    b[i] = static_cast<int>(i % 13) - 6;
+  }
+  SimdLevel levels[] = { SimdLevel::kScalar, SimdLevel::kSse41,
+                         SimdLevel::kAvx2 };
+
+  for (SimdLevel level : levels) {
+    // Act
+    float result[count];
+    uint8_t zero_mask[count];
+    size_t zeros = division_batch(a, b, result, count, zero_mask, level);
+
+    // Assert
+    size_t expected_zeros = 0;
+    for (size_t i = 0; i < count; i++) {
+      if (b[i] == 0) {
+        expected_zeros++;
+        EXPECT_EQ(1, zero_mask[i]);
+        EXPECT_TRUE(std::isnan(result[i]));
+      } else {
+        EXPECT_EQ(0, zero_mask[i]);
+        EXPECT_EQ(division(a[i], b[i]), result[i]);
+      }
+    }
+    EXPECT_EQ(expected_zeros, zeros);
+  }
+}
+
+TEST(TestEasyExampleLib, can_div_batch_without_zero_mask) {
+  // Arrange
+  int a[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+  int b[] = { 4, 0, 1, 2, 0, 3, 7, 0, 2 };
+  float result[9];
+
+  // Act
+  size_t zeros = division_batch(a, b, result, 9);
+
+  // Assert
+  EXPECT_EQ(3u, zeros);
+  EXPECT_NEAR(0.25, result[0], EPSILON);
+  EXPECT_NEAR(4.5, result[8], EPSILON);
+}
+
+TEST(TestEasyExampleLib, can_div_empty_batch) {
+  // Act & Assert
+  EXPECT_EQ(0u, division_batch(nullptr, nullptr, nullptr, 0));
+}
+
+TEST(TestEasyExampleLib, can_try_div_correctly) {
+  // Act
+  TExpected<float, ErrorCode> result = try_division(5, 4);
+
+  // Assert
+  ASSERT_TRUE(result.has_value());
+  EXPECT_NEAR(1.25, result.value(), EPSILON);
+}
+
+TEST(TestEasyExampleLib, try_div_by_zero_returns_error_code) {
+  // Act
+  TExpected<float, ErrorCode> result = try_division(10, 0);
+
+  // Assert
+  ASSERT_FALSE(result);
+  EXPECT_EQ(ErrorCode::kDivisionByZero, result.error());
+  EXPECT_EQ(-1.0f, result.value_or(-1.0f));
+}
+
+TEST(TestEasyExampleLib, div_by_zero_throws_message_of_error_code) {
+  // Act & Assert
+  try {
+    division(10, 0);
+    FAIL();
+  } catch (const std::invalid_argument& err) {
+    EXPECT_STREQ(error_message(ErrorCode::kDivisionByZero), err.what());
+  }
+}
+
+TEST(TestEasyExampleLib, inline_div_matches_division) {
+  // Arrange
+  int values[] = { -7, -1, 1, 3, 10, 1 << 30 };
+
+  for (int a : values) {
+    for (int b : values) {
+      // Act & Assert
+      EXPECT_EQ(division(a, b), inline_division(a, b));
+    }
+  }
+}
+
+TEST(TestEasyExampleLib, inline_div_chooses_result_type) {
+  // Act & Assert
+  EXPECT_TRUE((std::is_same<float, division_result_t<int, int>>::value));
+  EXPECT_TRUE((std::is_same<float, division_result_t<char, float>>::value));
+  EXPECT_TRUE((std::is_same<double, division_result_t<int, double>>::value));
+  EXPECT_TRUE((std::is_same<long double,
+                            division_result_t<float, long double>>::value));
+}
+
+TEST(TestEasyExampleLib, can_inline_div_at_compile_time) {
+  // Arrange
+  constexpr float result = inline_division(5, 4);
+
+  // Act & Assert
+  static_assert(result == 1.25f, "inline_division is not constexpr");
+  EXPECT_NEAR(2.5, inline_division(5.0, 2), EPSILON);
+}
+
+TEST(TestEasyExampleLib, throw_when_try_inline_div_by_zero) {
+  // Act & Assert
+  ASSERT_ANY_THROW(inline_division(10, 0));
+  ASSERT_ANY_THROW(inline_division(1.5, 0.0));
+}
@@ -0,0 +1,164 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "../lib_expression/expression.h"
+#include "../lib_expression/tokenizer.h"
+
+namespace {
+
+// обратная польская запись лексем через пробел
+std::string postfix_text(const std::string& expression) {
+  std::string result;
+  for (const TToken& token : to_postfix(tokenize(expression))) {
+    if (!result.empty()) {
+      result += ' ';
+    }
+    result += token.text;
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(TestExpressionLib, can_tokenize_expression) {
+  // Arrange & Act
+  std::vector<TToken> tokens = tokenize("-price * (1.5e1 + tax_2)");
+
+  // Assert
+  ASSERT_EQ(8u, tokens.size());
+  EXPECT_EQ("~", tokens[0].text);
+  EXPECT_EQ(TokenType::kIdentifier, tokens[1].type);
+  EXPECT_EQ(TokenType::kLeftParen, tokens[3].type);
+  EXPECT_DOUBLE_EQ(15.0, tokens[4].value);
+  EXPECT_EQ("tax_2", tokens[6].text);
+  EXPECT_EQ(18u, tokens[6].position);
+}
+
+TEST(TestExpressionLib, shunting_yard_respects_precedence) {
+  // Act & Assert
+  EXPECT_EQ("a b c * +", postfix_text("a + b * c"));
+  EXPECT_EQ("a b + c *", postfix_text("(a + b) * c"));
+  EXPECT_EQ("a b - c -", postfix_text("a - b - c"));
+  EXPECT_EQ("a ~ b *", postfix_text("-a * b"));
+  EXPECT_EQ("a b ~ ~ -", postfix_text("a - - -b"));
+  EXPECT_EQ("a b /", postfix_text("+a / +b"));
+}
+
+TEST(TestExpressionLib, throw_when_syntax_is_wrong) {
+  // Act & Assert
+  ASSERT_ANY_THROW(tokenize("a $ b"));
+  ASSERT_ANY_THROW(tokenize("a * / b"));
+  ASSERT_ANY_THROW(to_postfix(tokenize("(a + b")));
+  ASSERT_ANY_THROW(to_postfix(tokenize("a + b)")));
+  ASSERT_ANY_THROW(to_postfix(tokenize("a b")));
+  ASSERT_ANY_THROW(to_postfix(tokenize("a +")));
+  ASSERT_ANY_THROW(to_postfix(tokenize("")));
+}
+
+TEST(TestExpressionLib, throw_when_column_is_unknown) {
+  // Act & Assert
+  ASSERT_ANY_THROW(compile_expression("x + y", { "x" }));
+}
+
+TEST(TestExpressionLib, constants_are_folded) {
+  // Arrange & Act
+  TCompiledExpression expression =
+      compile_expression("x * (2 + 3 * 4) - -(1 / 4)", { "x" });
+
+  // Assert
+  EXPECT_EQ("load_column 0\nmul_const 14\nsub_const -0.25\n",
+            expression.disassemble());
+  EXPECT_EQ(1u, expression.stack_depth());
+}
+
+TEST(TestExpressionLib, division_by_constant_zero_is_not_folded) {
+  // Arrange & Act
+  TCompiledExpression expression = compile_expression("1 / 0", {});
+
+  // Assert
+  EXPECT_EQ("push_const 1\ndiv_const 0\n", expression.disassemble());
+  ASSERT_ANY_THROW(expression.evaluate(nullptr));
+}
+
+TEST(TestExpressionLib, can_evaluate_single_row) {
+  // Arrange
+  TCompiledExpression expression =
+      compile_expression("(a + b) * c - a / b", { "a", "b", "c" });
+  double row[] = { 6, 3, 2 };
+
+  // Act & Assert
+  EXPECT_DOUBLE_EQ(16.0, expression.evaluate(row));
+}
+
+TEST(TestExpressionLib, try_evaluate_reports_division_by_zero) {
+  // Arrange
+  TCompiledExpression expression = compile_expression("a / b", { "a", "b" });
+  double row[] = { 1, 0 };
+
+  // Act
+  TExpected<double, ErrorCode> result = expression.try_evaluate(row);
+
+  // Assert
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(ErrorCode::kDivisionByZero, result.error());
+  ASSERT_ANY_THROW(expression.evaluate(row));
+}
+
+TEST(TestExpressionLib, batch_matches_row_by_row) {
+  // Arrange
+  const size_t kRows = 1000;
+  TCompiledExpression expression = compile_expression(
+      "-(price * qty) + price / (qty - 3) * 2 - (1 - qty) * -price",
+      { "price", "qty" });
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> value(0, 6);
+  std::vector<double> price(kRows), qty(kRows);
+  for (size_t i = 0; i < kRows; i++) {
+    price[i] = value(gen) + 0.5;
+    qty[i] = value(gen);
+  }
+  const double* columns[] = { price.data(), qty.data() };
+  std::vector<double> result(kRows);
+  std::vector<uint8_t> zero_mask(kRows);
+
+  // Act
+  size_t zeros = expression.evaluate_batch(columns, kRows, result.data(),
+                                           zero_mask.data());
+
+  // Assert
+  size_t expected_zeros = 0;
+  for (size_t i = 0; i < kRows; i++) {
+    double row[] = { price[i], qty[i] };
+    TExpected<double, ErrorCode> single = expression.try_evaluate(row);
+    if (single) {
+      EXPECT_EQ(0, zero_mask[i]);
+      EXPECT_DOUBLE_EQ(single.value(), result[i]);
+    } else {
+      EXPECT_EQ(1, zero_mask[i]);
+      EXPECT_TRUE(std::isnan(result[i]));
+      expected_zeros++;
+    }
+  }
+  EXPECT_EQ(expected_zeros, zeros);
+  EXPECT_GT(zeros, 0u);
+}
+
+TEST(TestExpressionLib, batch_marks_all_rows_on_constant_zero_divisor) {
+  // Arrange
+  TCompiledExpression expression = compile_expression("x / (2 - 2)", { "x" });
+  std::vector<double> x(300, 1.0);
+  const double* columns[] = { x.data() };
+  std::vector<double> result(300);
+
+  // Act
+  size_t zeros = expression.evaluate_batch(columns, 300, result.data());
+
+  // Assert
+  EXPECT_EQ(300u, zeros);
+  EXPECT_TRUE(std::isnan(result[299]));
+}
@@ -0,0 +1,275 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../lib_external_sort/external_sort.h"
+#include "../lib_external_sort/loser_tree.h"
+#include "../lib_external_sort/record_file.h"
+
+namespace {
+
+using TKeyWay = std::pair<int, size_t>;
+
+// слияние источников деревом проигравших: пары (элемент, источник)
+std::vector<TKeyWay> merge_with_tree(
+    const std::vector<std::vector<int>>& sources) {
+    TLoserTree<int> tree(sources.size());
+    std::vector<size_t> positions(sources.size(), 0);
+    for (size_t way = 0; way < sources.size(); way++) {
+        if (!sources[way].empty()) {
+            tree.set(way, sources[way][0]);
+            positions[way] = 1;
+        }
+    }
+    tree.build();
+    std::vector<TKeyWay> merged;
+    while (!tree.empty()) {
+        size_t way = tree.winner();
+        merged.emplace_back(tree.top(), way);
+        if (positions[way] < sources[way].size()) {
+            tree.replace_top(sources[way][positions[way]++]);
+        } else {
+            tree.pop_top();
+        }
+    }
+    return merged;
+}
+
+// то же устойчивой сортировкой
+std::vector<TKeyWay> merge_reference(
+    const std::vector<std::vector<int>>& sources) {
+    std::vector<TKeyWay> merged;
+    for (size_t way = 0; way < sources.size(); way++) {
+        for (int value : sources[way]) {
+            merged.emplace_back(value, way);
+        }
+    }
+    std::stable_sort(merged.begin(), merged.end(),
+                     [](const TKeyWay& a, const TKeyWay& b) {
+                         return a.first < b.first;
+                     });
+    return merged;
+}
+
+std::vector<std::vector<int>> make_sources(size_t ways, size_t max_size,
+                                           int max_value, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::vector<std::vector<int>> sources(ways);
+    for (std::vector<int>& source : sources) {
+        source.resize(gen() % (max_size + 1));
+        for (int& value : source) {
+            value = static_cast<int>(gen() % max_value);
+        }
+        std::sort(source.begin(), source.end());
+    }
+    return sources;
+}
+
+std::string temp_path(const std::string& name) {
+    return (std::filesystem::temp_directory_path() /
+            ("test_external_sort_" + name)).string();
+}
+
+void write_records(const std::string& path,
+                   const std::vector<uint64_t>& records) {
+    TOutputFile file(path);
+    file.write(records.data(), records.size() * sizeof(uint64_t));
+    file.close();
+}
+
+std::vector<uint64_t> read_records(const std::string& path) {
+    TInputFile file(path, IoMode::kPread);
+    std::vector<uint64_t> records(file.size() / sizeof(uint64_t));
+    file.read(0, records.data(), records.size() * sizeof(uint64_t));
+    return records;
+}
+
+// входной и выходной файлы теста, удаляются в конце
+class TFilePair {
+ public:
+    explicit TFilePair(const std::string& name)
+        : input(temp_path(name + ".in")), output(temp_path(name + ".out")) {}
+    ~TFilePair() {
+        std::filesystem::remove(input);
+        std::filesystem::remove(output);
+    }
+
+    std::string input;
+    std::string output;
+};
+
+}  // namespace
+
+TEST(TestExternalSortLib, loser_tree_merges_like_stable_sort) {
+  // Arrange
+  const size_t kWays[] = {1, 2, 3, 5, 8, 13, 64};
+
+  for (size_t ways : kWays) {
+    std::vector<std::vector<int>> sources =
+        make_sources(ways, 200, 50, static_cast<uint32_t>(ways));
+
+    // Act & Assert
+    EXPECT_EQ(merge_reference(sources), merge_with_tree(sources));
+  }
+}
+
+TEST(TestExternalSortLib, loser_tree_skips_empty_sources) {
+  // Arrange
+  std::vector<std::vector<int>> sources = {{}, {1, 4}, {}, {}, {2, 3}, {}};
+
+  // Act
+  std::vector<TKeyWay> merged = merge_with_tree(sources);
+
+  // Assert
+  std::vector<TKeyWay> expected = {{1, 1}, {2, 4}, {3, 4}, {4, 1}};
+  EXPECT_EQ(expected, merged);
+}
+
+TEST(TestExternalSortLib, loser_tree_with_all_sources_empty_is_empty) {
+  // Arrange
+  TLoserTree<int> tree(4);
+
+  // Act
+  tree.build();
+
+  // Assert
+  EXPECT_TRUE(tree.empty());
+}
+
+TEST(TestExternalSortLib, throw_when_loser_tree_has_no_sources) {
+  // Act & Assert
+  ASSERT_THROW(TLoserTree<int>(0), std::invalid_argument);
+}
+
+TEST(TestExternalSortLib, can_sort_file_in_memory_budget) {
+  // Arrange
+  const IoMode kModes[] = {IoMode::kPread, IoMode::kMmap};
+  TFilePair files("budget");
+  std::mt19937_64 gen(7);
+  std::vector<uint64_t> records(300000);
+  for (uint64_t& record : records) {
+    record = gen() % 100000;
+  }
+  write_records(files.input, records);
+  std::sort(records.begin(), records.end());
+  TExternalSortOptions options;
+  options.memory_bytes = 256 << 10;
+  options.fan_in = 3;
+
+  for (IoMode mode : kModes) {
+    options.io_mode = mode;
+
+    // Act
+    TExternalSortStats stats =
+        external_sort(files.input, files.output, options);
+
+    // Assert
+    EXPECT_EQ(records.size(), stats.records);
+    EXPECT_EQ(19u, stats.runs);
+    EXPECT_EQ(3u, stats.merge_passes);
+    EXPECT_EQ(records, read_records(files.output));
+    EXPECT_TRUE(is_sorted_file(files.output, mode));
+  }
+}
+
+TEST(TestExternalSortLib, can_sort_small_file_without_merging) {
+  // Arrange
+  TFilePair files("small");
+  std::vector<uint64_t> records = {5, UINT64_MAX, 0, 3, 3, 1};
+  write_records(files.input, records);
+
+  // Act
+  TExternalSortStats stats = external_sort(files.input, files.output);
+
+  // Assert
+  std::vector<uint64_t> expected = {0, 1, 3, 3, 5, UINT64_MAX};
+  EXPECT_EQ(1u, stats.runs);
+  EXPECT_EQ(0u, stats.merge_passes);
+  EXPECT_EQ(expected, read_records(files.output));
+}
+
+TEST(TestExternalSortLib, can_sort_empty_file) {
+  // Arrange
+  TFilePair files("empty");
+  write_records(files.input, {});
+
+  // Act
+  TExternalSortStats stats = external_sort(files.input, files.output);
+
+  // Assert
+  EXPECT_EQ(0u, stats.records);
+  EXPECT_TRUE(read_records(files.output).empty());
+}
+
+TEST(TestExternalSortLib, can_generate_unsorted_records) {
+  // Arrange
+  TFilePair files("generate");
+
+  // Act
+  generate_records(files.input, 1000, 3);
+
+  // Assert
+  EXPECT_EQ(1000u, read_records(files.input).size());
+  EXPECT_FALSE(is_sorted_file(files.input));
+}
+
+TEST(TestExternalSortLib, throw_when_input_is_missing) {
+  // Arrange
+  TFilePair files("missing");
+
+  // Act & Assert
+  ASSERT_THROW(external_sort(files.input, files.output), std::runtime_error);
+}
+
+TEST(TestExternalSortLib, throw_when_input_is_not_whole_records) {
+  // Arrange
+  TFilePair files("partial");
+  {
+    TOutputFile file(files.input);
+    file.write("abc", 3);
+    file.close();
+  }
+
+  // Act & Assert
+  ASSERT_THROW(external_sort(files.input, files.output),
+               std::invalid_argument);
+}
+
+TEST(TestExternalSortLib, can_close_output_file_twice) {
+  // Arrange
+  TFilePair files("close");
+  TOutputFile file(files.input);
+  uint64_t record = 42;
+  file.write(&record, sizeof(record));
+
+  // Act & Assert
+  ASSERT_NO_THROW(file.close());
+  ASSERT_NO_THROW(file.close());
+  EXPECT_EQ(std::vector<uint64_t>({42}), read_records(files.input));
+}
+
+TEST(TestExternalSortLib, throw_when_options_are_invalid) {
+  // Arrange
+  TFilePair files("options");
+  write_records(files.input, {1, 2});
+  TExternalSortOptions narrow;
+  narrow.fan_in = 1;
+  TExternalSortOptions tight;
+  tight.memory_bytes = kExternalSortMinBuffer * 4;
+  tight.fan_in = 4;
+
+  // Act & Assert
+  ASSERT_THROW(external_sort(files.input, files.output, narrow),
+               std::invalid_argument);
+  ASSERT_THROW(external_sort(files.input, files.output, tight),
+               std::invalid_argument);
+  ASSERT_THROW(external_sort(files.input, files.input),
+               std::invalid_argument);
+}
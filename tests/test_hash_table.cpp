@@ -0,0 +1,237 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "../lib_hash_table/hash_map.h"
+
+TEST(TestHashTableLib, can_insert_and_find) {
+  // Arrange
+  THashMap<int, int> map;
+
+  // Act
+  for (int i = 0; i < 1000; i++) {
+    map.insert(i, i * 10);
+  }
+
+  // Assert
+  EXPECT_EQ(1000u, map.size());
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_TRUE(map.contains(i));
+    EXPECT_EQ(i * 10, map.find(i)->second);
+  }
+  EXPECT_FALSE(map.contains(1000));
+  EXPECT_TRUE(map.find(-1) == map.end());
+}
+
+TEST(TestHashTableLib, insert_does_not_overwrite_existing_key) {
+  // Arrange
+  THashMap<int, std::string> map;
+  map.insert(1, "first");
+
+  // Act
+  bool inserted = map.insert(1, "second").second;
+
+  // Assert
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ("first", map.at(1));
+  EXPECT_EQ(1u, map.size());
+}
+
+TEST(TestHashTableLib, can_use_index_operator) {
+  // Arrange
+  THashMap<std::string, int> counts;
+  const char* words[] = { "a", "b", "a", "c", "a", "b" };
+
+  // Act
+  for (const char* word : words) {
+    counts[word]++;
+  }
+
+  // Assert
+  EXPECT_EQ(3, counts["a"]);
+  EXPECT_EQ(2, counts["b"]);
+  EXPECT_EQ(1, counts["c"]);
+}
+
+TEST(TestHashTableLib, can_erase_keys) {
+  // Arrange
+  THashMap<int, int> map;
+  for (int i = 0; i < 100; i++) {
+    map.insert(i, i);
+  }
+
+  // Act
+  for (int i = 0; i < 100; i += 2) {
+    EXPECT_EQ(1u, map.erase(i));
+  }
+
+  // Assert
+  EXPECT_EQ(0u, map.erase(0));
+  EXPECT_EQ(50u, map.size());
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(i % 2 == 1, map.contains(i));
+  }
+}
+
+TEST(TestHashTableLib, load_factor_never_exceeds_seven_eighths) {
+  // Arrange
+  THashMap<uint64_t, int> map;
+
+  for (uint64_t i = 0; i < 100000; i++) {
+    // Act
+    map.insert(i * 7919, 0);
+
+    // Assert
+    ASSERT_LE(map.load_factor(), 0.875);
+  }
+}
+
+TEST(TestHashTableLib, rehash_keeps_all_elements) {
+  // Arrange
+  THashMap<int, int> map;
+  map.reserve(10);
+  size_t initial_capacity = map.capacity();
+
+  // Act
+  for (int i = 0; i < 5000; i++) {
+    map.insert(i, -i);
+  }
+
+  // Assert
+  EXPECT_GT(map.capacity(), initial_capacity);
+  size_t visited = 0;
+  for (const auto& item : map) {
+    EXPECT_EQ(-item.first, item.second);
+    visited++;
+  }
+  EXPECT_EQ(5000u, visited);
+}
+
+TEST(TestHashTableLib, tombstones_do_not_grow_table_under_churn) {
+  // Arrange
+  THashMap<int, int> map;
+  for (int i = 0; i < 100; i++) {
+    map.insert(i, i);
+  }
+  size_t capacity = map.capacity();
+
+  // Act: размер постоянен, но ключи всё время новые
+  for (int i = 100; i < 100000; i++) {
+    map.erase(i - 100);
+    map.insert(i, i);
+  }
+
+  // Assert: не больше одного удвоения, дальше надгробия вычищаются
+  // перестроением той же ёмкости
+  EXPECT_LE(map.capacity(), 2 * capacity);
+  EXPECT_EQ(100u, map.size());
+  for (int i = 99900; i < 100000; i++) {
+    ASSERT_TRUE(map.contains(i));
+  }
+}
+
+TEST(TestHashTableLib, can_find_string_keys_without_allocating_string) {
+  // Arrange
+  THashMap<std::string, int> map;
+  map.insert("hello", 1);
+  std::string_view view = "hello world";
+
+  // Act & Assert
+  EXPECT_TRUE(map.contains(view.substr(0, 5)));
+  EXPECT_TRUE(map.contains("hello"));
+  EXPECT_FALSE(map.contains(view));
+  EXPECT_EQ(1u, map.erase(std::string_view("hello")));
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(TestHashTableLib, can_store_move_only_values) {
+  // Arrange
+  THashMap<int, std::unique_ptr<int>> map;
+
+  // Act
+  for (int i = 0; i < 100; i++) {
+    map.try_emplace(i, new int(i));
+  }
+
+  // Assert
+  EXPECT_EQ(42, *map.at(42));
+}
+
+TEST(TestHashTableLib, can_copy_and_move_map) {
+  // Arrange
+  THashMap<std::string, int> map;
+  map.insert("one", 1);
+  map.insert("two", 2);
+
+  // Act
+  THashMap<std::string, int> copy(map);
+  THashMap<std::string, int> moved(std::move(map));
+
+  // Assert
+  EXPECT_EQ(2u, copy.size());
+  EXPECT_EQ(2, moved.at("two"));
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(TestHashTableLib, erase_through_iterator_visits_rest) {
+  // Arrange
+  THashMap<int, int> map;
+  for (int i = 0; i < 50; i++) {
+    map.insert(i, i);
+  }
+
+  // Act
+  for (auto it = map.begin(); it != map.end();) {
+    if (it->first % 3 == 0) {
+      it = map.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  // Assert
+  EXPECT_EQ(33u, map.size());
+}
+
+TEST(TestHashTableLib, behaves_like_unordered_map_on_random_operations) {
+  // Arrange
+  THashMap<uint32_t, uint32_t> map;
+  std::unordered_map<uint32_t, uint32_t> expected;
+  std::mt19937 gen(17);
+  std::uniform_int_distribution<uint32_t> key(0, 5000);
+
+  for (int step = 0; step < 200000; step++) {
+    // Act
+    uint32_t k = key(gen);
+    switch (gen() % 3) {
+    case 0:
+      map[k] = static_cast<uint32_t>(step);
+      expected[k] = static_cast<uint32_t>(step);
+      break;
+    case 1:
+      ASSERT_EQ(expected.erase(k), map.erase(k));
+      break;
+    default:
+      ASSERT_EQ(expected.count(k), map.count(k));
+      if (expected.count(k) != 0) {
+        ASSERT_EQ(expected[k], map.at(k));
+      }
+    }
+  }
+
+  // Assert
+  EXPECT_EQ(expected.size(), map.size());
+}
+
+TEST(TestHashTableLib, throw_when_at_misses_key) {
+  // Arrange
+  THashMap<int, int> map;
+
+  // Act & Assert
+  ASSERT_ANY_THROW(map.at(1));
+}
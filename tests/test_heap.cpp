@@ -0,0 +1,299 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../lib_heap/d_ary_heap.h"
+#include "../lib_heap/indexed_heap.h"
+#include "../lib_heap/pairing_heap.h"
+
+namespace {
+
+// свойство кучи: ни один ребёнок не меньше родителя
+template <size_t Arity, class T, class Less = std::less<T>>
+bool is_heap(const TDaryHeap<T, Arity, Less>& heap, Less less = Less()) {
+    const T* data = heap.data();
+    for (size_t i = 1; i < heap.size(); i++) {
+        if (less(data[i], data[(i - 1) / Arity])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <size_t Arity>
+void check_heap_sorts(uint32_t seed) {
+    std::mt19937 gen(seed);
+    TDaryHeap<int, Arity> heap;
+    std::vector<int> values;
+    for (int i = 0; i < 2000; i++) {
+        int value = static_cast<int>(gen() % 500);
+        heap.push(value);
+        values.push_back(value);
+    }
+    ASSERT_TRUE(is_heap(heap));
+    std::sort(values.begin(), values.end());
+    for (int value : values) {
+        ASSERT_EQ(value, heap.take());
+        ASSERT_TRUE(is_heap(heap));
+    }
+    EXPECT_TRUE(heap.empty());
+}
+
+}  // namespace
+
+TEST(TestHeapLib, d_ary_heap_pops_in_sorted_order_for_any_arity) {
+  // Arrange & Act & Assert
+  check_heap_sorts<2>(1);
+  check_heap_sorts<3>(2);
+  check_heap_sorts<4>(3);
+  check_heap_sorts<8>(4);
+  check_heap_sorts<16>(5);
+}
+
+TEST(TestHeapLib, children_of_node_share_cache_line) {
+  // Arrange
+  TDaryHeap<uint64_t, 8> heap;
+
+  // Act
+  for (uint64_t i = 0; i < 100; i++) {
+    heap.push(i);
+  }
+
+  // Assert: дети узла 0 (1..8) начинаются на границе 64 байт
+  uintptr_t children = reinterpret_cast<uintptr_t>(heap.data() + 1);
+  EXPECT_EQ(0u, children % kHeapAlignment);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(heap.data() + 9) %
+                kHeapAlignment);
+}
+
+TEST(TestHeapLib, can_build_heap_from_vector) {
+  // Arrange
+  std::vector<int> values;
+  for (int i = 1000; i > 0; i--) {
+    values.push_back(i % 37);
+  }
+
+  // Act
+  TDaryHeap<int, 4> heap(values);
+
+  // Assert
+  EXPECT_EQ(values.size(), heap.size());
+  EXPECT_TRUE(is_heap(heap));
+  EXPECT_EQ(0, heap.top());
+}
+
+TEST(TestHeapLib, can_use_greater_for_max_heap_and_replace_top) {
+  // Arrange
+  TDaryHeap<std::string, 2, std::greater<std::string>> heap;
+  heap.push("b");
+  heap.push("d");
+  heap.push("a");
+
+  // Act
+  heap.replace_top("c");
+
+  // Assert
+  EXPECT_TRUE(is_heap(heap, std::greater<std::string>()));
+  EXPECT_EQ("c", heap.take());
+  EXPECT_EQ("b", heap.take());
+  EXPECT_EQ("a", heap.take());
+}
+
+TEST(TestHeapLib, can_copy_and_move_d_ary_heap) {
+  // Arrange
+  TDaryHeap<std::unique_ptr<int>, 4,
+            std::function<bool(const std::unique_ptr<int>&,
+                               const std::unique_ptr<int>&)>>
+      owners([](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) {
+        return *a < *b;
+      });
+  TDaryHeap<int> heap;
+  for (int i = 0; i < 50; i++) {
+    heap.push(50 - i);
+    owners.push(std::unique_ptr<int>(new int(i)));
+  }
+
+  // Act
+  TDaryHeap<int> copy(heap);
+  heap.pop();
+  auto moved(std::move(owners));
+
+  // Assert
+  EXPECT_EQ(1, copy.top());
+  EXPECT_EQ(50u, copy.size());
+  EXPECT_EQ(2, heap.top());
+  EXPECT_EQ(0, *moved.top());
+  EXPECT_TRUE(owners.empty());
+}
+
+TEST(TestHeapLib, throw_when_heap_is_empty) {
+  // Arrange
+  TDaryHeap<int> heap;
+  TIndexedHeap<int> indexed;
+  TPairingHeap<int> pairing;
+
+  // Act & Assert
+  ASSERT_ANY_THROW(heap.top());
+  ASSERT_ANY_THROW(heap.pop());
+  ASSERT_ANY_THROW(indexed.pop());
+  ASSERT_ANY_THROW(pairing.top());
+}
+
+TEST(TestHeapLib, indexed_heap_supports_decrease_key_and_erase) {
+  // Arrange
+  TIndexedHeap<int> heap;
+  heap.push(0, 50);
+  heap.push(1, 40);
+  heap.push(2, 30);
+  heap.push(7, 20);
+
+  // Act
+  heap.decrease_key(0, 10);
+  heap.erase(2);
+  heap.increase_key(7, 45);
+
+  // Assert
+  EXPECT_EQ(3u, heap.size());
+  EXPECT_FALSE(heap.contains(2));
+  EXPECT_EQ(45, heap.value(7));
+  EXPECT_EQ(0u, heap.take());
+  EXPECT_EQ(1u, heap.take());
+  EXPECT_EQ(7u, heap.take());
+}
+
+TEST(TestHeapLib, indexed_heap_rejects_wrong_key_changes) {
+  // Arrange
+  TIndexedHeap<int> heap;
+  heap.push(3, 10);
+
+  // Act & Assert
+  ASSERT_ANY_THROW(heap.push(3, 5));
+  ASSERT_ANY_THROW(heap.decrease_key(3, 11));
+  ASSERT_ANY_THROW(heap.increase_key(3, 9));
+  ASSERT_ANY_THROW(heap.erase(4));
+  EXPECT_FALSE(heap.push_or_decrease(3, 12));
+  EXPECT_TRUE(heap.push_or_decrease(3, 8));
+  EXPECT_EQ(8, heap.top());
+}
+
+TEST(TestHeapLib, indexed_heap_matches_reference_on_random_operations) {
+  // Arrange
+  std::mt19937 gen(42);
+  const uint32_t kHandles = 300;
+  TIndexedHeap<int, 3> heap(kHandles);
+  std::map<uint32_t, int> expected;
+
+  for (int step = 0; step < 20000; step++) {
+    // Act
+    uint32_t handle = gen() % kHandles;
+    int value = static_cast<int>(gen() % 1000);
+    switch (gen() % 4) {
+    case 0:
+      if (expected.count(handle) == 0) {
+        heap.push(handle, value);
+        expected[handle] = value;
+      }
+      break;
+    case 1:
+      if (expected.count(handle) != 0) {
+        heap.update(handle, value);
+        expected[handle] = value;
+      }
+      break;
+    case 2:
+      if (expected.count(handle) != 0) {
+        heap.erase(handle);
+        expected.erase(handle);
+      }
+      break;
+    default:
+      if (!expected.empty()) {
+        uint32_t top = heap.top_handle();
+        ASSERT_EQ(expected[top], heap.top());
+        for (const auto& item : expected) {
+          ASSERT_LE(heap.top(), item.second);
+        }
+        heap.pop();
+        expected.erase(top);
+      }
+      break;
+    }
+
+    // Assert
+    ASSERT_EQ(expected.size(), heap.size());
+  }
+  for (const auto& item : expected) {
+    EXPECT_EQ(item.second, heap.value(item.first));
+  }
+}
+
+TEST(TestHeapLib, pairing_heap_pops_in_sorted_order) {
+  // Arrange
+  std::mt19937 gen(7);
+  TPairingHeap<int> heap;
+  std::multiset<int> expected;
+  for (int i = 0; i < 5000; i++) {
+    int value = static_cast<int>(gen() % 1000);
+    heap.push(value);
+    expected.insert(value);
+  }
+
+  // Act & Assert
+  for (int value : expected) {
+    ASSERT_EQ(value, heap.take());
+  }
+  EXPECT_TRUE(heap.empty());
+}
+
+TEST(TestHeapLib, pairing_heap_supports_decrease_key_erase_and_merge) {
+  // Arrange
+  std::shared_ptr<TPairingHeap<int>::node_pool> pool =
+      TPairingHeap<int>::make_pool();
+  TPairingHeap<int> heap(pool);
+  TPairingHeap<int> other(pool);
+  std::vector<TPairingHeap<int>::THandle> handles;
+  for (int i = 0; i < 100; i++) {
+    handles.push_back(heap.push(100 + i));
+  }
+  TPairingHeap<int>::THandle small = other.push(50);
+  heap.pop();  // после pop дерево перестроено, узлы имеют родителей
+
+  // Act
+  heap.decrease_key(handles[60], 5);
+  heap.erase(handles[30]);
+  heap.merge(other);
+  heap.decrease_key(small, 1);
+
+  // Assert
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(99u, heap.size());
+  EXPECT_EQ(1, heap.take());
+  EXPECT_EQ(5, heap.take());
+  ASSERT_ANY_THROW(heap.decrease_key(handles[99], 500));
+  int previous = 0;
+  while (!heap.empty()) {
+    int value = heap.take();
+    ASSERT_NE(130, value);
+    ASSERT_LE(previous, value);
+    previous = value;
+  }
+}
+
+TEST(TestHeapLib, throw_when_merging_pairing_heaps_with_different_pools) {
+  // Arrange
+  TPairingHeap<int> a;
+  TPairingHeap<int> b;
+  b.push(1);
+
+  // Act & Assert
+  ASSERT_ANY_THROW(a.merge(b));
+}
@@ -0,0 +1,343 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../lib_list/intrusive_list.h"
+#include "../lib_list/pool_list.h"
+
+namespace {
+
+struct TLruTag {};
+
+struct TItem : TListHook<>, TListHook<TLruTag> {
+    explicit TItem(int key_ = 0, int order_ = 0)
+        : key(key_), order(order_) {}
+    int key;
+    int order;
+};
+
+bool by_key(const TItem& a, const TItem& b) { return a.key < b.key; }
+
+std::vector<int> keys(const TIntrusiveList<TItem>& list) {
+    std::vector<int> result;
+    for (const TItem& item : list) {
+        result.push_back(item.key);
+    }
+    return result;
+}
+
+template <class T>
+std::vector<T> values(const TPoolList<T>& list) {
+    return std::vector<T>(list.begin(), list.end());
+}
+
+}  // namespace
+
+TEST(TestListLib, can_link_and_unlink_intrusive_elements) {
+  // Arrange
+  TItem a(1), b(2), c(3);
+  TIntrusiveList<TItem> list;
+
+  // Act
+  list.push_back(b);
+  list.push_back(c);
+  list.push_front(a);
+  list.remove(b);
+
+  // Assert
+  EXPECT_EQ(std::vector<int>({ 1, 3 }), keys(list));
+  EXPECT_FALSE(static_cast<TListHook<>&>(b).is_linked());
+  EXPECT_TRUE(static_cast<TListHook<>&>(a).is_linked());
+  EXPECT_EQ(&c, &list.back());
+}
+
+TEST(TestListLib, throw_when_intrusive_element_is_linked_twice) {
+  // Arrange
+  TItem a(1);
+  TIntrusiveList<TItem> list;
+  TIntrusiveList<TItem> other;
+  list.push_back(a);
+
+  // Act & Assert
+  ASSERT_ANY_THROW(other.push_back(a));
+  ASSERT_ANY_THROW(TIntrusiveList<TItem>().pop_front());
+}
+
+TEST(TestListLib, object_can_be_in_two_lists_with_different_tags) {
+  // Arrange
+  TItem a(1), b(2);
+  TIntrusiveList<TItem> all;
+  TIntrusiveList<TItem, TLruTag> lru;
+  all.push_back(a);
+  all.push_back(b);
+  lru.push_back(a);
+  lru.push_back(b);
+
+  // Act: обращение к a переносит его в конец LRU-списка
+  lru.splice(lru.end(), lru, lru.iterator_to(a));
+
+  // Assert
+  EXPECT_EQ(std::vector<int>({ 1, 2 }), keys(all));
+  EXPECT_EQ(&b, &lru.front());
+  EXPECT_EQ(&a, &lru.back());
+  EXPECT_EQ(2u, lru.size());
+}
+
+TEST(TestListLib, clear_unlinks_intrusive_elements) {
+  // Arrange
+  TItem a(1), b(2);
+  TIntrusiveList<TItem> list;
+  list.push_back(a);
+  list.push_back(b);
+
+  // Act
+  list.clear();
+
+  // Assert
+  EXPECT_TRUE(list.empty());
+  EXPECT_FALSE(static_cast<TListHook<>&>(a).is_linked());
+  EXPECT_NO_THROW(list.push_back(b));
+}
+
+TEST(TestListLib, intrusive_sort_is_stable_and_keeps_addresses) {
+  // Arrange
+  std::mt19937 gen(3);
+  std::vector<std::unique_ptr<TItem>> items;
+  TIntrusiveList<TItem> list;
+  for (int i = 0; i < 1000; i++) {
+    items.emplace_back(new TItem(static_cast<int>(gen() % 50), i));
+    list.push_back(*items.back());
+  }
+  TIntrusiveList<TItem>::iterator first = list.begin();
+
+  // Act
+  list.sort(by_key);
+
+  // Assert
+  ASSERT_EQ(1000u, list.size());
+  const TItem* previous = nullptr;
+  for (const TItem& item : list) {
+    if (previous != nullptr) {
+      ASSERT_LE(previous->key, item.key);
+      if (previous->key == item.key) {
+        ASSERT_LT(previous->order, item.order);
+      }
+    }
+    previous = &item;
+  }
+  EXPECT_EQ(items[0].get(), &*first);
+}
+
+TEST(TestListLib, can_splice_intrusive_lists) {
+  // Arrange
+  TItem items[6] = { TItem(0), TItem(1), TItem(2), TItem(3), TItem(4),
+                     TItem(5) };
+  TIntrusiveList<TItem> left;
+  TIntrusiveList<TItem> right;
+  for (int i = 0; i < 3; i++) {
+    left.push_back(items[i]);
+    right.push_back(items[i + 3]);
+  }
+
+  // Act
+  left.splice(left.begin(), right,
+              std::next(right.begin()), right.end());
+  left.splice(left.end(), right);
+
+  // Assert
+  EXPECT_EQ(std::vector<int>({ 4, 5, 0, 1, 2, 3 }), keys(left));
+  EXPECT_EQ(6u, left.size());
+  EXPECT_TRUE(right.empty());
+}
+
+TEST(TestListLib, can_move_intrusive_list) {
+  // Arrange
+  TItem a(1), b(2);
+  TIntrusiveList<TItem> list;
+  list.push_back(a);
+  list.push_back(b);
+
+  // Act
+  TIntrusiveList<TItem> moved(std::move(list));
+  moved.pop_front();
+
+  // Assert
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(std::vector<int>({ 2 }), keys(moved));
+}
+
+TEST(TestListLib, pool_list_behaves_like_std_list) {
+  // Arrange
+  TPoolList<std::string> list;
+  std::list<std::string> expected;
+  std::mt19937 gen(8);
+
+  for (int step = 0; step < 5000; step++) {
+    // Act
+    std::string value = std::to_string(step);
+    switch (expected.empty() ? 0 : gen() % 5) {
+    case 0:
+      list.push_back(value);
+      expected.push_back(value);
+      break;
+    case 1:
+      list.push_front(value);
+      expected.push_front(value);
+      break;
+    case 2:
+      list.pop_front();
+      expected.pop_front();
+      break;
+    case 3:
+      list.pop_back();
+      expected.pop_back();
+      break;
+    default:
+      list.insert(std::next(list.begin()), value);
+      expected.insert(std::next(expected.begin()), value);
+      break;
+    }
+
+    // Assert
+    ASSERT_EQ(expected.size(), list.size());
+  }
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), list.begin()));
+}
+
+TEST(TestListLib, pool_list_reuses_freed_nodes) {
+  // Arrange
+  TPoolList<int> list;
+  std::set<const int*> addresses;
+  for (int i = 0; i < 100; i++) {
+    addresses.insert(&list.emplace_back(i));
+  }
+
+  // Act
+  list.clear();
+  for (int i = 0; i < 100; i++) {
+    list.push_back(i);
+  }
+
+  // Assert
+  EXPECT_EQ(100u, list.pool()->objects_in_use());
+  for (const int& value : list) {
+    EXPECT_EQ(1u, addresses.count(&value));
+  }
+}
+
+TEST(TestListLib, pool_list_iterators_survive_sort_splice_and_merge) {
+  // Arrange
+  std::shared_ptr<TPoolList<int>::node_pool> pool =
+      TPoolList<int>::make_pool();
+  TPoolList<int> list(pool);
+  TPoolList<int> other(pool);
+  for (int value : { 5, 1, 4 }) {
+    list.push_back(value);
+  }
+  for (int value : { 6, 2, 3 }) {
+    other.push_back(value);
+  }
+  TPoolList<int>::iterator five = list.begin();
+  TPoolList<int>::iterator six = other.begin();
+  const int* address = &*five;
+
+  // Act
+  list.sort();
+  other.sort();
+  list.merge(other);
+
+  // Assert
+  EXPECT_EQ(std::vector<int>({ 1, 2, 3, 4, 5, 6 }), values(list));
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(5, *five);
+  EXPECT_EQ(address, &*five);
+  EXPECT_EQ(6, *std::next(five));
+  EXPECT_EQ(six, std::prev(list.end()));
+}
+
+TEST(TestListLib, pool_list_merge_is_stable) {
+  // Arrange
+  std::shared_ptr<TPoolList<std::pair<int, int>>::node_pool> pool =
+      TPoolList<std::pair<int, int>>::make_pool();
+  TPoolList<std::pair<int, int>> a(pool);
+  TPoolList<std::pair<int, int>> b(pool);
+  auto first_less = [](const std::pair<int, int>& x,
+                       const std::pair<int, int>& y) {
+    return x.first < y.first;
+  };
+  a.push_back({ 1, 0 });
+  a.push_back({ 2, 0 });
+  b.push_back({ 1, 1 });
+  b.push_back({ 2, 1 });
+
+  // Act
+  a.merge(b, first_less);
+
+  // Assert
+  std::vector<std::pair<int, int>> expected = { { 1, 0 }, { 1, 1 },
+                                                { 2, 0 }, { 2, 1 } };
+  EXPECT_EQ(expected, values(a));
+}
+
+TEST(TestListLib, throw_when_splicing_pool_lists_with_different_pools) {
+  // Arrange
+  TPoolList<int> a = { 1, 2 };
+  TPoolList<int> b = { 3 };
+
+  // Act & Assert
+  ASSERT_ANY_THROW(a.splice(a.end(), b));
+  ASSERT_ANY_THROW(a.merge(b));
+}
+
+TEST(TestListLib, can_copy_move_and_reverse_pool_list) {
+  // Arrange
+  TPoolList<std::unique_ptr<int>> owners;
+  owners.emplace_back(new int(7));
+  TPoolList<int> list = { 1, 2, 3 };
+
+  // Act
+  TPoolList<int> copy(list);
+  TPoolList<std::unique_ptr<int>> moved(std::move(owners));
+  copy.reverse();
+  size_t removed = list.remove_if([](int value) { return value % 2 == 1; });
+
+  // Assert
+  EXPECT_EQ(std::vector<int>({ 3, 2, 1 }), values(copy));
+  EXPECT_EQ(std::vector<int>({ 2 }), values(list));
+  EXPECT_EQ(2u, removed);
+  EXPECT_EQ(7, *moved.front());
+  EXPECT_TRUE(owners.empty());
+  EXPECT_NO_THROW(owners.emplace_back(new int(8)));
+}
+
+TEST(TestListLib, sort_matches_std_stable_sort_on_random_input) {
+  // Arrange
+  std::mt19937 gen(13);
+  TPoolList<std::pair<int, int>> list;
+  std::vector<std::pair<int, int>> expected;
+  for (int i = 0; i < 10000; i++) {
+    std::pair<int, int> value(static_cast<int>(gen() % 100), i);
+    list.push_back(value);
+    expected.push_back(value);
+  }
+  auto first_less = [](const std::pair<int, int>& x,
+                       const std::pair<int, int>& y) {
+    return x.first < y.first;
+  };
+
+  // Act
+  list.sort(first_less);
+  std::stable_sort(expected.begin(), expected.end(), first_less);
+
+  // Assert
+  EXPECT_EQ(expected, values(list));
+  EXPECT_EQ(expected.back(), list.back());
+  EXPECT_EQ(expected.back(), *std::prev(list.end()));
+}
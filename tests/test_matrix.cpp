@@ -0,0 +1,225 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include "../lib_matrix/matrix.h"
+#include "../lib_matrix/triangular_matrix.h"
+
+namespace {
+
+template <class T>
+TMatrix<T> random_matrix(size_t rows, size_t cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  TMatrix<T> result(rows, cols);
+  for (size_t i = 0; i < result.size(); i++) {
+    result.data()[i] = static_cast<T>(value(gen));
+  }
+  return result;
+}
+
+// сравнение с допуском, пропорциональным длине скалярного произведения
+template <class T>
+bool near(const TMatrix<T>& left, const TMatrix<T>& right, size_t k,
+          double eps) {
+  if (left.rows() != right.rows() || left.cols() != right.cols()) {
+    return false;
+  }
+  for (size_t i = 0; i < left.size(); i++) {
+    if (std::fabs(left.data()[i] - right.data()[i]) > eps * k) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(TestMatrixLib, can_create_matrix_with_value) {
+  // Arrange & Act
+  TMatrix<int> matrix(3, 4, 7);
+
+  // Assert
+  EXPECT_EQ(3u, matrix.rows());
+  EXPECT_EQ(4u, matrix.cols());
+  EXPECT_EQ(7, matrix(2, 3));
+}
+
+TEST(TestMatrixLib, storage_is_aligned) {
+  // Arrange & Act
+  TMatrix<float> matrix(5, 7);
+
+  // Assert
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(matrix.data()) %
+                kMatrixAlignment);
+}
+
+TEST(TestMatrixLib, can_create_from_initializer_list) {
+  // Arrange & Act
+  TMatrix<int> matrix = { { 1, 2, 3 }, { 4, 5, 6 } };
+
+  // Assert
+  EXPECT_EQ(2u, matrix.rows());
+  EXPECT_EQ(6, matrix(1, 2));
+  EXPECT_EQ(4, matrix.transposed()(0, 1));
+}
+
+TEST(TestMatrixLib, throw_when_rows_differ_in_size) {
+  // Act & Assert
+  ASSERT_ANY_THROW((TMatrix<int>{ { 1, 2 }, { 3 } }));
+}
+
+TEST(TestMatrixLib, throw_when_index_is_out_of_range) {
+  // Arrange
+  TMatrix<int> matrix(2, 2);
+
+  // Act & Assert
+  ASSERT_ANY_THROW(matrix.at(2, 0));
+  ASSERT_ANY_THROW(matrix.at(0, 2));
+}
+
+TEST(TestMatrixLib, can_copy_and_move) {
+  // Arrange
+  TMatrix<double> matrix = { { 1, 2 }, { 3, 4 } };
+
+  // Act
+  TMatrix<double> copy(matrix);
+  TMatrix<double> moved(std::move(matrix));
+
+  // Assert
+  EXPECT_EQ(copy, moved);
+  EXPECT_TRUE(matrix.empty());
+}
+
+TEST(TestMatrixLib, can_add_and_subtract) {
+  // Arrange
+  TMatrix<int> a = { { 1, 2 }, { 3, 4 } };
+  TMatrix<int> b = { { 4, 3 }, { 2, 1 } };
+
+  // Act & Assert
+  EXPECT_EQ(TMatrix<int>(2, 2, 5), a + b);
+  EXPECT_EQ(a, (a + b) - b);
+  ASSERT_ANY_THROW(a + TMatrix<int>(2, 3));
+}
+
+TEST(TestMatrixLib, can_multiply_small_matrices) {
+  // Arrange
+  TMatrix<float> a = { { 1, 2, 3 }, { 4, 5, 6 } };
+  TMatrix<float> b = { { 7, 8 }, { 9, 10 }, { 11, 12 } };
+  TMatrix<float> expected = { { 58, 64 }, { 139, 154 } };
+
+  // Act & Assert
+  EXPECT_EQ(expected, a * b);
+  EXPECT_EQ(expected, multiply(a, b, GemmKernel::kScalar));
+}
+
+TEST(TestMatrixLib, can_multiply_integer_matrices) {
+  // Arrange
+  TMatrix<int> a = { { 1, 2 }, { 3, 4 } };
+
+  // Act & Assert
+  EXPECT_EQ(TMatrix<int>({ { 7, 10 }, { 15, 22 } }), a * a);
+  EXPECT_EQ(a, a * TMatrix<int>::identity(2));
+}
+
+TEST(TestMatrixLib, throw_when_inner_dimensions_differ) {
+  // Arrange
+  TMatrix<float> a(2, 3);
+  TMatrix<float> b(2, 3);
+
+  // Act & Assert
+  ASSERT_ANY_THROW(a * b);
+}
+
+TEST(TestMatrixLib, gemm_matches_naive_float_on_edge_sizes) {
+  // размеры не кратны плитке микроядра и блокам кэша
+  const size_t sizes[][3] = { { 1, 1, 1 }, { 5, 17, 3 }, { 7, 15, 300 },
+                              { 13, 33, 257 }, { 130, 50, 70 },
+                              { 121, 2050, 9 } };
+  for (const auto& size : sizes) {
+    // Arrange
+    TMatrix<float> a = random_matrix<float>(size[0], size[2], 1);
+    TMatrix<float> b = random_matrix<float>(size[2], size[1], 2);
+    TMatrix<float> expected = multiply_naive(a, b);
+
+    // Act
+    TMatrix<float> fast = multiply(a, b, GemmKernel::kAvx2Fma);
+    TMatrix<float> scalar = multiply(a, b, GemmKernel::kScalar);
+
+    // Assert
+    EXPECT_TRUE(near(expected, fast, size[2], 1e-5));
+    EXPECT_TRUE(near(expected, scalar, size[2], 1e-5));
+  }
+}
+
+TEST(TestMatrixLib, gemm_matches_naive_double) {
+  // Arrange
+  TMatrix<double> a = random_matrix<double>(97, 301, 3);
+  TMatrix<double> b = random_matrix<double>(301, 1030, 4);
+  TMatrix<double> expected = multiply_naive(a, b);
+
+  // Act
+  TMatrix<double> fast = multiply(a, b, GemmKernel::kAvx2Fma);
+  TMatrix<double> scalar = multiply(a, b, GemmKernel::kScalar);
+
+  // Assert
+  EXPECT_TRUE(near(expected, fast, 301, 1e-12));
+  EXPECT_TRUE(near(expected, scalar, 301, 1e-12));
+}
+
+TEST(TestMatrixLib, gemm_accumulates_into_result) {
+  // Arrange
+  TMatrix<float> a = random_matrix<float>(10, 20, 5);
+  TMatrix<float> b = random_matrix<float>(20, 30, 6);
+  TMatrix<float> c(10, 30, 1.0f);
+
+  // Act
+  gemm(10, 30, 20, a.data(), a.cols(), b.data(), b.cols(),
+       c.data(), c.cols());
+
+  // Assert
+  EXPECT_TRUE(near(multiply_naive(a, b) + TMatrix<float>(10, 30, 1.0f), c,
+                   20, 1e-5));
+}
+
+TEST(TestMatrixLib, triangular_matrix_stores_half) {
+  // Arrange & Act
+  TUpperTriangularMatrix<double> matrix(100);
+
+  // Assert
+  EXPECT_EQ(5050u, matrix.stored_elements());
+}
+
+TEST(TestMatrixLib, triangular_matrix_reads_zero_below_diagonal) {
+  // Arrange
+  TMatrix<int> dense = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+
+  // Act
+  TUpperTriangularMatrix<int> upper(dense);
+
+  // Assert
+  EXPECT_EQ(6, upper.get(1, 2));
+  EXPECT_EQ(0, upper.get(2, 0));
+  EXPECT_EQ(TMatrix<int>({ { 1, 2, 3 }, { 0, 5, 6 }, { 0, 0, 9 } }),
+            upper.to_dense());
+  ASSERT_ANY_THROW(upper.at(2, 1));
+  ASSERT_ANY_THROW(upper.get(3, 0));
+}
+
+TEST(TestMatrixLib, triangular_products_match_dense) {
+  // Arrange
+  TUpperTriangularMatrix<double> a(random_matrix<double>(37, 37, 7));
+  TUpperTriangularMatrix<double> b(random_matrix<double>(37, 37, 8));
+  TMatrix<double> dense = random_matrix<double>(37, 11, 9);
+
+  // Act
+  TUpperTriangularMatrix<double> product = multiply(a, b);
+  TMatrix<double> mixed = multiply(a, dense);
+
+  // Assert
+  EXPECT_TRUE(near(multiply_naive(a.to_dense(), b.to_dense()),
+                   product.to_dense(), 37, 1e-12));
+  EXPECT_TRUE(near(multiply_naive(a.to_dense(), dense), mixed, 37, 1e-12));
+}
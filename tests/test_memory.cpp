@@ -0,0 +1,214 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../lib_memory/arena.h"
+#include "../lib_memory/pool.h"
+
+namespace {
+
+bool is_aligned(const void* pointer, size_t alignment) {
+  return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(TestMemoryLib, arena_returns_aligned_memory) {
+  // Arrange
+  TArena arena(1024);
+  size_t alignments[] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+
+  for (size_t alignment : alignments) {
+    // Act
+    arena.allocate(1, 1);  // сбиваем выравнивание
+    void* pointer = arena.allocate(24, alignment);
+
+    // Assert
+    EXPECT_TRUE(is_aligned(pointer, alignment));
+  }
+}
+
+TEST(TestMemoryLib, arena_allocations_do_not_overlap) {
+  // Arrange
+  TArena arena(256);
+  std::vector<int*> values;
+
+  // Act
+  for (int i = 0; i < 1000; i++) {
+    values.push_back(arena.create<int>(i));
+  }
+
+  // Assert
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(i, *values[i]);
+  }
+}
+
+TEST(TestMemoryLib, arena_reset_reuses_blocks) {
+  // Arrange
+  TArena arena(4096);
+  void* first = arena.allocate(100);
+  for (int i = 0; i < 100; i++) {
+    arena.allocate(100);
+  }
+  size_t reserved = arena.bytes_reserved();
+
+  // Act
+  arena.reset();
+  void* after_reset = arena.allocate(100);
+  for (int i = 0; i < 100; i++) {
+    arena.allocate(100);
+  }
+
+  // Assert
+  EXPECT_EQ(first, after_reset);
+  EXPECT_EQ(reserved, arena.bytes_reserved());
+}
+
+TEST(TestMemoryLib, arena_reset_frees_large_blocks) {
+  // Arrange
+  TArena arena(1024);
+  arena.allocate(16);
+  size_t reserved = arena.bytes_reserved();
+
+  // Act
+  void* large = arena.allocate(1 << 20, 64);
+  size_t reserved_with_large = arena.bytes_reserved();
+  arena.reset();
+
+  // Assert
+  EXPECT_TRUE(is_aligned(large, 64));
+  EXPECT_GT(reserved_with_large, reserved + (1 << 20) - 1);
+  EXPECT_EQ(reserved, arena.bytes_reserved());
+  EXPECT_EQ(0u, arena.bytes_allocated());
+}
+
+TEST(TestMemoryLib, arena_release_returns_all_memory) {
+  // Arrange
+  TArena arena;
+  arena.allocate(100);
+
+  // Act
+  arena.release();
+
+  // Assert
+  EXPECT_EQ(0u, arena.bytes_reserved());
+  EXPECT_NE(nullptr, arena.allocate(100));
+}
+
+TEST(TestMemoryLib, throw_when_arena_alignment_is_not_power_of_two) {
+  // Arrange
+  TArena arena;
+
+  // Act & Assert
+  ASSERT_ANY_THROW(arena.allocate(16, 3));
+  ASSERT_ANY_THROW(arena.allocate(16, 0));
+}
+
+TEST(TestMemoryLib, throw_bad_alloc_when_arena_size_overflows) {
+  // Arrange
+  TArena arena;
+  arena.allocate(16);
+
+  // Act & Assert
+  ASSERT_THROW(arena.allocate(SIZE_MAX - 8, 16), std::bad_alloc);
+  ASSERT_THROW(arena.allocate(SIZE_MAX), std::bad_alloc);
+  EXPECT_EQ(16u, arena.bytes_allocated());
+}
+
+TEST(TestMemoryLib, throw_on_bad_alignment_when_block_has_room) {
+  // Arrange: первый запрос заводит блок, второй помещается в него
+  TArena arena;
+  arena.allocate(16);
+
+  // Act & Assert
+  ASSERT_ANY_THROW(arena.allocate(16, 24));
+  EXPECT_EQ(16u, arena.bytes_allocated());
+}
+
+TEST(TestMemoryLib, can_use_arena_allocator_in_std_vector) {
+  // Arrange
+  TArena arena;
+  TArenaAllocator<std::string> allocator(&arena);
+  std::vector<std::string, TArenaAllocator<std::string>> strings(allocator);
+
+  // Act
+  for (int i = 0; i < 100; i++) {
+    strings.push_back(std::to_string(i));
+  }
+
+  // Assert
+  EXPECT_EQ("99", strings.back());
+  EXPECT_GT(arena.bytes_allocated(), 100 * sizeof(std::string));
+}
+
+TEST(TestMemoryLib, pool_returns_aligned_distinct_blocks) {
+  // Arrange
+  TFixedPool pool(24, 32, 4);
+  std::vector<void*> blocks;
+
+  // Act
+  for (int i = 0; i < 10; i++) {
+    blocks.push_back(pool.allocate());
+  }
+
+  // Assert
+  for (size_t i = 0; i < blocks.size(); i++) {
+    EXPECT_TRUE(is_aligned(blocks[i], 32));
+    for (size_t j = 0; j < i; j++) {
+      EXPECT_NE(blocks[i], blocks[j]);
+    }
+  }
+  EXPECT_EQ(10u, pool.objects_in_use());
+  EXPECT_EQ(12u, pool.capacity());
+}
+
+TEST(TestMemoryLib, pool_reuses_freed_block) {
+  // Arrange
+  TFixedPool pool(sizeof(int), alignof(int));
+  pool.allocate();
+  void* block = pool.allocate();
+
+  // Act
+  pool.deallocate(block);
+  void* reused = pool.allocate();
+
+  // Assert
+  EXPECT_EQ(block, reused);
+  EXPECT_EQ(2u, pool.objects_in_use());
+}
+
+TEST(TestMemoryLib, pool_reset_keeps_slabs) {
+  // Arrange
+  TFixedPool pool(16, 16, 8);
+  void* first = pool.allocate();
+  for (int i = 0; i < 20; i++) {
+    pool.allocate();
+  }
+  size_t capacity = pool.capacity();
+
+  // Act
+  pool.reset();
+
+  // Assert
+  EXPECT_EQ(0u, pool.objects_in_use());
+  EXPECT_EQ(capacity, pool.capacity());
+  EXPECT_EQ(first, pool.allocate());
+}
+
+TEST(TestMemoryLib, can_create_and_destroy_objects_in_pool) {
+  // Arrange
+  TObjectPool<std::string> pool;
+
+  // Act
+  std::string* hello = pool.create("hello");
+  std::string* world = pool.create(5, 'w');
+  pool.destroy(hello);
+
+  // Assert
+  EXPECT_EQ("wwwww", *world);
+  EXPECT_EQ(1u, pool.objects_in_use());
+  pool.destroy(world);
+}
@@ -0,0 +1,200 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>  // NOLINT [build/c++11]
+#include <vector>
+#include "../lib_easy_example/easy_example.h"
+#include "../lib_parallel/parallel_division.h"
+#include "../lib_parallel/thread_pool.h"
+#include "../lib_parallel/work_stealing_deque.h"
+
+TEST(TestParallelLib, deque_owner_takes_in_lifo_order) {
+  // Arrange
+  TWorkStealingDeque<int> deque(2);
+  for (int i = 0; i < 10; i++) {
+    deque.push(i);
+  }
+
+  for (int i = 9; i >= 0; i--) {
+    // Act
+    int item = -1;
+    ASSERT_TRUE(deque.take(&item));
+
+    // Assert
+    EXPECT_EQ(i, item);
+  }
+  int item;
+  EXPECT_FALSE(deque.take(&item));
+}
+
+TEST(TestParallelLib, deque_thief_steals_in_fifo_order) {
+  // Arrange
+  TWorkStealingDeque<int> deque;
+  deque.push(1);
+  deque.push(2);
+  int stolen = 0;
+  int taken = 0;
+
+  // Act
+  ASSERT_TRUE(deque.steal(&stolen));
+  ASSERT_TRUE(deque.take(&taken));
+
+  // Assert
+  EXPECT_EQ(1, stolen);
+  EXPECT_EQ(2, taken);
+  EXPECT_FALSE(deque.steal(&stolen));
+}
+
+TEST(TestParallelLib, deque_hands_out_every_item_exactly_once) {
+  // Arrange
+  const int count = 200000;
+  TWorkStealingDeque<int> deque(16);
+  std::vector<std::atomic<int>> seen(count);
+  std::atomic<bool> done(false);
+  auto thief = [&]() {
+    int item;
+    while (!done.load()) {
+      if (deque.steal(&item)) {
+        seen[item]++;
+      }
+    }
+    while (deque.steal(&item)) {
+      seen[item]++;
+    }
+  };
+
+  // Act
+  std::thread first(thief);
+  std::thread second(thief);
+  for (int i = 0; i < count; i++) {
+    deque.push(i);
+    int item;
+    if (i % 3 == 0 && deque.take(&item)) {
+      seen[item]++;
+    }
+  }
+  int item;
+  while (deque.take(&item)) {
+    seen[item]++;
+  }
+  done.store(true);
+  first.join();
+  second.join();
+
+  // Assert
+  for (int i = 0; i < count; i++) {
+    ASSERT_EQ(1, seen[i].load()) << i;
+  }
+}
+
+TEST(TestParallelLib, parallel_for_visits_every_index_once) {
+  size_t thread_counts[] = { 1, 2, 4 };
+  size_t grains[] = { 1, 7, 1000, 100000 };
+  for (size_t threads : thread_counts) {
+    for (size_t grain : grains) {
+      // Arrange
+      TThreadPool pool(threads);
+      std::vector<std::atomic<int>> visits(10000);
+
+      // Act
+      pool.parallel_for(0, visits.size(), grain, [&](size_t lo, size_t hi) {
+        EXPECT_LE(hi - lo, grain);
+        for (size_t i = lo; i < hi; i++) {
+          visits[i]++;
+        }
+      });
+
+      // Assert
+      for (size_t i = 0; i < visits.size(); i++) {
+        ASSERT_EQ(1, visits[i].load());
+      }
+    }
+  }
+}
+
+TEST(TestParallelLib, parallel_reduce_is_deterministic) {
+  // Arrange
+  std::vector<double> values(100000);
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = 1.0 / (i + 1);
+  }
+  auto sum = [&](TThreadPool* pool) {
+    return pool->parallel_reduce(
+        0, values.size(), 1000, 0.0,
+        [&](size_t lo, size_t hi) {
+          double partial = 0;
+          for (size_t i = lo; i < hi; i++) {
+            partial += values[i];
+          }
+          return partial;
+        },
+        [](double left, double right) { return left + right; });
+  };
+  TThreadPool serial(1);
+  TThreadPool parallel(4);
+
+  // Act & Assert
+  EXPECT_EQ(sum(&serial), sum(&parallel));
+}
+
+TEST(TestParallelLib, can_run_nested_parallel_for) {
+  // Arrange
+  TThreadPool pool(3);
+  std::atomic<int64_t> total(0);
+
+  // Act
+  pool.parallel_for(0, 10, 1, [&](size_t lo, size_t hi) {
+    for (size_t outer = lo; outer < hi; outer++) {
+      pool.parallel_for(0, 100, 10, [&](size_t from, size_t to) {
+        total += static_cast<int64_t>(to - from);
+      });
+    }
+  });
+
+  // Assert
+  EXPECT_EQ(1000, total.load());
+}
+
+TEST(TestParallelLib, parallel_for_rethrows_exception_from_body) {
+  // Arrange
+  TThreadPool pool(2);
+
+  // Act & Assert
+  ASSERT_THROW(pool.parallel_for(0, 1000, 10, [](size_t lo, size_t) {
+    if (lo == 500) {
+      throw std::runtime_error("body failed");
+    }
+  }), std::runtime_error);
+}
+
+TEST(TestParallelLib, parallel_division_matches_division_batch) {
+  // Arrange
+  const size_t count = 100003;
+  std::vector<int> a(count), b(count);
+  for (size_t i = 0; i < count; i++) {
+    a[i] = static_cast<int>(i * 31) - 50000;
+    b[i] = static_cast<int>(i % 17) - 8;
+  }
+  std::vector<float> expected(count), actual(count);
+  std::vector<uint8_t> expected_mask(count), actual_mask(count);
+  TThreadPool pool(4);
+
+  // Act
+  size_t expected_zeros = division_batch(a.data(), b.data(), expected.data(),
+                                         count, expected_mask.data());
+  size_t actual_zeros = parallel_division(&pool, a.data(), b.data(),
+                                          actual.data(), count,
+                                          actual_mask.data(), 1000);
+
+  // Assert
+  EXPECT_EQ(expected_zeros, actual_zeros);
+  EXPECT_EQ(expected_mask, actual_mask);
+  for (size_t i = 0; i < count; i++) {
+    if (b[i] != 0) {
+      ASSERT_EQ(expected[i], actual[i]);
+    }
+  }
+}
@@ -0,0 +1,214 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "../lib_polynomial/polynomial.h"
+#include "../lib_polynomial/sparse_polynomial.h"
+
+namespace {
+
+std::vector<TModInt> random_mod(size_t size, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<TModInt> result(size);
+  for (TModInt& value : result) {
+    value = TModInt(gen());
+  }
+  return result;
+}
+
+std::vector<double> random_real(size_t size, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> value(-100, 100);
+  std::vector<double> result(size);
+  for (double& item : result) {
+    item = value(gen);
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(TestPolynomialLib, zero_polynomial_has_negative_degree) {
+  // Arrange & Act
+  TPolynomial<double> zero = { 0.0, 0.0 };
+
+  // Assert
+  EXPECT_TRUE(zero.is_zero());
+  EXPECT_EQ(-1, zero.degree());
+}
+
+TEST(TestPolynomialLib, can_add_and_subtract) {
+  // Arrange
+  TPolynomial<double> a = { 1, 2, 3 };
+  TPolynomial<double> b = { 1, 1, -3 };
+
+  // Act & Assert
+  EXPECT_EQ(TPolynomial<double>({ 2, 3 }), a + b);
+  EXPECT_EQ(1, (a + b).degree());
+  EXPECT_TRUE((a - a).is_zero());
+}
+
+TEST(TestPolynomialLib, can_evaluate_with_horner) {
+  // Arrange
+  TPolynomial<double> p = { 1, -2, 0, 3 };  // 3x^3 - 2x + 1
+
+  // Act & Assert
+  EXPECT_DOUBLE_EQ(1.0, p.evaluate(0.0));
+  EXPECT_DOUBLE_EQ(21.0, p.evaluate(2.0));
+}
+
+TEST(TestPolynomialLib, batched_evaluation_matches_single_point) {
+  // Arrange
+  TPolynomial<TModInt> p(random_mod(300, 1));
+  std::vector<TModInt> points = random_mod(37, 2);
+
+  // Act
+  std::vector<TModInt> values = p.evaluate(points);
+
+  // Assert
+  ASSERT_EQ(points.size(), values.size());
+  for (size_t i = 0; i < points.size(); i++) {
+    EXPECT_EQ(p.evaluate(points[i]), values[i]);
+  }
+}
+
+TEST(TestPolynomialLib, can_multiply_small_polynomials) {
+  // Arrange
+  TPolynomial<double> a = { 1, 1 };   // x + 1
+  TPolynomial<double> b = { -1, 1 };  // x - 1
+
+  // Act & Assert
+  EXPECT_EQ(TPolynomial<double>({ -1, 0, 1 }), a * b);
+  EXPECT_TRUE((a * TPolynomial<double>()).is_zero());
+}
+
+TEST(TestPolynomialLib, all_algorithms_agree_on_mod_int) {
+  const size_t sizes[][2] = { { 1, 1 }, { 31, 33 }, { 100, 100 },
+                              { 257, 1000 }, { 3000, 2999 } };
+  for (const auto& size : sizes) {
+    // Arrange
+    TPolynomial<TModInt> a(random_mod(size[0], 3));
+    TPolynomial<TModInt> b(random_mod(size[1], 4));
+
+    // Act
+    TPolynomial<TModInt> expected =
+        multiply(a, b, MultiplyAlgorithm::kSchoolbook);
+
+    // Assert
+    EXPECT_EQ(expected, multiply(a, b, MultiplyAlgorithm::kKaratsuba));
+    EXPECT_EQ(expected, multiply(a, b, MultiplyAlgorithm::kTransform));
+    EXPECT_EQ(expected, a * b);
+  }
+}
+
+TEST(TestPolynomialLib, fft_product_of_integers_is_exact_after_rounding) {
+  // Arrange
+  TPolynomial<double> a(random_real(2000, 5));
+  TPolynomial<double> b(random_real(1500, 6));
+
+  // Act
+  TPolynomial<double> expected =
+      multiply(a, b, MultiplyAlgorithm::kSchoolbook);
+  TPolynomial<double> fast = multiply(a, b, MultiplyAlgorithm::kTransform);
+  TPolynomial<double> karatsuba =
+      multiply(a, b, MultiplyAlgorithm::kKaratsuba);
+
+  // Assert
+  ASSERT_EQ(expected.degree(), fast.degree());
+  for (size_t i = 0; i < expected.coefficients().size(); i++) {
+    EXPECT_EQ(expected.coefficient(i), std::round(fast.coefficient(i)));
+    EXPECT_EQ(expected.coefficient(i), karatsuba.coefficient(i));
+  }
+}
+
+TEST(TestPolynomialLib, can_multiply_high_degree_polynomials) {
+  // Arrange
+  TPolynomial<TModInt> a(random_mod(100000, 7));
+  TPolynomial<TModInt> b(random_mod(100000, 8));
+  TModInt x = 12345;
+
+  // Act
+  TPolynomial<TModInt> product = a * b;
+
+  // Assert
+  EXPECT_EQ(199998, product.degree());
+  EXPECT_EQ(a.evaluate(x) * b.evaluate(x), product.evaluate(x));
+}
+
+TEST(TestPolynomialLib, division_restores_dividend) {
+  // Arrange
+  TPolynomial<TModInt> a(random_mod(500, 9));
+  TPolynomial<TModInt> b(random_mod(120, 10));
+
+  // Act
+  TPolynomialDivision<TModInt> result = divide(a, b);
+
+  // Assert
+  EXPECT_LT(result.remainder.degree(), b.degree());
+  EXPECT_EQ(a, result.quotient * b + result.remainder);
+}
+
+TEST(TestPolynomialLib, can_divide_real_polynomials) {
+  // Arrange
+  TPolynomial<double> a = { -1, 0, 0, 1 };  // x^3 - 1
+  TPolynomial<double> b = { -1, 1 };        // x - 1
+
+  // Act & Assert
+  EXPECT_EQ(TPolynomial<double>({ 1, 1, 1 }), a / b);
+  EXPECT_TRUE((a % b).is_zero());
+  EXPECT_EQ(a, (b / a) * b + (b % a) + (a - b));
+}
+
+TEST(TestPolynomialLib, try_divide_reports_zero_divisor) {
+  // Arrange
+  TPolynomial<double> a = { 1, 2 };
+
+  // Act
+  auto result = try_divide(a, TPolynomial<double>());
+
+  // Assert
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(ErrorCode::kDivisionByZero, result.error());
+}
+
+TEST(TestPolynomialLib, throw_when_divide_by_zero_polynomial) {
+  // Arrange
+  TPolynomial<double> a = { 1, 2 };
+
+  // Act & Assert
+  ASSERT_ANY_THROW(a / TPolynomial<double>());
+  ASSERT_ANY_THROW(TModInt(1) / TModInt(0));
+}
+
+TEST(TestPolynomialLib, sparse_polynomial_keeps_only_nonzero_terms) {
+  // Arrange
+  TSparsePolynomial<TModInt> p;
+
+  // Act
+  p.add_term(1000000, 1);
+  p.add_term(0, 1);
+  p.add_term(5, 2);
+  p.add_term(5, -2);
+
+  // Assert
+  EXPECT_EQ(2u, p.term_count());
+  EXPECT_EQ(1000000, p.degree());
+  EXPECT_EQ(TModInt(0), p.coefficient(5));
+  EXPECT_EQ(TModInt(2).pow(1000000) + 1, p.evaluate(2));
+}
+
+TEST(TestPolynomialLib, sparse_arithmetic_matches_dense) {
+  // Arrange
+  TPolynomial<TModInt> a({ 1, 0, 0, 5, 0, 7 });
+  TPolynomial<TModInt> b({ 0, 3, 0, 0, -1 });
+  TSparsePolynomial<TModInt> sa(a);
+  TSparsePolynomial<TModInt> sb(b);
+
+  // Act & Assert
+  EXPECT_EQ(a + b, (sa + sb).to_dense());
+  EXPECT_EQ(a * b, (sa * sb).to_dense());
+  EXPECT_TRUE((sa + TSparsePolynomial<TModInt>(a - a - a)).is_zero());
+  EXPECT_EQ(a.evaluate(3), sa.evaluate(3));
+}
@@ -0,0 +1,152 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include "../lib_queue/queue.h"
+
+TEST(TestQueueLib, can_push_and_pop_in_fifo_order) {
+  // Arrange
+  TQueue<int> queue;
+
+  // Act
+  for (int i = 0; i < 1000; i++) {
+    queue.push(i);
+  }
+
+  // Assert
+  EXPECT_EQ(999, queue.back());
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_EQ(i, queue.front());
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(TestQueueLib, capacity_is_power_of_two) {
+  // Arrange
+  TQueue<int> queue;
+
+  // Act
+  queue.reserve(100);
+
+  // Assert
+  EXPECT_EQ(128u, queue.capacity());
+}
+
+TEST(TestQueueLib, growth_keeps_order_after_wraparound) {
+  // Arrange
+  TQueue<std::string> queue;
+  queue.reserve(16);
+  for (int i = 0; i < 12; i++) {
+    queue.push(std::to_string(i));
+  }
+  for (int i = 0; i < 10; i++) {
+    queue.pop();
+  }
+
+  // Act: голова в конце буфера, хвост уже перешёл в начало
+  for (int i = 12; i < 40; i++) {
+    queue.push(std::to_string(i));
+  }
+
+  // Assert
+  EXPECT_EQ(32u, queue.capacity());
+  for (int i = 10; i < 40; i++) {
+    ASSERT_EQ(std::to_string(i), queue.take());
+  }
+}
+
+TEST(TestQueueLib, does_not_grow_when_size_is_bounded) {
+  // Arrange
+  TQueue<int> queue;
+  for (int i = 0; i < 100; i++) {
+    queue.push(i);
+  }
+  size_t capacity = queue.capacity();
+
+  // Act
+  for (int i = 0; i < 100000; i++) {
+    queue.push(i);
+    queue.pop();
+  }
+
+  // Assert
+  EXPECT_EQ(capacity, queue.capacity());
+}
+
+TEST(TestQueueLib, can_push_element_of_itself_when_full) {
+  // Arrange
+  TQueue<std::string> queue;
+  queue.reserve(16);
+  for (int i = 0; i < 16; i++) {
+    queue.push(std::string(20, static_cast<char>('a' + i)));
+  }
+
+  // Act
+  queue.push(queue.front());
+
+  // Assert
+  EXPECT_EQ(std::string(20, 'a'), queue.back());
+}
+
+TEST(TestQueueLib, behaves_like_std_queue_on_random_operations) {
+  // Arrange
+  TQueue<int> queue;
+  std::queue<int> expected;
+  std::mt19937 gen(5);
+
+  for (int step = 0; step < 50000; step++) {
+    // Act
+    if (expected.empty() || gen() % 3 != 0) {
+      queue.push(step);
+      expected.push(step);
+    } else {
+      queue.pop();
+      expected.pop();
+    }
+
+    // Assert
+    ASSERT_EQ(expected.size(), queue.size());
+    if (!expected.empty()) {
+      ASSERT_EQ(expected.front(), queue.front());
+      ASSERT_EQ(expected.back(), queue.back());
+    }
+  }
+}
+
+TEST(TestQueueLib, can_copy_move_and_shrink) {
+  // Arrange
+  TQueue<std::unique_ptr<int>> owners;
+  TQueue<int> queue;
+  for (int i = 0; i < 100; i++) {
+    queue.push(i);
+    owners.emplace(new int(i));
+  }
+
+  // Act
+  TQueue<int> copy(queue);
+  TQueue<std::unique_ptr<int>> moved(std::move(owners));
+  for (int i = 0; i < 90; i++) {
+    queue.pop();
+  }
+  queue.shrink_to_fit();
+
+  // Assert
+  EXPECT_EQ(100u, copy.size());
+  EXPECT_EQ(99, copy.back());
+  EXPECT_EQ(0, *moved.front());
+  EXPECT_EQ(16u, queue.capacity());
+  EXPECT_EQ(90, queue.front());
+}
+
+TEST(TestQueueLib, throw_when_queue_is_empty) {
+  // Arrange
+  TQueue<int> queue;
+
+  // Act & Assert
+  ASSERT_ANY_THROW(queue.front());
+  ASSERT_ANY_THROW(queue.pop());
+}
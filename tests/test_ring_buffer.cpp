@@ -0,0 +1,186 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>  // NOLINT [build/c++11]
+#include <vector>
+#include "../lib_ring_buffer/ring_buffer.h"
+
+namespace {
+
+// элемент, копирование которого бросает после copies_left копий;
+// alive - число живых объектов
+struct TThrowingItem {
+    static int alive;
+    static int copies_left;
+
+    TThrowingItem() { alive++; }
+    TThrowingItem(const TThrowingItem&) {
+        if (copies_left-- == 0) {
+            throw std::runtime_error("copy failed");
+        }
+        alive++;
+    }
+    ~TThrowingItem() { alive--; }
+};
+
+int TThrowingItem::alive = 0;
+int TThrowingItem::copies_left = 0;
+
+}  // namespace
+
+TEST(TestRingBufferLib, capacity_is_rounded_up_to_power_of_two) {
+  // Act
+  TSpscRingBuffer<int> queue(100);
+
+  // Assert
+  EXPECT_EQ(128u, queue.capacity());
+}
+
+TEST(TestRingBufferLib, throw_when_capacity_is_zero) {
+  // Act & Assert
+  ASSERT_ANY_THROW(TSpscRingBuffer<int>(0));
+}
+
+TEST(TestRingBufferLib, can_push_until_full_and_pop_in_fifo_order) {
+  // Arrange
+  TSpscRingBuffer<int> queue(4);
+
+  // Act
+  for (int i = 0; i < 4; i++) {
+    ASSERT_TRUE(queue.try_push(i));
+  }
+  bool pushed_into_full = queue.try_push(4);
+
+  // Assert
+  EXPECT_FALSE(pushed_into_full);
+  for (int i = 0; i < 4; i++) {
+    int item = -1;
+    ASSERT_TRUE(queue.try_pop(&item));
+    EXPECT_EQ(i, item);
+  }
+  int item;
+  EXPECT_FALSE(queue.try_pop(&item));
+}
+
+TEST(TestRingBufferLib, can_wrap_around) {
+  // Arrange
+  TSpscRingBuffer<int> queue(4);
+
+  for (int i = 0; i < 100; i++) {
+    // Act
+    int item = -1;
+    queue.try_push(i);
+    queue.try_push(i + 1000);
+    queue.try_pop(&item);
+    EXPECT_EQ(i, item);
+    queue.try_pop(&item);
+
+    // Assert
+    EXPECT_EQ(i + 1000, item);
+    EXPECT_EQ(0u, queue.size_approx());
+  }
+}
+
+TEST(TestRingBufferLib, can_push_and_pop_batch) {
+  // Arrange
+  TSpscRingBuffer<int> queue(8);
+  int input[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+  int output[10] = {};
+
+  // Act
+  size_t pushed = queue.push_batch(input, 10);
+  size_t popped = queue.pop_batch(output, 5);
+  size_t pushed_again = queue.push_batch(input + 8, 2);
+
+  // Assert
+  EXPECT_EQ(8u, pushed);
+  EXPECT_EQ(5u, popped);
+  EXPECT_EQ(2u, pushed_again);
+  EXPECT_EQ(5u, queue.pop_batch(output + 5, 10));
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(i, output[i]);
+  }
+}
+
+TEST(TestRingBufferLib, failed_push_batch_publishes_and_leaks_nothing) {
+  // Arrange
+  TThrowingItem::alive = 0;
+  {
+    TSpscRingBuffer<TThrowingItem> queue(8);
+    TThrowingItem input[4];
+    TThrowingItem::copies_left = 2;
+
+    // Act
+    ASSERT_THROW(queue.push_batch(input, 4), std::runtime_error);
+
+    // Assert
+    EXPECT_EQ(0u, queue.size_approx());
+    EXPECT_EQ(4, TThrowingItem::alive);
+  }
+  EXPECT_EQ(0, TThrowingItem::alive);
+}
+
+TEST(TestRingBufferLib, can_hold_move_only_and_nontrivial_items) {
+  // Arrange
+  TSpscRingBuffer<std::unique_ptr<std::string>> queue(2);
+  std::unique_ptr<std::string> item;
+
+  // Act
+  queue.try_emplace(new std::string("hello"));
+  queue.try_push(std::unique_ptr<std::string>(new std::string("left")));
+  queue.try_pop(&item);
+
+  // Assert
+  EXPECT_EQ("hello", *item);
+  EXPECT_EQ(1u, queue.size_approx());
+}
+
+TEST(TestRingBufferLib, transfers_items_between_threads_in_order) {
+  // Arrange
+  const uint64_t count = 1000000;
+  TSpscRingBuffer<uint64_t> queue(1024);
+  std::vector<uint64_t> received;
+  received.reserve(count);
+
+  // Act
+  std::thread producer([&queue, count]() {
+    uint64_t batch[16];
+    uint64_t next = 0;
+    while (next < count) {
+      size_t size = 0;
+      for (; size < 16 && next + size < count; size++) {
+        batch[size] = next + size;
+      }
+      size_t pushed = 0;
+      while (pushed < size) {
+        pushed += queue.push_batch(batch + pushed, size - pushed);
+        if (pushed < size) {
+          std::this_thread::yield();
+        }
+      }
+      next += size;
+    }
+  });
+  std::thread consumer([&queue, &received, count]() {
+    uint64_t batch[32];
+    while (received.size() < count) {
+      size_t popped = queue.pop_batch(batch, 32);
+      if (popped == 0) {
+        std::this_thread::yield();
+      }
+      received.insert(received.end(), batch, batch + popped);
+    }
+  });
+  producer.join();
+  consumer.join();
+
+  // Assert
+  ASSERT_EQ(count, received.size());
+  for (uint64_t i = 0; i < count; i++) {
+    ASSERT_EQ(i, received[i]);
+  }
+}
@@ -0,0 +1,204 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "../lib_search/eytzinger.h"
+#include "../lib_search/search.h"
+
+namespace {
+
+// отсортированный массив из count чисел в [0, range)
+std::vector<int> make_sorted(size_t count, int range, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::vector<int> values(count);
+    for (int& value : values) {
+        value = static_cast<int>(gen() % static_cast<uint32_t>(range));
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+// ключи поиска: все значения в [-1, range] - есть и попадания, и
+// промахи, и ключи за обоими краями
+std::vector<int> make_keys(int range) {
+    std::vector<int> keys;
+    for (int key = -1; key <= range; key++) {
+        keys.push_back(key);
+    }
+    return keys;
+}
+
+size_t std_lower_bound(const std::vector<int>& values, int key) {
+    return static_cast<size_t>(
+        std::lower_bound(values.begin(), values.end(), key) -
+        values.begin());
+}
+
+const size_t kSizes[] = {0, 1, 2, 3, 7, 8, 15, 16, 17, 100, 1000, 4097};
+
+}  // namespace
+
+TEST(TestSearchLib, branchless_lower_bound_matches_std) {
+  for (size_t count : kSizes) {
+    for (int range : {4, 1 << 20}) {
+      // Arrange
+      std::vector<int> values = make_sorted(count, range, 1);
+      std::vector<int> keys = range < 100 ? make_keys(range) : values;
+      keys.push_back(-1);
+      keys.push_back(range);
+
+      for (int key : keys) {
+        // Act & Assert
+        EXPECT_EQ(std_lower_bound(values, key),
+                  branchless_lower_bound(values.data(), values.size(), key));
+      }
+    }
+  }
+}
+
+TEST(TestSearchLib, branchless_lower_bound_respects_comparator) {
+  // Arrange
+  std::vector<int> values = {9, 7, 7, 7, 4, 1};
+
+  // Act & Assert
+  EXPECT_EQ(1u, branchless_lower_bound(values.data(), values.size(), 7,
+                                       std::greater<int>()));
+  EXPECT_EQ(4u, branchless_lower_bound(values.data(), values.size(), 5,
+                                       std::greater<int>()));
+  EXPECT_EQ(6u, branchless_lower_bound(values.data(), values.size(), 0,
+                                       std::greater<int>()));
+}
+
+TEST(TestSearchLib, can_search_strings) {
+  // Arrange
+  std::vector<std::string> values = {"apple", "kiwi", "kiwi", "pear"};
+
+  // Act & Assert
+  EXPECT_EQ(1u, branchless_lower_bound(values.data(), values.size(),
+                                       std::string("banana")));
+  EXPECT_EQ(1u, branchless_lower_bound(values.data(), values.size(),
+                                       std::string("kiwi")));
+  TEytzingerArray<std::string> layout(values.data(), values.size());
+  EXPECT_EQ(3u, layout.lower_bound("lime"));
+  EXPECT_EQ(4u, layout.lower_bound("plum"));
+}
+
+TEST(TestSearchLib, eytzinger_lower_bound_matches_std) {
+  for (size_t count : kSizes) {
+    for (int range : {4, 1 << 20}) {
+      // Arrange
+      std::vector<int> values = make_sorted(count, range, 2);
+      std::vector<int> keys = range < 100 ? make_keys(range) : values;
+      keys.push_back(-1);
+      keys.push_back(range);
+
+      // Act
+      TEytzingerArray<int> layout(values.data(), values.size());
+
+      // Assert
+      EXPECT_EQ(count, layout.size());
+      for (int key : keys) {
+        EXPECT_EQ(std_lower_bound(values, key), layout.lower_bound(key));
+      }
+    }
+  }
+}
+
+TEST(TestSearchLib, eytzinger_layout_survives_move) {
+  // Arrange
+  std::vector<int> values = make_sorted(1000, 300, 3);
+  TEytzingerArray<int> layout(values.data(), values.size());
+
+  // Act
+  TEytzingerArray<int> moved(std::move(layout));
+
+  // Assert
+  for (int key : make_keys(300)) {
+    EXPECT_EQ(std_lower_bound(values, key), moved.lower_bound(key));
+  }
+}
+
+TEST(TestSearchLib, batch_lower_bound_matches_std) {
+  for (size_t count : kSizes) {
+    // Arrange
+    std::vector<int> values = make_sorted(count, 50, 4);
+    // число запросов не кратно kSearchBatch
+    std::vector<int> keys = make_keys(50);
+    std::vector<size_t> results(keys.size());
+
+    // Act
+    batch_lower_bound(values.data(), values.size(), keys.data(),
+                      keys.size(), results.data());
+
+    // Assert
+    for (size_t i = 0; i < keys.size(); i++) {
+      EXPECT_EQ(std_lower_bound(values, keys[i]), results[i]);
+    }
+  }
+}
+
+TEST(TestSearchLib, interpolation_search_matches_std_on_uniform_keys) {
+  for (size_t count : kSizes) {
+    // Arrange
+    std::vector<int> values = make_sorted(count, 1 << 20, 5);
+    std::vector<int> keys = values;
+    for (int key = -1; key <= (1 << 20); key += 997) {
+      keys.push_back(key);
+    }
+
+    for (int key : keys) {
+      // Act & Assert
+      EXPECT_EQ(std_lower_bound(values, key),
+                interpolation_search(values.data(), values.size(), key));
+    }
+  }
+}
+
+TEST(TestSearchLib, interpolation_search_matches_std_on_skewed_keys) {
+  // Arrange: квадраты и длинные серии одинаковых чисел
+  std::vector<int> values;
+  for (int i = 0; i < 3000; i++) {
+    values.push_back(i * i / 100);
+  }
+  values.insert(values.end(), 5000, values.back());
+  values.push_back(std::numeric_limits<int>::max());
+
+  for (int key : {-5, 0, 1, 7, 50, 999, 40000, 89880, 89881,
+                  std::numeric_limits<int>::max()}) {
+    // Act & Assert
+    EXPECT_EQ(std_lower_bound(values, key),
+              interpolation_search(values.data(), values.size(), key));
+  }
+}
+
+TEST(TestSearchLib, interpolation_search_handles_doubles_and_wide_ints) {
+  // Arrange
+  std::vector<double> reals = {-1e300, -2.5, 0.0, 0.0, 1e-9, 3.0, 1e300};
+  reals.insert(reals.begin() + 3, 100, 0.0);
+  std::vector<uint64_t> wide;
+  for (uint64_t i = 0; i < 200; i++) {
+    wide.push_back(i << 56);
+  }
+  wide.push_back(UINT64_MAX);
+
+  // Act & Assert
+  for (double key : {-1e301, -2.5, 0.0, 1e-10, 2.0, 1e300, 1e301}) {
+    EXPECT_EQ(static_cast<size_t>(
+                  std::lower_bound(reals.begin(), reals.end(), key) -
+                  reals.begin()),
+              interpolation_search(reals.data(), reals.size(), key));
+  }
+  for (uint64_t key : {uint64_t(0), uint64_t(1) << 60, UINT64_MAX - 1,
+                       UINT64_MAX}) {
+    EXPECT_EQ(static_cast<size_t>(
+                  std::lower_bound(wide.begin(), wide.end(), key) -
+                  wide.begin()),
+              interpolation_search(wide.data(), wide.size(), key));
+  }
+}
@@ -0,0 +1,321 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../lib_parallel/thread_pool.h"
+#include "../lib_sort/parallel_sort.h"
+#include "../lib_sort/pdq_sort.h"
+#include "../lib_sort/radix_sort.h"
+
+namespace {
+
+enum class Pattern {
+    kRandom, kSorted, kReversed, kEqual, kFewUnique, kOrganPipe,
+    kSawtooth, kSortedTail, kMedianOfThreeKiller
+};
+
+const Pattern kPatterns[] = {
+    Pattern::kRandom, Pattern::kSorted, Pattern::kReversed, Pattern::kEqual,
+    Pattern::kFewUnique, Pattern::kOrganPipe, Pattern::kSawtooth,
+    Pattern::kSortedTail, Pattern::kMedianOfThreeKiller
+};
+
+std::vector<int> make_input(Pattern pattern, size_t count, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::vector<int> values(count);
+    for (size_t i = 0; i < count; i++) {
+        int index = static_cast<int>(i);
+        int size = static_cast<int>(count);
+        switch (pattern) {
+        case Pattern::kRandom:
+            values[i] = static_cast<int>(gen());
+            break;
+        case Pattern::kSorted:
+            values[i] = index;
+            break;
+        case Pattern::kReversed:
+            values[i] = size - index;
+            break;
+        case Pattern::kEqual:
+            values[i] = 7;
+            break;
+        case Pattern::kFewUnique:
+            values[i] = static_cast<int>(gen() % 4);
+            break;
+        case Pattern::kOrganPipe:
+            values[i] = std::min(index, size - index);
+            break;
+        case Pattern::kSawtooth:
+            values[i] = index % 64;
+            break;
+        case Pattern::kSortedTail:
+            values[i] = i + 16 < count ? index : static_cast<int>(gen());
+            break;
+        case Pattern::kMedianOfThreeKiller:
+            // чётные позиции первой половины - малые, иначе по порядку
+            values[i] = i < count / 2 ? (index % 2 == 0 ? index : size + index)
+                                      : 2 * (index - size / 2) + 1;
+            break;
+        }
+    }
+    return values;
+}
+
+struct TRecord {
+    int key;
+    uint32_t index;
+};
+
+// противник Макилроя («A Killer Adversary for Quicksort»): значения
+// элементов назначаются по ходу сравнений так, чтобы разбиение было
+// как можно хуже; число сравнений - стоимость сортировки на самом
+// неудачном для неё входе
+class TQuicksortAdversary {
+ public:
+    explicit TQuicksortAdversary(size_t count)
+        : values_(count, static_cast<int>(count)),
+          gas_(static_cast<int>(count)), solid_(0), candidate_(0),
+          comparisons_(0) {}
+
+    bool less(int x, int y) {
+        comparisons_++;
+        if (values_[x] == gas_ && values_[y] == gas_) {
+            freeze(x == candidate_ ? x : y);
+        }
+        if (values_[x] == gas_) {
+            candidate_ = x;
+        } else if (values_[y] == gas_) {
+            candidate_ = y;
+        }
+        return values_[x] < values_[y];
+    }
+
+    size_t comparisons() const { return comparisons_; }
+
+ private:
+    void freeze(int x) { values_[x] = solid_++; }
+
+    std::vector<int> values_;
+    int gas_;
+    int solid_;
+    int candidate_;
+    size_t comparisons_;
+};
+
+}  // namespace
+
+TEST(TestSortLib, radix_sort_orders_integer_and_floating_keys) {
+  // Arrange
+  std::mt19937_64 gen(1);
+  std::vector<int64_t> signed_keys(5000);
+  std::vector<uint16_t> small_keys(5000);
+  std::vector<double> doubles(5000);
+  std::vector<float> floats(50);
+  for (size_t i = 0; i < signed_keys.size(); i++) {
+    signed_keys[i] = static_cast<int64_t>(gen());
+    small_keys[i] = static_cast<uint16_t>(gen());
+    doubles[i] = std::ldexp(static_cast<double>(gen() % 2001) - 1000.0,
+                            static_cast<int>(gen() % 40) - 20);
+  }
+  for (size_t i = 0; i < floats.size(); i++) {
+    floats[i] = static_cast<float>(doubles[i]);
+  }
+  doubles[0] = std::numeric_limits<double>::infinity();
+  doubles[1] = -std::numeric_limits<double>::infinity();
+  doubles[2] = std::numeric_limits<double>::lowest();
+  doubles[3] = std::numeric_limits<double>::denorm_min();
+  auto expected_signed = signed_keys;
+  auto expected_small = small_keys;
+  auto expected_doubles = doubles;
+  auto expected_floats = floats;
+  std::sort(expected_signed.begin(), expected_signed.end());
+  std::sort(expected_small.begin(), expected_small.end());
+  std::sort(expected_doubles.begin(), expected_doubles.end());
+  std::sort(expected_floats.begin(), expected_floats.end());
+
+  // Act
+  radix_sort(signed_keys.data(), signed_keys.size());
+  radix_sort(small_keys.data(), small_keys.size());
+  radix_sort(doubles.data(), doubles.size());
+  radix_sort(floats.data(), floats.size());
+
+  // Assert
+  EXPECT_EQ(expected_signed, signed_keys);
+  EXPECT_EQ(expected_small, small_keys);
+  EXPECT_EQ(expected_doubles, doubles);
+  EXPECT_EQ(expected_floats, floats);
+}
+
+TEST(TestSortLib, radix_sort_puts_negative_zero_first) {
+  std::vector<double> values(100, 0.0);
+  for (size_t i = 0; i < values.size(); i += 3) {
+    values[i] = -0.0;
+  }
+
+  radix_sort(values.data(), values.size());
+
+  for (size_t i = 0; i < 34; i++) {
+    EXPECT_TRUE(std::signbit(values[i]));
+  }
+  EXPECT_FALSE(std::signbit(values[34]));
+}
+
+TEST(TestSortLib, radix_sort_is_stable_with_key_functor) {
+  // 10 - вставками, 1000 - прямой перенос, 300000 - через буфер строк
+  for (size_t count : { 10, 1000, 300000 }) {
+    // Arrange: ключ - первое поле, второе - исходная позиция
+    std::mt19937 gen(2);
+    std::vector<TRecord> records(count);
+    for (size_t i = 0; i < count; i++) {
+      records[i] = { static_cast<int>(gen() % 1000) - 500,
+                     static_cast<uint32_t>(i) };
+    }
+
+    // Act
+    radix_sort(records.data(), records.size(),
+               [](const TRecord& record) { return record.key; });
+
+    // Assert
+    for (size_t i = 1; i < count; i++) {
+      ASSERT_LE(records[i - 1].key, records[i].key);
+      if (records[i - 1].key == records[i].key) {
+        ASSERT_LT(records[i - 1].index, records[i].index);
+      }
+    }
+  }
+}
+
+TEST(TestSortLib, radix_sort_can_sort_non_trivial_elements_by_key) {
+  std::vector<std::string> words = { "ccc", "a", "bb", "", "dd", "e" };
+  words.resize(100, "zzzz");
+
+  radix_sort(words.data(), words.size(),
+             [](const std::string& word) { return word.size(); });
+
+  EXPECT_EQ("", words[0]);
+  EXPECT_EQ("a", words[1]);
+  EXPECT_EQ("e", words[2]);
+  EXPECT_EQ("bb", words[3]);
+  EXPECT_EQ("dd", words[4]);
+  EXPECT_EQ("ccc", words[5]);
+  EXPECT_EQ("zzzz", words[99]);
+}
+
+TEST(TestSortLib, radix_sort_skips_constant_bytes) {
+  std::mt19937_64 gen(3);
+  std::vector<uint64_t> values(200000);
+  for (uint64_t& value : values) {
+    value = (gen() % 65536) | (uint64_t(5) << 40);
+  }
+  std::vector<uint64_t> equal(10000, 42);
+  std::vector<uint64_t> shortest = { 5, 3, 1 };
+
+  EXPECT_EQ(2u, radix_sort(values.data(), values.size()));
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+  EXPECT_EQ(0u, radix_sort(equal.data(), equal.size()));
+  EXPECT_EQ(0u, radix_sort(shortest.data(), shortest.size()));
+  EXPECT_EQ(std::vector<uint64_t>({ 1, 3, 5 }), shortest);
+}
+
+TEST(TestSortLib, pdq_sort_matches_std_sort_on_adversarial_patterns) {
+  for (Pattern pattern : kPatterns) {
+    for (size_t count : { 0, 1, 5, 23, 24, 129, 1000, 50000 }) {
+      std::vector<int> values = make_input(pattern, count, 4);
+      std::vector<int> expected = values;
+      std::sort(expected.begin(), expected.end());
+      std::vector<int> descending = values;
+
+      pdq_sort(values.data(), values.size());
+      pdq_sort(descending.data(), descending.size(), std::greater<int>());
+
+      ASSERT_EQ(expected, values);
+      ASSERT_TRUE(std::equal(expected.rbegin(), expected.rend(),
+                             descending.begin()));
+    }
+  }
+}
+
+TEST(TestSortLib, pdq_sort_is_n_log_n_against_quicksort_adversary) {
+  // Arrange
+  const size_t kCount = 1 << 14;
+  TQuicksortAdversary adversary(kCount);
+  std::vector<int> indices(kCount);
+  for (size_t i = 0; i < kCount; i++) {
+    indices[i] = static_cast<int>(i);
+  }
+
+  // Act
+  pdq_sort(indices.data(), indices.size(), [&adversary](int x, int y) {
+    return adversary.less(x, y);
+  });
+
+  // Assert: квадратичная сортировка сделала бы ~kCount^2 / 4 = 6.7e7
+  // сравнений, n log2 n = 2.3e5
+  EXPECT_LT(adversary.comparisons(), 4 * kCount * 14);
+  for (size_t i = 1; i < kCount; i++) {
+    ASSERT_FALSE(adversary.less(indices[i], indices[i - 1]));
+  }
+}
+
+TEST(TestSortLib, pdq_sort_can_sort_strings_with_custom_order) {
+  std::vector<std::string> words;
+  std::mt19937 gen(5);
+  for (int i = 0; i < 3000; i++) {
+    words.push_back(std::string(gen() % 5, 'a') + std::to_string(gen() % 97));
+  }
+  auto by_length = [](const std::string& a, const std::string& b) {
+    return a.size() != b.size() ? a.size() < b.size() : a < b;
+  };
+  std::vector<std::string> expected = words;
+  std::sort(expected.begin(), expected.end(), by_length);
+
+  pdq_sort(words.data(), words.size(), by_length);
+
+  EXPECT_EQ(expected, words);
+}
+
+TEST(TestSortLib, parallel_sort_matches_std_sort) {
+  for (size_t threads : { 1, 2, 4 }) {
+    TThreadPool pool(threads);
+    for (Pattern pattern : kPatterns) {
+      std::vector<int> values = make_input(pattern, 1 << 17, 6);
+      std::vector<int> expected = values;
+      std::sort(expected.begin(), expected.end());
+      std::vector<int> stable = values;
+
+      parallel_sort(&pool, values.data(), values.size());
+      parallel_stable_sort(&pool, stable.data(), stable.size());
+
+      ASSERT_EQ(expected, values);
+      ASSERT_EQ(expected, stable);
+    }
+  }
+}
+
+TEST(TestSortLib, parallel_stable_sort_keeps_order_of_equal_keys) {
+  // Arrange
+  TThreadPool pool(4);
+  std::mt19937 gen(7);
+  std::vector<std::pair<int, int>> items(100003);
+  for (size_t i = 0; i < items.size(); i++) {
+    items[i] = { static_cast<int>(gen() % 100), static_cast<int>(i) };
+  }
+  auto by_key = [](const std::pair<int, int>& a,
+                   const std::pair<int, int>& b) { return a.first < b.first; };
+  std::vector<std::pair<int, int>> expected = items;
+  std::stable_sort(expected.begin(), expected.end(), by_key);
+
+  // Act
+  parallel_stable_sort(&pool, items.data(), items.size(), by_key);
+
+  // Assert
+  EXPECT_TRUE(expected == items);
+}
@@ -0,0 +1,188 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <random>
+#include <vector>
+#include "../lib_sparse/parallel_spmv.h"
+#include "../lib_sparse/sparse_matrix.h"
+
+namespace {
+
+// случайная матрица с длинными строками в начале (грубое степенное
+// распределение) и с повторами координат
+TCooMatrix<double> random_coo(size_t rows, size_t cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<size_t> col(0, cols - 1);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  TCooMatrix<double> coo(rows, cols);
+  for (size_t i = 0; i < rows; i++) {
+    size_t count = (cols / (i + 1)) % 50;
+    for (size_t k = 0; k < count; k++) {
+      coo.add(i, col(gen), value(gen));
+    }
+  }
+  return coo;
+}
+
+std::vector<double> random_vector(size_t size, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::vector<double> result(size);
+  for (double& item : result) {
+    item = value(gen);
+  }
+  return result;
+}
+
+// y = a * x по плотной копии матрицы
+std::vector<double> dense_multiply(const TMatrix<double>& a,
+                                   const std::vector<double>& x) {
+  std::vector<double> y(a.rows(), 0.0);
+  for (size_t i = 0; i < a.rows(); i++) {
+    for (size_t j = 0; j < a.cols(); j++) {
+      y[i] += a(i, j) * x[j];
+    }
+  }
+  return y;
+}
+
+}  // namespace
+
+TEST(TestSparseLib, can_build_csr_from_coo) {
+  // Arrange
+  TCooMatrix<int> coo(3, 4);
+  coo.add(2, 1, 5);
+  coo.add(0, 3, 1);
+  coo.add(0, 0, 2);
+
+  // Act
+  TCsrMatrix<int> csr = coo.to_csr();
+
+  // Assert
+  EXPECT_EQ(3u, csr.nonzeros());
+  EXPECT_EQ(2, csr.get(0, 0));
+  EXPECT_EQ(1, csr.get(0, 3));
+  EXPECT_EQ(5, csr.get(2, 1));
+  EXPECT_EQ(0, csr.get(1, 1));
+  EXPECT_EQ(0u, csr.col_indices()[0]);
+  EXPECT_EQ(3u, csr.col_indices()[1]);
+}
+
+TEST(TestSparseLib, duplicates_are_summed) {
+  // Arrange
+  TCooMatrix<int> coo(2, 2);
+  coo.add(1, 1, 3);
+  coo.add(1, 1, 4);
+
+  // Act
+  TCsrMatrix<int> csr(coo);
+  TCscMatrix<int> csc(coo);
+
+  // Assert
+  EXPECT_EQ(1u, csr.nonzeros());
+  EXPECT_EQ(7, csr.get(1, 1));
+  EXPECT_EQ(7, csc.get(1, 1));
+}
+
+TEST(TestSparseLib, throw_when_index_is_out_of_range) {
+  // Arrange
+  TCooMatrix<int> coo(2, 3);
+
+  // Act & Assert
+  ASSERT_ANY_THROW(coo.add(2, 0, 1));
+  ASSERT_ANY_THROW(coo.to_csr().get(0, 3));
+}
+
+TEST(TestSparseLib, can_convert_between_csr_and_csc) {
+  // Arrange
+  TCooMatrix<double> coo = random_coo(60, 40, 1);
+  TCsrMatrix<double> csr = coo.to_csr();
+
+  // Act
+  TCscMatrix<double> csc = csr.to_csc();
+  TCsrMatrix<double> back = csc.to_csr();
+
+  // Assert
+  EXPECT_EQ(csr.nonzeros(), csc.nonzeros());
+  EXPECT_EQ(csr.to_dense(), back.to_dense());
+  for (size_t i = 0; i < 60; i++) {
+    for (size_t j = 0; j < 40; j++) {
+      ASSERT_EQ(csr.get(i, j), csc.get(i, j));
+    }
+  }
+  EXPECT_EQ(TCscMatrix<double>(coo).to_csr().to_dense(), csr.to_dense());
+}
+
+TEST(TestSparseLib, spmv_matches_dense) {
+  // Arrange
+  TCooMatrix<double> coo = random_coo(80, 70, 2);
+  TCsrMatrix<double> csr(coo);
+  std::vector<double> x = random_vector(70, 3);
+  std::vector<double> expected = dense_multiply(csr.to_dense(), x);
+
+  // Act
+  std::vector<double> from_csr = multiply(csr, x);
+  std::vector<double> from_csc = multiply(csr.to_csc(), x);
+
+  // Assert
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_NEAR(expected[i], from_csr[i], 1e-12);
+    EXPECT_NEAR(expected[i], from_csc[i], 1e-12);
+  }
+}
+
+TEST(TestSparseLib, throw_when_vector_size_differs) {
+  // Arrange
+  TCsrMatrix<double> csr(TCooMatrix<double>(3, 4));
+
+  // Act & Assert
+  ASSERT_ANY_THROW(multiply(csr, std::vector<double>(3)));
+}
+
+TEST(TestSparseLib, sparse_dense_product_matches_dense) {
+  // Arrange
+  TCsrMatrix<double> csr(random_coo(30, 20, 4));
+  TMatrix<double> dense(20, 7);
+  std::vector<double> values = random_vector(dense.size(), 5);
+  std::copy(values.begin(), values.end(), dense.data());
+
+  // Act
+  TMatrix<double> product = multiply(csr, dense);
+
+  // Assert
+  TMatrix<double> expected = multiply_naive(csr.to_dense(), dense);
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_NEAR(expected.data()[i], product.data()[i], 1e-12);
+  }
+}
+
+TEST(TestSparseLib, partition_balances_nonzeros) {
+  // Arrange: первая строка содержит половину всех ненулевых
+  std::vector<size_t> offsets = { 0, 100, 110, 120, 130, 140, 150, 160,
+                                  170, 180, 190, 200 };
+
+  // Act
+  std::vector<size_t> bounds = partition_rows(offsets.data(), 11, 4);
+
+  // Assert
+  ASSERT_EQ(5u, bounds.size());
+  EXPECT_EQ(0u, bounds[0]);
+  EXPECT_EQ(1u, bounds[1]);   // строка-«хаб» стоит отдельно
+  EXPECT_EQ(11u, bounds[4]);
+  for (size_t k = 0; k + 1 < bounds.size(); k++) {
+    EXPECT_LE(bounds[k], bounds[k + 1]);
+  }
+}
+
+TEST(TestSparseLib, parallel_spmv_matches_sequential) {
+  // Arrange
+  TThreadPool pool(4);
+  TCsrMatrix<double> csr(random_coo(5000, 3000, 6));
+  std::vector<double> x = random_vector(3000, 7);
+
+  // Act
+  std::vector<double> parallel = parallel_multiply(&pool, csr, x);
+
+  // Assert
+  EXPECT_EQ(multiply(csr, x), parallel);
+}
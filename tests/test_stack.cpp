@@ -0,0 +1,59 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <memory>
+#include <string>
+#include "../lib_stack/stack.h"
+
+TEST(TestStackLib, can_push_and_pop_in_lifo_order) {
+  // Arrange
+  TStack<int> stack;
+
+  // Act
+  for (int i = 0; i < 10000; i++) {
+    stack.push(i);
+  }
+
+  // Assert
+  for (int i = 9999; i >= 0; i--) {
+    ASSERT_EQ(i, stack.top());
+    stack.pop();
+  }
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(TestStackLib, can_take_move_only_values) {
+  // Arrange
+  TStack<std::unique_ptr<std::string>> stack;
+  stack.emplace(new std::string("bottom"));
+  stack.emplace(new std::string("top"));
+
+  // Act
+  std::unique_ptr<std::string> top = stack.take();
+
+  // Assert
+  EXPECT_EQ("top", *top);
+  EXPECT_EQ("bottom", *stack.top());
+  EXPECT_EQ(1u, stack.size());
+}
+
+TEST(TestStackLib, throw_when_stack_is_empty) {
+  // Arrange
+  TStack<int> stack;
+
+  // Act & Assert
+  ASSERT_ANY_THROW(stack.top());
+  ASSERT_ANY_THROW(stack.pop());
+  ASSERT_ANY_THROW(stack.take());
+}
+
+TEST(TestStackLib, can_use_custom_chunk_size) {
+  // Arrange
+  TStack<int> stack(TChunkedDeque<int>(1024));
+
+  // Act
+  stack.push(1);
+
+  // Assert
+  EXPECT_EQ(1024u, stack.container().chunk_size());
+}
@@ -0,0 +1,235 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../lib_strings/aho_corasick.h"
+#include "../lib_strings/prefix_search.h"
+#include "../lib_strings/substring_search.h"
+
+namespace {
+
+const SimdLevel kLevels[] = {
+    SimdLevel::kScalar, SimdLevel::kSse41, SimdLevel::kAvx2
+};
+
+// случайная строка над алфавитом из alphabet первых букв: на малом
+// алфавите много частичных совпадений
+std::string make_text(size_t size, int alphabet, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::string text(size, 'a');
+    for (char& symbol : text) {
+        symbol = static_cast<char>('a' + gen() % alphabet);
+    }
+    return text;
+}
+
+// все вхождения (с перекрытиями) через std::string::find
+std::vector<uint64_t> find_all_std(const std::string& text,
+                                   const std::string& pattern) {
+    std::vector<uint64_t> result;
+    for (size_t position = text.find(pattern);
+         position != std::string::npos;
+         position = text.find(pattern, position + 1)) {
+        result.push_back(position);
+    }
+    return result;
+}
+
+// вхождения всех образцов, упорядоченные как у TAhoCorasick: по концу,
+// при равном конце - по убыванию длины, затем по номеру образца
+std::vector<TPatternMatch> find_patterns_std(
+    const std::string& text, const std::vector<std::string>& patterns) {
+    std::vector<TPatternMatch> result;
+    for (size_t index = 0; index < patterns.size(); index++) {
+        for (uint64_t position : find_all_std(text, patterns[index])) {
+            result.push_back(TPatternMatch{index,
+                                           static_cast<size_t>(position)});
+        }
+    }
+    std::sort(result.begin(), result.end(),
+              [&patterns](const TPatternMatch& a, const TPatternMatch& b) {
+                  size_t a_end = a.position + patterns[a.pattern].size();
+                  size_t b_end = b.position + patterns[b.pattern].size();
+                  if (a_end != b_end) {
+                      return a_end < b_end;
+                  }
+                  if (a.position != b.position) {
+                      return a.position < b.position;
+                  }
+                  return a.pattern < b.pattern;
+              });
+    return result;
+}
+
+}  // namespace
+
+TEST(TestStringsLib, find_substring_matches_std_find) {
+  // Arrange
+  std::string text = make_text(3000, 3, 1);
+
+  for (SimdLevel level : kLevels) {
+    for (size_t length = 1; length <= 40; length += 3) {
+      for (size_t start : {size_t(0), size_t(100), size_t(2990)}) {
+        std::string pattern = text.substr(start, length);
+        for (size_t from : {size_t(0), size_t(1), size_t(1500)}) {
+          // Act & Assert
+          EXPECT_EQ(text.find(pattern, from),
+                    find_substring(text, pattern, from, level));
+        }
+      }
+    }
+  }
+}
+
+TEST(TestStringsLib, find_substring_handles_misses_and_edges) {
+  // Arrange
+  std::string text = make_text(100, 2, 2) + "xyz";
+  const char* kPatterns[] = {"", "x", "xyz", "yz", "z", "xyzw", "ccc",
+                             "axyz"};
+
+  for (SimdLevel level : kLevels) {
+    for (const char* pattern : kPatterns) {
+      for (size_t from : {size_t(0), size_t(50), size_t(102), size_t(103),
+                          size_t(104)}) {
+        // Act & Assert
+        EXPECT_EQ(text.find(pattern, from),
+                  find_substring(text, pattern, from, level));
+      }
+    }
+  }
+}
+
+TEST(TestStringsLib, find_substring_finds_binary_bytes) {
+  // Arrange
+  std::string text(200, '\xFF');
+  text[150] = '\0';
+  text[151] = '\x80';
+  std::string pattern("\xFF\0\x80", 3);
+
+  for (SimdLevel level : kLevels) {
+    // Act & Assert
+    EXPECT_EQ(149u, find_substring(text, pattern, 0, level));
+  }
+}
+
+TEST(TestStringsLib, can_compute_prefix_and_z_functions) {
+  // Act
+  std::vector<size_t> prefix = prefix_function("abacaba");
+  std::vector<size_t> z = z_function("aabxaab");
+
+  // Assert
+  std::vector<size_t> expected_prefix = {0, 0, 1, 0, 1, 2, 3};
+  std::vector<size_t> expected_z = {7, 1, 0, 0, 3, 1, 0};
+  EXPECT_EQ(expected_prefix, prefix);
+  EXPECT_EQ(expected_z, z);
+}
+
+TEST(TestStringsLib, z_find_all_and_kmp_match_std_find) {
+  // Arrange
+  std::string text = make_text(5000, 2, 3);
+
+  for (size_t length : {1, 2, 5, 9, 16}) {
+    std::string pattern = text.substr(777, length);
+    std::vector<uint64_t> expected = find_all_std(text, pattern);
+    TKmpMatcher matcher(pattern);
+
+    // Act
+    std::vector<size_t> by_z = z_find_all(text, pattern);
+    std::vector<uint64_t> by_kmp = matcher.find_all(text);
+
+    // Assert
+    EXPECT_EQ(expected, std::vector<uint64_t>(by_z.begin(), by_z.end()));
+    EXPECT_EQ(expected, by_kmp);
+  }
+}
+
+TEST(TestStringsLib, kmp_finds_matches_across_chunks) {
+  // Arrange
+  std::string text = make_text(4000, 2, 4);
+  std::string pattern = "abbabab";
+  TKmpMatcher matcher(pattern);
+  std::mt19937 gen(5);
+  std::vector<uint64_t> found;
+
+  // Act
+  for (size_t offset = 0; offset < text.size();) {
+    size_t size = std::min<size_t>(gen() % 9, text.size() - offset);
+    matcher.feed(std::string_view(text).substr(offset, size),
+                 [&found](uint64_t start) { found.push_back(start); });
+    offset += size;
+  }
+
+  // Assert
+  EXPECT_EQ(text.size(), matcher.position());
+  EXPECT_EQ(find_all_std(text, pattern), found);
+}
+
+TEST(TestStringsLib, throw_when_kmp_pattern_is_empty) {
+  // Act & Assert
+  ASSERT_THROW(TKmpMatcher(""), std::invalid_argument);
+}
+
+TEST(TestStringsLib, aho_corasick_matches_std_find_per_pattern) {
+  // Arrange
+  std::string text = make_text(20000, 3, 6);
+  std::vector<std::string> patterns = {"a", "ab", "abc", "bc", "c",
+                                       "cab", "abcab", "ab", "bbbb",
+                                       "cccc", "acbacb", "zzz"};
+  for (int i = 0; i < 30; i++) {
+    patterns.push_back(text.substr(i * 500, 3 + i % 7));
+  }
+
+  // Act
+  TAhoCorasick automaton(patterns);
+
+  // Assert
+  EXPECT_EQ(patterns.size(), automaton.pattern_count());
+  EXPECT_LT(automaton.table_size(), automaton.state_count() + 600);
+  EXPECT_EQ(find_patterns_std(text, patterns), automaton.find_all(text));
+}
+
+TEST(TestStringsLib, aho_corasick_continues_scan_across_chunks) {
+  // Arrange
+  std::string text = "he said: she sells his shells; hers";
+  std::vector<std::string> patterns = {"he", "she", "his", "hers", "ell"};
+  TAhoCorasick automaton(patterns);
+  size_t whole = automaton.find_all(text).size();
+  size_t found = 0;
+
+  // Act
+  uint32_t state = TAhoCorasick::kRoot;
+  for (size_t offset = 0; offset < text.size(); offset += 4) {
+    state = automaton.scan(std::string_view(text).substr(offset, 4),
+                           [&found](size_t, size_t) { found++; }, state);
+  }
+
+  // Assert
+  EXPECT_EQ(whole, found);
+  EXPECT_EQ(10u, found);
+}
+
+TEST(TestStringsLib, aho_corasick_handles_all_byte_values) {
+  // Arrange
+  std::string text;
+  for (int i = 0; i < 1024; i++) {
+    text.push_back(static_cast<char>(i * 7));
+  }
+  std::vector<std::string> patterns = {std::string("\0\x07", 2),
+                                       "\xF9\0", "\xFF", text.substr(500)};
+
+  // Act
+  TAhoCorasick automaton(patterns);
+
+  // Assert
+  EXPECT_EQ(find_patterns_std(text, patterns), automaton.find_all(text));
+}
+
+TEST(TestStringsLib, throw_when_aho_corasick_pattern_is_empty) {
+  // Act & Assert
+  ASSERT_THROW(TAhoCorasick({"a", ""}), std::invalid_argument);
+}
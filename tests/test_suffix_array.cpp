@@ -0,0 +1,212 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../lib_suffix_array/suffix_array.h"
+#include "../lib_suffix_array/suffix_index.h"
+
+namespace {
+
+// суффиксный массив сортировкой суффиксов
+std::vector<uint32_t> naive_suffix_array(const std::string& text) {
+    std::vector<uint32_t> result(text.size());
+    for (size_t i = 0; i < text.size(); i++) {
+        result[i] = static_cast<uint32_t>(i);
+    }
+    std::string_view view(text);
+    std::sort(result.begin(), result.end(),
+              [view](uint32_t a, uint32_t b) {
+                  // сравнение беззнаковых байтов, как в suffix_array
+                  std::basic_string_view<unsigned char> left(
+                      reinterpret_cast<const unsigned char*>(view.data()) + a,
+                      view.size() - a);
+                  std::basic_string_view<unsigned char> right(
+                      reinterpret_cast<const unsigned char*>(view.data()) + b,
+                      view.size() - b);
+                  return left < right;
+              });
+    return result;
+}
+
+std::vector<uint32_t> naive_lcp(const std::string& text,
+                                const std::vector<uint32_t>& sa) {
+    std::vector<uint32_t> result(sa.size(), 0);
+    for (size_t i = 1; i < sa.size(); i++) {
+        uint32_t common = 0;
+        while (sa[i - 1] + common < text.size() &&
+               sa[i] + common < text.size() &&
+               text[sa[i - 1] + common] == text[sa[i] + common]) {
+            common++;
+        }
+        result[i] = common;
+    }
+    return result;
+}
+
+std::string make_text(size_t size, int alphabet, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::string text(size, 'a');
+    for (char& symbol : text) {
+        symbol = static_cast<char>('a' + gen() % alphabet);
+    }
+    return text;
+}
+
+std::vector<uint32_t> find_all_std(const std::string& text,
+                                   const std::string& pattern) {
+    std::vector<uint32_t> result;
+    for (size_t position = text.find(pattern);
+         position != std::string::npos;
+         position = text.find(pattern, position + 1)) {
+        result.push_back(static_cast<uint32_t>(position));
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(TestSuffixArrayLib, can_build_suffix_array_of_banana) {
+  // Act
+  std::vector<uint32_t> sa = suffix_array("banana");
+  std::vector<uint32_t> lcp = lcp_array("banana", sa);
+
+  // Assert
+  std::vector<uint32_t> expected_sa = {5, 3, 1, 0, 4, 2};
+  std::vector<uint32_t> expected_lcp = {0, 1, 3, 0, 0, 2};
+  EXPECT_EQ(expected_sa, sa);
+  EXPECT_EQ(expected_lcp, lcp);
+}
+
+TEST(TestSuffixArrayLib, can_build_suffix_array_of_short_texts) {
+  // Act & Assert
+  EXPECT_TRUE(suffix_array("").empty());
+  EXPECT_EQ(std::vector<uint32_t>({0}), suffix_array("x"));
+  EXPECT_EQ(std::vector<uint32_t>({1, 0}), suffix_array("ba"));
+  EXPECT_EQ(std::vector<uint32_t>({1, 0}), suffix_array("aa"));
+  EXPECT_EQ(std::vector<uint32_t>({0, 1}), suffix_array("ab"));
+}
+
+TEST(TestSuffixArrayLib, suffix_array_matches_naive_sort) {
+  for (int alphabet : {1, 2, 3, 4, 26}) {
+    for (size_t size : {3, 10, 57, 300, 2000}) {
+      // Arrange
+      std::string text = make_text(size, alphabet,
+                                   static_cast<uint32_t>(size + alphabet));
+
+      // Act
+      std::vector<uint32_t> sa = suffix_array(text);
+
+      // Assert
+      EXPECT_EQ(naive_suffix_array(text), sa);
+      EXPECT_EQ(naive_lcp(text, sa), lcp_array(text, sa));
+    }
+  }
+}
+
+TEST(TestSuffixArrayLib, suffix_array_handles_repetitions_and_bytes) {
+  // Arrange: периодические строки дают глубокую рекурсию SA-IS
+  std::vector<std::string> texts = {
+      "mississippi", "abracadabra", std::string(500, 'z'),
+      "", "abab", "aabaabaabaab"
+  };
+  std::string fibonacci_prev = "a";
+  std::string fibonacci = "ab";
+  while (fibonacci.size() < 3000) {
+    std::string next = fibonacci + fibonacci_prev;
+    fibonacci_prev = fibonacci;
+    fibonacci = next;
+  }
+  texts.push_back(fibonacci);
+  std::string periodic;
+  for (int i = 0; i < 400; i++) {
+    periodic += "abcabd";
+  }
+  texts.push_back(periodic);
+  std::string binary;
+  for (int i = 0; i < 1000; i++) {
+    binary.push_back(static_cast<char>((i * 37) % 5 == 0 ? 0xFF : i % 3));
+  }
+  texts.push_back(binary);
+
+  for (const std::string& text : texts) {
+    // Act
+    std::vector<uint32_t> sa = suffix_array(text);
+
+    // Assert
+    EXPECT_EQ(naive_suffix_array(text), sa);
+    EXPECT_EQ(naive_lcp(text, sa), lcp_array(text, sa));
+  }
+}
+
+TEST(TestSuffixArrayLib, can_report_peak_memory) {
+  // Arrange
+  std::string text = make_text(100000, 4, 9);
+  size_t peak = 0;
+
+  // Act
+  suffix_array(text, &peak);
+
+  // Assert: сам массив, типы и корзины уровней рекурсии
+  EXPECT_GE(peak, text.size() * 4);
+  EXPECT_LT(peak, text.size() * 6);
+}
+
+TEST(TestSuffixArrayLib, can_report_lcp_peak_memory) {
+  // Arrange
+  std::string text = make_text(1000, 4, 11);
+  std::vector<uint32_t> sa = suffix_array(text);
+  size_t peak = 0;
+
+  // Act
+  lcp_array(text, sa, &peak);
+
+  // Assert: обратный массив и результат
+  EXPECT_EQ(text.size() * 2 * sizeof(uint32_t), peak);
+}
+
+TEST(TestSuffixArrayLib, throw_when_lcp_gets_foreign_suffix_array) {
+  // Act & Assert
+  ASSERT_THROW(lcp_array("abc", {0, 1}), std::invalid_argument);
+}
+
+TEST(TestSuffixArrayLib, index_finds_same_positions_as_std_find) {
+  // Arrange
+  std::string text = make_text(5000, 3, 10);
+  TSuffixIndex index(text);
+  std::vector<std::string> patterns = {"a", "ab", "cab", "aaaaa",
+                                       "abcabcabc", "d", "c"};
+  for (int i = 0; i < 20; i++) {
+    patterns.push_back(text.substr(i * 241, 1 + i % 12));
+  }
+  patterns.push_back(text.substr(4990));
+  patterns.push_back(text + "a");
+
+  for (const std::string& pattern : patterns) {
+    std::vector<uint32_t> expected = find_all_std(text, pattern);
+
+    // Act
+    std::vector<uint32_t> found = index.find_all(pattern);
+
+    // Assert
+    EXPECT_EQ(expected, found);
+    EXPECT_EQ(found.size(), index.count(pattern));
+    EXPECT_EQ(!found.empty(), index.contains(pattern));
+  }
+}
+
+TEST(TestSuffixArrayLib, empty_pattern_matches_every_suffix) {
+  // Arrange
+  TSuffixIndex index("abc");
+
+  // Act
+  std::pair<size_t, size_t> range = index.equal_range("");
+
+  // Assert
+  EXPECT_EQ(0u, range.first);
+  EXPECT_EQ(3u, range.second);
+}
@@ -0,0 +1,217 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../lib_tree/search_tree.h"
+
+namespace {
+
+// случайные вставки и удаления с проверкой инвариантов и сравнением с
+// std::map после каждой сотни операций
+template <class Tree>
+void check_random_operations(uint32_t seed) {
+    std::mt19937 gen(seed);
+    Tree tree;
+    std::map<int, int> reference;
+    for (int step = 0; step < 20000; step++) {
+        int key = static_cast<int>(gen() % 3000);
+        if (gen() % 3 == 0) {
+            ASSERT_EQ(reference.erase(key), tree.erase(key));
+        } else {
+            bool inserted = tree.insert({ key, step }).second;
+            ASSERT_EQ(reference.insert({ key, step }).second, inserted);
+        }
+        if (step % 100 == 0) {
+            ASSERT_TRUE(tree.check_invariants());
+            ASSERT_EQ(reference.size(), tree.size());
+        }
+    }
+    ASSERT_TRUE(tree.check_invariants());
+    using TItems = std::vector<std::pair<int, int>>;
+    ASSERT_EQ(TItems(reference.begin(), reference.end()),
+              TItems(tree.begin(), tree.end()));
+}
+
+template <class Tree>
+void check_order_statistics() {
+    Tree tree;
+    for (int key = 0; key < 1000; key++) {
+        tree[key * 2] = key;
+    }
+    for (size_t k = 0; k < 1000; k += 37) {
+        EXPECT_EQ(static_cast<int>(k * 2), tree.select(k)->first);
+        EXPECT_EQ(k, tree.index_of(tree.select(k)));
+    }
+    EXPECT_EQ(tree.size(), tree.index_of(tree.end()));
+    const Tree empty;
+    EXPECT_EQ(0u, empty.index_of(empty.end()));
+    EXPECT_EQ(0u, tree.rank(-5));
+    EXPECT_EQ(0u, tree.rank(0));
+    EXPECT_EQ(1u, tree.rank(1));
+    EXPECT_EQ(500u, tree.rank(999));
+    EXPECT_EQ(1000u, tree.rank(5000));
+    EXPECT_EQ(50u, tree.count_range(100, 200));
+    EXPECT_EQ(0u, tree.count_range(200, 100));
+}
+
+template <class Tree>
+void check_bulk_build(size_t count) {
+    std::vector<typename Tree::value_type> values;
+    for (size_t i = 0; i < count; i++) {
+        values.emplace_back(static_cast<int>(i * 3), static_cast<int>(i));
+    }
+    Tree tree;
+    tree[-1] = -1;
+    tree.assign_sorted(values);
+    ASSERT_TRUE(tree.check_invariants());
+    ASSERT_EQ(count, tree.size());
+    EXPECT_FALSE(tree.contains(-1));
+    size_t expected_height = 0;
+    while ((size_t(1) << expected_height) - 1 < count) {
+        expected_height++;
+    }
+    EXPECT_EQ(expected_height, tree.height());
+    // дерево после построения остаётся рабочим
+    tree[1] = 7;
+    tree.erase(0);
+    EXPECT_TRUE(tree.check_invariants());
+}
+
+}  // namespace
+
+TEST(TestTreeLib, avl_keeps_invariants_after_random_operations) {
+  check_random_operations<TAvlMap<int, int>>(1);
+  check_random_operations<TAvlMap<int, int>>(2);
+}
+
+TEST(TestTreeLib, red_black_keeps_invariants_after_random_operations) {
+  check_random_operations<TRedBlackMap<int, int>>(1);
+  check_random_operations<TRedBlackMap<int, int>>(2);
+}
+
+TEST(TestTreeLib, height_is_logarithmic_on_sorted_insertions) {
+  // Arrange
+  const int kCount = 1 << 16;
+  TAvlMap<int, int> avl;
+  TRedBlackMap<int, int> red_black;
+
+  // Act
+  for (int key = 0; key < kCount; key++) {
+    avl[key] = key;
+    red_black[key] = key;
+  }
+
+  // Assert: АВЛ - не выше 1.44 log2 n, красно-чёрное - не выше 2 log2 n
+  double log_n = std::log2(kCount);
+  EXPECT_LE(static_cast<double>(avl.height()), 1.44 * log_n + 1);
+  EXPECT_LE(static_cast<double>(red_black.height()), 2 * log_n);
+  EXPECT_TRUE(avl.check_invariants());
+  EXPECT_TRUE(red_black.check_invariants());
+}
+
+TEST(TestTreeLib, can_find_k_th_and_rank) {
+  check_order_statistics<TAvlMap<int, int>>();
+  check_order_statistics<TRedBlackMap<int, int>>();
+}
+
+TEST(TestTreeLib, can_build_from_sorted_input) {
+  for (size_t count : { 0, 1, 2, 7, 8, 100, 1023, 1024 }) {
+    check_bulk_build<TAvlMap<int, int>>(count);
+    check_bulk_build<TRedBlackMap<int, int>>(count);
+  }
+}
+
+TEST(TestTreeLib, throw_when_sorted_input_is_not_increasing) {
+  TRedBlackMap<int, int> tree;
+
+  ASSERT_ANY_THROW(tree.assign_sorted({ { 1, 0 }, { 3, 0 }, { 2, 0 } }));
+  ASSERT_ANY_THROW(tree.assign_sorted({ { 1, 0 }, { 1, 0 } }));
+}
+
+TEST(TestTreeLib, can_iterate_over_key_range) {
+  // Arrange
+  TAvlMap<int, std::string> tree;
+  for (int key = 0; key < 20; key += 2) {
+    tree[key] = std::to_string(key);
+  }
+
+  // Act
+  std::vector<int> keys;
+  for (const auto& item : tree.range(5, 13)) {
+    keys.push_back(item.first);
+  }
+
+  // Assert
+  EXPECT_EQ(std::vector<int>({ 6, 8, 10, 12 }), keys);
+  EXPECT_TRUE(tree.range(7, 8).empty());
+  EXPECT_EQ(12, tree.lower_bound(11)->first);
+  EXPECT_EQ(14, tree.upper_bound(12)->first);
+  EXPECT_EQ(18, (--tree.end())->first);
+}
+
+TEST(TestTreeLib, can_erase_while_iterating) {
+  TRedBlackMap<int, int> tree;
+  for (int key = 0; key < 100; key++) {
+    tree[key] = key;
+  }
+
+  for (auto it = tree.begin(); it != tree.end();) {
+    it = it->first % 3 == 0 ? tree.erase(it) : std::next(it);
+  }
+
+  EXPECT_EQ(66u, tree.size());
+  EXPECT_FALSE(tree.contains(33));
+  EXPECT_TRUE(tree.check_invariants());
+}
+
+TEST(TestTreeLib, can_copy_and_move) {
+  // Arrange
+  TAvlMap<int, std::string> tree;
+  for (int key = 0; key < 50; key++) {
+    tree[key] = std::to_string(key);
+  }
+
+  // Act
+  TAvlMap<int, std::string> copy(tree);
+  TAvlMap<int, std::string> moved(std::move(tree));
+  copy.erase(10);
+
+  // Assert
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(50u, moved.size());
+  EXPECT_EQ("10", moved.at(10));
+  EXPECT_EQ(49u, copy.size());
+  EXPECT_TRUE(copy.check_invariants());
+  tree = copy;
+  EXPECT_EQ(49u, tree.size());
+  EXPECT_EQ("20", tree.at(20));
+}
+
+TEST(TestTreeLib, trees_can_share_node_pool) {
+  auto pool = TRedBlackMap<int, int>::make_pool();
+  TRedBlackMap<int, int> first(pool);
+  TRedBlackMap<int, int> second(pool);
+
+  first[1] = 1;
+  second[2] = 2;
+  second[3] = 3;
+
+  EXPECT_EQ(3u, pool->objects_in_use());
+  first.clear();
+  EXPECT_EQ(2u, pool->objects_in_use());
+}
+
+TEST(TestTreeLib, throw_when_key_or_index_is_missing) {
+  TAvlMap<int, int> tree;
+  tree[1] = 1;
+
+  ASSERT_ANY_THROW(tree.at(2));
+  ASSERT_ANY_THROW(tree.select(1));
+  ASSERT_NO_THROW(tree.select(0));
+}
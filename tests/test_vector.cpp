@@ -0,0 +1,226 @@
+// Copyright 2024 Marina Usova
+
+#include <gtest.h>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include "../lib_vector/vector.h"
+
+namespace {
+
+// элемент, копирование которого бросает после copies_left копий; число
+// живых объектов считается, чтобы заметить утечку или лишний деструктор
+struct TThrowingCopy {
+    static int alive;
+    static int copies_left;
+
+    int value;
+
+    explicit TThrowingCopy(int value) : value(value) { alive++; }
+    TThrowingCopy(const TThrowingCopy& other) : value(other.value) {
+        if (copies_left-- == 0) {
+            throw std::runtime_error("copy failed");
+        }
+        alive++;
+    }
+    ~TThrowingCopy() { alive--; }
+};
+
+int TThrowingCopy::alive = 0;
+int TThrowingCopy::copies_left = 0;
+
+}  // namespace
+
+TEST(TestVectorLib, can_create_empty_vector) {
+  // Act
+  TVector<int> vector;
+
+  // Assert
+  EXPECT_TRUE(vector.empty());
+  EXPECT_EQ(0u, vector.size());
+}
+
+TEST(TestVectorLib, can_push_back_and_read_elements) {
+  // Arrange
+  TVector<int> vector;
+
+  // Act
+  for (int i = 0; i < 100; i++) {
+    vector.push_back(i * i);
+  }
+
+  // Assert
+  ASSERT_EQ(100u, vector.size());
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(i * i, vector[i]);
+  }
+}
+
+TEST(TestVectorLib, small_vector_stays_in_inline_buffer) {
+  // Arrange
+  TVector<int, 4> vector = { 1, 2, 3 };
+
+  // Act
+  vector.push_back(4);
+
+  // Assert
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ(4u, vector.capacity());
+}
+
+TEST(TestVectorLib, can_grow_out_of_inline_buffer_and_shrink_back) {
+  // Arrange
+  TVector<std::string, 2> vector = { "a", "b" };
+
+  // Act
+  vector.push_back("c");
+  bool inline_after_growth = vector.is_inline();
+  vector.pop_back();
+  vector.shrink_to_fit();
+
+  // Assert
+  EXPECT_FALSE(inline_after_growth);
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ((TVector<std::string, 2>{ "a", "b" }), vector);
+}
+
+TEST(TestVectorLib, growth_follows_growth_factor) {
+  // Arrange
+  TVector<int, 0, 2, 1> vector;
+  vector.reserve(8);
+
+  // Act
+  for (int i = 0; i < 9; i++) {
+    vector.push_back(i);
+  }
+
+  // Assert
+  EXPECT_EQ(16u, vector.capacity());
+}
+
+TEST(TestVectorLib, reserve_and_shrink_to_fit_change_capacity) {
+  // Arrange
+  TVector<int> vector = { 1, 2, 3 };
+
+  // Act
+  vector.reserve(100);
+  size_t reserved = vector.capacity();
+  vector.shrink_to_fit();
+
+  // Assert
+  EXPECT_EQ(100u, reserved);
+  EXPECT_EQ(3u, vector.capacity());
+  EXPECT_EQ(3, vector.back());
+}
+
+TEST(TestVectorLib, can_relocate_move_only_elements) {
+  // Arrange
+  TVector<std::unique_ptr<int>, 1> vector;
+
+  // Act
+  for (int i = 0; i < 10; i++) {
+    vector.emplace_back(new int(i));
+  }
+
+  // Assert
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(i, *vector[i]);
+  }
+}
+
+TEST(TestVectorLib, can_push_back_own_element) {
+  // Arrange
+  TVector<std::string> vector = { "first" };
+
+  // Act
+  for (int i = 0; i < 10; i++) {
+    vector.push_back(vector[0]);
+  }
+
+  // Assert
+  EXPECT_EQ(11u, vector.size());
+  EXPECT_EQ("first", vector.back());
+}
+
+TEST(TestVectorLib, failed_growth_keeps_vector_unchanged) {
+  // Arrange
+  TThrowingCopy::alive = 0;
+  {
+    TVector<TThrowingCopy, 2> vector;
+    vector.emplace_back(1);
+    vector.emplace_back(2);
+    TThrowingCopy::copies_left = 1;
+
+    // Act: новый элемент строится, перенос второго старого бросает
+    ASSERT_THROW(vector.emplace_back(3), std::runtime_error);
+
+    // Assert
+    EXPECT_EQ(2u, vector.size());
+    EXPECT_EQ(2u, vector.capacity());
+    EXPECT_EQ(2, vector.back().value);
+    EXPECT_EQ(2, TThrowingCopy::alive);
+  }
+  EXPECT_EQ(0, TThrowingCopy::alive);
+}
+
+TEST(TestVectorLib, heap_buffer_respects_over_aligned_types) {
+  // Arrange
+  struct alignas(64) TLine {
+    char bytes[64];
+  };
+  TVector<TLine, 1> vector;
+
+  // Act
+  for (int i = 0; i < 10; i++) {
+    vector.push_back(TLine());
+  }
+
+  // Assert
+  EXPECT_FALSE(vector.is_inline());
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(vector.data()) % 64);
+}
+
+TEST(TestVectorLib, can_copy_and_move_vector) {
+  // Arrange
+  TVector<std::string, 2> source = { "x", "y", "z" };
+
+  // Act
+  TVector<std::string, 2> copy(source);
+  TVector<std::string, 2> moved(std::move(source));
+
+  // Assert
+  EXPECT_EQ(copy, moved);
+  EXPECT_TRUE(source.empty());
+}
+
+TEST(TestVectorLib, can_insert_and_erase) {
+  // Arrange
+  TVector<int> vector = { 1, 3, 4 };
+
+  // Act
+  vector.insert(vector.begin() + 1, 2);
+  vector.erase(vector.begin());
+
+  // Assert
+  EXPECT_EQ((TVector<int>{ 2, 3, 4 }), vector);
+}
+
+TEST(TestVectorLib, can_resize) {
+  // Arrange
+  TVector<int, 2> vector = { 1 };
+
+  // Act
+  vector.resize(5, 7);
+
+  // Assert
+  EXPECT_EQ((TVector<int, 2>{ 1, 7, 7, 7, 7 }), vector);
+}
+
+TEST(TestVectorLib, throw_when_index_is_out_of_range) {
+  // Arrange
+  TVector<int> vector = { 1, 2 };
+
+  // Act & Assert
+  ASSERT_THROW(vector.at(2), std::out_of_range);
+}